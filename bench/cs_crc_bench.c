@@ -0,0 +1,394 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Stand alone benchmark for the CFS Checksum (CS) Application's
+ *   checksum kernels
+ *
+ *   Times every kernel that CS can select over chunk sizes from 64 bytes
+ *   to 16 MB, from both aligned and unaligned buffers, and writes one CSV
+ *   line per measurement to stdout. Lines starting with '#' describe the
+ *   run and can be skipped by tools that only want the data.
+ *
+ *   Usage: cs_crc_bench [-b bytes] [-r repeats] [-f MHz]
+ *     -b  Bytes checksummed per measurement (default 64 MB)
+ *     -r  Measurements per result, the fastest is reported (default 3)
+ *     -f  Processor clock in MHz, used for cycles/byte where the
+ *         processor has no cycle counter the benchmark can read
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_platform_cfg.h"
+#include "cs_msgdefs.h"
+#include "cs_crc.h"
+#include "cs_hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CS_BENCH_HAVE_TSC
+#include <x86intrin.h>
+#endif
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+#define CS_BENCH_MIN_CHUNK_BYTES 64
+#define CS_BENCH_MAX_CHUNK_BYTES (16 * 1024 * 1024)
+
+/* Buffers start on a cache line, unaligned runs start one byte past it */
+#define CS_BENCH_BUFFER_ALIGN 64
+
+#define CS_BENCH_DEFAULT_BYTES   (64 * 1024 * 1024)
+#define CS_BENCH_DEFAULT_REPEATS 3
+
+/**************************************************************************
+ **
+ ** Type definitions
+ **
+ **************************************************************************/
+
+typedef enum
+{
+    CS_BENCH_KERNEL_CFE,      /* Byte at a time CRC-16, as CFE_ES_CalculateCRC */
+    CS_BENCH_KERNEL_TABLE,    /* CS_ComputeCRC with the table-driven kernels */
+    CS_BENCH_KERNEL_HARDWARE, /* CS_ComputeCRC with the processor instructions */
+    CS_BENCH_KERNEL_HASH      /* CS_ComputeHash */
+} CS_Bench_KernelType_t;
+
+typedef struct
+{
+    const char           *KernelName;
+    const char           *AlgorithmName;
+    CS_Bench_KernelType_t Type;
+    uint32                Algorithm;
+} CS_Bench_Kernel_t;
+
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+static const CS_Bench_Kernel_t CS_Bench_Kernels[] = {
+    {"cfe", "crc16", CS_BENCH_KERNEL_CFE, CFE_ES_CrcType_CRC_16},
+    {"table", "crc16", CS_BENCH_KERNEL_TABLE, CFE_ES_CrcType_CRC_16},
+    {"table", "crc32", CS_BENCH_KERNEL_TABLE, CFE_ES_CrcType_CRC_32},
+    {"table", "crc32c", CS_BENCH_KERNEL_TABLE, CS_ALGORITHM_CRC_32C},
+    {"hardware", "crc32", CS_BENCH_KERNEL_HARDWARE, CFE_ES_CrcType_CRC_32},
+    {"hardware", "crc32c", CS_BENCH_KERNEL_HARDWARE, CS_ALGORITHM_CRC_32C},
+    {"hash", "xxhash64", CS_BENCH_KERNEL_HASH, CS_ALGORITHM_XXHASH_64},
+    {"hash", "fletcher64", CS_BENCH_KERNEL_HASH, CS_ALGORITHM_FLETCHER_64},
+};
+
+/* Every timed result is added in here, so no call can be optimized away */
+static volatile uint64 CS_Bench_Sink;
+
+/* Byte at a time CRC-16 table, the same method CFE_ES_CalculateCRC uses */
+static uint16 CS_Bench_Crc16Table[256];
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stand in for the cFE service, so the fall back path of          */
+/* CS_ComputeCRC and the "cfe" kernel time the cFE method          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    const uint8 *BufPtr = (const uint8 *)DataPtr;
+    int16        Crc    = (int16)InputCRC;
+
+    if (TypeCRC != CFE_ES_CrcType_CRC_16)
+    {
+        return 0;
+    }
+
+    while (DataLength-- > 0)
+    {
+        Crc = (int16)(((Crc >> 8) & 0x00FF) ^ CS_Bench_Crc16Table[(Crc ^ *BufPtr++) & 0x00FF]);
+    }
+
+    return (uint32)(int32)Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stand in for the OSAL service, so CS_CalibrateCRC can time the  */
+/* kernels with the host clock                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 OS_GetLocalTime(OS_time_t *time_struct)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    *time_struct = OS_TimeAssembleFromNanoseconds(Now.tv_sec, (uint32)Now.tv_nsec);
+
+    return OS_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Builds the byte at a time CRC-16 table                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_Bench_InitCrc16Table(void)
+{
+    uint32 n;
+    uint32 Bit;
+    uint32 Crc;
+
+    for (n = 0; n < 256; n++)
+    {
+        Crc = n;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+        }
+
+        CS_Bench_Crc16Table[n] = (uint16)Crc;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reads the wall clock and, where there is one, the cycle counter */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static double CS_Bench_Seconds(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (double)Now.tv_sec + ((double)Now.tv_nsec * 1e-9);
+}
+
+static uint64 CS_Bench_Cycles(void)
+{
+#if defined(CS_BENCH_HAVE_TSC)
+    return (uint64)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Checksums one chunk with the kernel                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 CS_Bench_RunKernel(const CS_Bench_Kernel_t *Kernel, const uint8 *BufPtr, size_t ChunkBytes)
+{
+    CS_Hash_State_t HashState;
+    uint64          Result;
+
+    switch (Kernel->Type)
+    {
+        case CS_BENCH_KERNEL_CFE:
+            Result = CFE_ES_CalculateCRC(BufPtr, ChunkBytes, 0, (CFE_ES_CrcType_Enum_t)Kernel->Algorithm);
+            break;
+
+        case CS_BENCH_KERNEL_HASH:
+            CS_ComputeHash(BufPtr, ChunkBytes, 0, &HashState, Kernel->Algorithm);
+            CS_FinishHash(&HashState, ChunkBytes, Kernel->Algorithm, &Result);
+            break;
+
+        default:
+            Result = CS_ComputeCRC(BufPtr, ChunkBytes, 0, Kernel->Algorithm);
+            break;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Times one kernel over one chunk size and alignment, and prints  */
+/* the fastest of the repeated measurements                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_Bench_Measure(const CS_Bench_Kernel_t *Kernel, const uint8 *BufPtr, size_t ChunkBytes,
+                             const char *Alignment, size_t TotalBytes, uint32 Repeats, double ClockMHz)
+{
+    size_t Iterations = (TotalBytes > ChunkBytes) ? (TotalBytes / ChunkBytes) : 1;
+    double BestSeconds = 0;
+    uint64 BestCycles  = 0;
+    uint64 Checksum;
+    uint64 StartCycles;
+    double Start;
+    double Seconds;
+    uint64 Cycles;
+    double Bytes;
+    double CyclesPerByte;
+    size_t i;
+    uint32 Repeat;
+
+    CS_SelectCRCHardware(Kernel->Type == CS_BENCH_KERNEL_HARDWARE);
+
+    for (Repeat = 0; Repeat < Repeats; Repeat++)
+    {
+        Start       = CS_Bench_Seconds();
+        StartCycles = CS_Bench_Cycles();
+
+        for (i = 0; i < Iterations; i++)
+        {
+            CS_Bench_Sink += CS_Bench_RunKernel(Kernel, BufPtr, ChunkBytes);
+        }
+
+        Cycles  = CS_Bench_Cycles() - StartCycles;
+        Seconds = CS_Bench_Seconds() - Start;
+
+        if ((Repeat == 0) || (Seconds < BestSeconds))
+        {
+            BestSeconds = Seconds;
+            BestCycles  = Cycles;
+        }
+    }
+
+    /* Kernels for the same algorithm must report the same checksum */
+    Checksum = CS_Bench_RunKernel(Kernel, BufPtr, ChunkBytes);
+    Bytes    = (double)Iterations * (double)ChunkBytes;
+
+    printf("%s,%s,%lu,%s,%lu,%.9f,%.3f,", Kernel->KernelName, Kernel->AlgorithmName, (unsigned long)ChunkBytes,
+           Alignment, (unsigned long)Iterations, BestSeconds, (BestSeconds > 0) ? (Bytes / BestSeconds * 1e-9) : 0.0);
+
+    if (ClockMHz > 0)
+    {
+        CyclesPerByte = BestSeconds * ClockMHz * 1e6 / Bytes;
+        printf("%.3f", CyclesPerByte);
+    }
+    else if (BestCycles != 0)
+    {
+        printf("%.3f", (double)BestCycles / Bytes);
+    }
+
+    printf(",0x%016llX\n", (unsigned long long)Checksum);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Benchmark entry point                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int main(int argc, char *argv[])
+{
+    size_t   TotalBytes = CS_BENCH_DEFAULT_BYTES;
+    uint32   Repeats    = CS_BENCH_DEFAULT_REPEATS;
+    double   ClockMHz   = 0;
+    void    *Buffer     = NULL;
+    uint8   *BufPtr;
+    size_t   ChunkBytes;
+    size_t   i;
+    uint32   Kernel;
+    bool     HardwareSupported;
+    int      Option;
+
+    while ((Option = getopt(argc, argv, "b:r:f:h")) != -1)
+    {
+        switch (Option)
+        {
+            case 'b':
+                TotalBytes = (size_t)strtoull(optarg, NULL, 0);
+                break;
+
+            case 'r':
+                Repeats = (uint32)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'f':
+                ClockMHz = strtod(optarg, NULL);
+                break;
+
+            default:
+                fprintf(stderr, "Usage: %s [-b bytes] [-r repeats] [-f MHz]\n", argv[0]);
+                return (Option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if ((TotalBytes == 0) || (Repeats == 0))
+    {
+        fprintf(stderr, "%s: bytes and repeats must be greater than zero\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* Room for the largest chunk starting one byte past the alignment */
+    if (posix_memalign(&Buffer, CS_BENCH_BUFFER_ALIGN, CS_BENCH_MAX_CHUNK_BYTES + CS_BENCH_BUFFER_ALIGN) != 0)
+    {
+        fprintf(stderr, "%s: unable to allocate the test buffer\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    BufPtr = (uint8 *)Buffer;
+    for (i = 0; i < CS_BENCH_MAX_CHUNK_BYTES + CS_BENCH_BUFFER_ALIGN; i++)
+    {
+        BufPtr[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+
+    CS_Bench_InitCrc16Table();
+    CS_InitCRC();
+    HardwareSupported = CS_CRCHardwareSupported();
+
+    printf("# cs_crc_bench\n");
+    printf("# hardware_supported=%d\n", HardwareSupported ? 1 : 0);
+    printf("# interleave_min_bytes=%lu\n", (unsigned long)CS_CRC_INTERLEAVE_MIN_BYTES);
+    printf("# bytes_per_measurement=%lu repeats=%lu\n", (unsigned long)TotalBytes, (unsigned long)Repeats);
+    printf("# cycles=%s\n", (ClockMHz > 0) ? "clock_mhz" : ((CS_Bench_Cycles() != 0) ? "tsc" : "none"));
+    printf("kernel,algorithm,chunk_bytes,alignment,iterations,seconds,gb_per_s,cycles_per_byte,checksum\n");
+
+    for (Kernel = 0; Kernel < sizeof(CS_Bench_Kernels) / sizeof(CS_Bench_Kernels[0]); Kernel++)
+    {
+        if ((CS_Bench_Kernels[Kernel].Type == CS_BENCH_KERNEL_HARDWARE) && !HardwareSupported)
+        {
+            continue;
+        }
+
+        for (ChunkBytes = CS_BENCH_MIN_CHUNK_BYTES; ChunkBytes <= CS_BENCH_MAX_CHUNK_BYTES; ChunkBytes *= 2)
+        {
+            CS_Bench_Measure(&CS_Bench_Kernels[Kernel], BufPtr, ChunkBytes, "aligned", TotalBytes, Repeats,
+                             ClockMHz);
+            CS_Bench_Measure(&CS_Bench_Kernels[Kernel], BufPtr + 1, ChunkBytes, "unaligned", TotalBytes, Repeats,
+                             ClockMHz);
+        }
+    }
+
+    free(Buffer);
+
+    return EXIT_SUCCESS;
+}
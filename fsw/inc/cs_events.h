@@ -200,7 +200,7 @@
 #define CS_RECOMPUTE_CFECORE_STARTED_DBG_EID 14
 
 /**
- * \brief CS cFE Core Checksum Failed Child Task Create Event ID
+ * \brief CS cFE Core Checksum Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -208,10 +208,10 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the cFE core command has been received and the
- *  recompute failed because CFE_ES_CreateChildTask returned
+ *  recompute failed because OS_QueuePut returned
  *  an error.
  */
-#define CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID 15
+#define CS_RECOMPUTE_CFECORE_POST_WORK_ERR_EID 15
 
 /**
  * \brief CS cFE Core Checksum Failed Child Task In Use Event ID
@@ -241,7 +241,7 @@
 #define CS_RECOMPUTE_OS_STARTED_DBG_EID 17
 
 /**
- * \brief CS OS Code Checksum Recompute Failed Child Task Create Event ID
+ * \brief CS OS Code Checksum Recompute Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -249,10 +249,10 @@
  *
  *  This event message is issued when a recompute baseline
  *  for the OS code segment command has been received and the
- *  recompute failed because CFE_ES_CreateChildTask returned
+ *  recompute failed because OS_QueuePut returned
  *  an error.
  */
-#define CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID 18
+#define CS_RECOMPUTE_OS_POST_WORK_ERR_EID 18
 
 /**
  * \brief CS OS Code Checksum Recompute Failed Child Task In Use Event ID
@@ -281,7 +281,7 @@
 #define CS_ONESHOT_STARTED_DBG_EID 20
 
 /**
- * \brief CS Oneshot Checksum Failed Child Task Create Event ID
+ * \brief CS Oneshot Checksum Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -289,9 +289,9 @@
  *
  *  This event message is issued when a OneShot calculation
  *  command has been received and the OneShot failed because
- *  CFE_ES_CreateChildTask returned an error.
+ *  OS_QueuePut returned an error.
  */
-#define CS_ONESHOT_CREATE_CHDTASK_ERR_EID 21
+#define CS_ONESHOT_POST_WORK_ERR_EID 21
 
 /**
  * \brief CS Oneshot Checksum Failed Child Task In Use Event ID
@@ -331,19 +331,6 @@
  */
 #define CS_ONESHOT_CANCELLED_INF_EID 24
 
-/**
- * \brief CS Oneshot Checksum Failed Child Task Delete Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  This event message is issued when a cancel OneShot calculation
- *  command has been received and the cancel OneShot failed because
- *  CFE_ES_DeleteChildTask returned an error.
- */
-#define CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID 25
-
 /**
  * \brief CS Oneshot Checksum Cancel Failed No Oneshot Active Event ID
  *
@@ -558,7 +545,7 @@
 #define CS_RECOMPUTE_EEPROM_STARTED_DBG_EID 42
 
 /**
- * \brief CS EEPROM Checksum Recompute Failed Child Task Create Event ID
+ * \brief CS EEPROM Checksum Recompute Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -567,9 +554,9 @@
  *  This event message is issued when a recompute baseline
  *  for the specified EEPROM Entry ID command has been
  *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
+ *  OS_QueuePut returned an error.
  */
-#define CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID 43
+#define CS_RECOMPUTE_EEPROM_POST_WORK_ERR_EID 43
 
 /**
  * \brief CS EEPROM Checksum Recompute Failed Invalid Entry ID Event ID
@@ -757,7 +744,7 @@
 #define CS_RECOMPUTE_MEMORY_STARTED_DBG_EID 57
 
 /**
- * \brief CS Memory Checksum Recompute Failed Child Task Create Event ID
+ * \brief CS Memory Checksum Recompute Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -766,9 +753,9 @@
  *  This event message is issued when a recompute baseline
  *  for the specified Memory Entry ID command has been
  *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
+ *  OS_QueuePut returned an error.
  */
-#define CS_RECOMPUTE_MEMORY_CREATE_CHDTASK_ERR_EID 58
+#define CS_RECOMPUTE_MEMORY_POST_WORK_ERR_EID 58
 
 /**
  * \brief CS Memory Checksum Recompute Failed Invalid Entry ID Event ID
@@ -958,7 +945,7 @@
 #define CS_RECOMPUTE_TABLES_STARTED_DBG_EID 72
 
 /**
- * \brief CS Table Checksum Recompute Failed Child Task Create Event ID
+ * \brief CS Table Checksum Recompute Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -967,9 +954,9 @@
  *  This event message is issued when a recompute baseline
  *  for the specified Tables Entry ID command has been
  *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
+ *  OS_QueuePut returned an error.
  */
-#define CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID 73
+#define CS_RECOMPUTE_TABLES_POST_WORK_ERR_EID 73
 
 /**
  * \brief CS Table Checksum Recompute Failed Table Not Found Event ID
@@ -1131,7 +1118,7 @@
 #define CS_RECOMPUTE_APP_STARTED_DBG_EID 85
 
 /**
- * \brief CS App Checksum Recompute Failed Create Child Task Event ID
+ * \brief CS App Checksum Recompute Failed Posting To Worker Queue Event ID
  *
  *  \par Type: ERROR
  *
@@ -1140,9 +1127,9 @@
  *  This event message is issued when a recompute baseline
  *  for the specified app command has been
  *  received and the recompute failed because
- *  CFE_ES_CreateChildTask returned an error.
+ *  OS_QueuePut returned an error.
  */
-#define CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID 86
+#define CS_RECOMPUTE_APP_POST_WORK_ERR_EID 86
 
 /**
  * \brief CS App Checksum Recompute Failed App Not Found Event ID
@@ -1963,28 +1950,335 @@
 #define CS_CMD_COMPUTE_PROG_ERR_EID 152
 
 /**
- * \brief CS Skipping Background Cycle Due To Recompute Or Oneshote In Progress Event ID
+ * \brief CS Apps Table Validate Failed Illegal State With Long Name Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CS validation for the Apps definition table finds an entry
+ *  that contains a non-terminated name field.
+ */
+#define CS_VAL_APP_DEF_TBL_LONG_NAME_ERR_EID 154
+
+/**
+ * \brief CS EEPROM Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the EEPROM table validation function finds an entry
+ *  whose checksum algorithm is not one that CS can compute
+ */
+#define CS_VAL_EEPROM_ALG_ERR_EID 155
+
+/**
+ * \brief CS Memory Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Memory table validation function finds an entry
+ *  whose checksum algorithm is not one that CS can compute
+ */
+#define CS_VAL_MEMORY_ALG_ERR_EID 156
+
+/**
+ * \brief CS Tables Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Tables table validation function finds an entry
+ *  whose checksum algorithm is not one that CS can compute
+ */
+#define CS_VAL_TABLES_ALG_ERR_EID 157
+
+/**
+ * \brief CS Apps Table Validate Failed Illegal Algorithm Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Apps table validation function finds an entry
+ *  whose checksum algorithm is not one that CS can compute
+ */
+#define CS_VAL_APP_ALG_ERR_EID 158
+
+/**
+ * \brief CS CRC Kernel Calibration Event ID
  *
  *  \par Type: INFORMATION
  *
  *  \par Cause:
  *
- *  This event message is issued when the background cycle is attempted
- *  while a recompute or oneshot is in progress.
+ *  This event message is issued when CS has timed the kernels that can compute the default
+ *  checksum algorithm, at startup or on receipt of a #CS_CALIBRATE_CRC_CC command. It reports
+ *  the kernel selected and its measured throughput.
  */
-#define CS_BKGND_COMPUTE_PROG_INF_EID 153
+#define CS_CALIBRATE_CRC_INF_EID 159
 
 /**
- * \brief CS Apps Table Validate Failed Illegal State With Long Name Event ID
+ * \brief CS Set Cycle Time Budget Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_CYCLE_TIME_BUDGET_CC command has been
+ *  accepted
+ */
+#define CS_SET_CYCLE_TIME_BUDGET_INF_EID 160
+
+/**
+ * \brief CS Set Cycle Time Budget Command Failed Budget Too Large Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  This event message is issued when CS validation for the Apps definition table finds an entry
- *  that contains a non-terminated name field.
+ *  This event message is issued when a #CS_SET_CYCLE_TIME_BUDGET_CC command requests a
+ *  budget greater than #CS_MAX_CYCLE_TIME_BUDGET
  */
-#define CS_VAL_APP_DEF_TBL_LONG_NAME_ERR_EID 154
+#define CS_SET_CYCLE_TIME_BUDGET_ERR_EID 161
+
+/**
+ * \brief CS Set Cycle Time Target Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_CYCLE_TIME_TARGET_CC command has been
+ *  accepted
+ */
+#define CS_SET_CYCLE_TIME_TARGET_INF_EID 162
+
+/**
+ * \brief CS Set Cycle Time Target Command Failed Target Too Large Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_CYCLE_TIME_TARGET_CC command requests a
+ *  target greater than #CS_MAX_CYCLE_TIME_BUDGET
+ */
+#define CS_SET_CYCLE_TIME_TARGET_ERR_EID 163
+
+/**
+ * \brief CS Set Bytes Per Cycle Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_BYTES_PER_CYCLE_CC command has been
+ *  accepted
+ */
+#define CS_SET_BYTES_PER_CYCLE_INF_EID 164
+
+/**
+ * \brief CS Set Bytes Per Cycle Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_BYTES_PER_CYCLE_CC command names a
+ *  budget that does not exist, sets a budget greater than #CS_MAX_BUDGET_BYTES_PER_CYCLE,
+ *  or the byte budget table is not loaded
+ */
+#define CS_SET_BYTES_PER_CYCLE_ERR_EID 165
+
+/**
+ * \brief CS Byte Budget Table Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the byte budget table could not be initialized at
+ *  startup. Every checksum type then uses the shared bytes per cycle.
+ */
+#define CS_INIT_BUDGET_ERR_EID 166
+
+/**
+ * \brief CS Byte Budget Table Update Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the byte budget table can not be updated. Every
+ *  checksum type then uses the shared bytes per cycle.
+ */
+#define CS_UPDATE_BUDGET_ERR_EID 167
+
+/**
+ * \brief CS Set Scheduler Mode Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_SCHEDULER_MODE_CC command has been
+ *  accepted
+ */
+#define CS_SET_SCHEDULER_MODE_INF_EID 168
+
+/**
+ * \brief CS Set Scheduler Mode Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_SCHEDULER_MODE_CC command requests a
+ *  mode that does not exist
+ */
+#define CS_SET_SCHEDULER_MODE_ERR_EID 169
+
+/**
+ * \brief CS Set Pacing Period Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_PACING_PERIOD_CC command has been
+ *  accepted
+ */
+#define CS_SET_PACING_PERIOD_INF_EID 170
+
+/**
+ * \brief CS Set Pacing Period Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_PACING_PERIOD_CC command requests a
+ *  period greater than #CS_MAX_PACING_PERIOD
+ */
+#define CS_SET_PACING_PERIOD_ERR_EID 171
+
+/**
+ * \brief CS Set Idle Bytes Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_IDLE_BYTES_CC command has been
+ *  accepted
+ */
+#define CS_SET_IDLE_BYTES_INF_EID 172
+
+/**
+ * \brief CS Set Idle Bytes Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a #CS_SET_IDLE_BYTES_CC command requests a
+ *  budget greater than #CS_MAX_IDLE_BYTES_PER_WAKEUP
+ */
+#define CS_SET_IDLE_BYTES_ERR_EID 173
+
+/**
+ * \brief CS Child Task Request Queued Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a recompute baseline or one shot command
+ *  arrives while the child task is in use, and is queued to start once the
+ *  commands ahead of it have finished
+ */
+#define CS_REQUEST_QUEUED_DBG_EID 174
+
+/**
+ * \brief CS Recompute Worker Mutex Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when OS_MutSemCreate fails for the mutex
+ *  guarding the recompute workers
+ */
+#define CS_INIT_WORKER_MUTEX_ERR_EID 175
+
+/**
+ * \brief CS Recompute Failed Entry In Use Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a recompute baseline command
+ *  has been received and the recompute failed because another
+ *  recompute worker is already recomputing the same entry.
+ */
+#define CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID 176
+
+/**
+ * \brief CS Worker Task Queue Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when OS_QueueCreate fails for the queue
+ *  of a recompute worker task, one of its sub-range tasks or the one shot
+ *  child task
+ */
+#define CS_INIT_WORKER_QUEUE_ERR_EID 177
+
+/**
+ * \brief CS Worker Task Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFE_ES_CreateChildTask fails for a
+ *  recompute worker task, one of its sub-range tasks or the one shot child
+ *  task at startup. CS still starts without a sub-range task, and its
+ *  worker checksums that sub-range itself.
+ */
+#define CS_INIT_WORKER_TASK_ERR_EID 178
+
+/**
+ * \brief CS Byte Budget Table Validate Failed Illegal Budget Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message occurs when the byte budget table has a budget greater
+ *  than #CS_MAX_BUDGET_BYTES_PER_CYCLE
+ */
+#define CS_VAL_BUDGET_ERR_EID 179
+
+/**
+ * \brief CS Byte Budget Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message when CS completes validation of the byte budget table.  This message
+ *  reports the number of good budgets and the number of budgets that are too large.
+ */
+#define CS_VAL_BUDGET_INF_EID 180
 
 /**@}*/
 
@@ -37,11 +37,15 @@
  *
  *  \par  Description:
  *        This parameter is the algorithm used by CS to checksum
- *        the requested data.
+ *        the requested data. Definition table entries whose Algorithm
+ *        field is #CS_ALGORITHM_DEFAULT use it, as do the OS and cFE
+ *        core code segments and one shot checksums.
  *
  *  \par Limits:
- *         This parameter is limited to either #CFE_MISSION_ES_DEFAULT_CRC,
- *         or  #CFE_ES_CrcType_CRC_16
+ *         This parameter is limited to #CFE_MISSION_ES_DEFAULT_CRC,
+ *         #CFE_ES_CrcType_CRC_16, #CFE_ES_CrcType_CRC_32 or
+ *         #CS_ALGORITHM_CRC_32C. The 64 bit algorithms can only be
+ *         selected by definition table entries.
  */
 #define CS_DEFAULT_ALGORITHM CFE_MISSION_ES_DEFAULT_CRC
 
@@ -26,6 +26,7 @@
 #define CS_MSG_H
 
 #include <cfe.h>
+#include "cs_msgdefs.h"
 
 /**
  * \defgroup cfscstlm CFS Checksum Telemetry
@@ -48,7 +49,9 @@ typedef struct
     uint8   CfeCoreCSState;              /**< \brief cFE Core code segment checksum stat e*/
     uint8   RecomputeInProgress;         /**< \brief CS "Recompute In Progress" flag */
     uint8   OneShotInProgress;           /**< \brief CS "OneShot In Progress" flag */
-    uint8   Filler8;                     /**< \brief 8 bit padding */
+    uint8   CrcKernel;                   /**< \brief Kernel computing #CS_DEFAULT_ALGORITHM, see #CS_CALIBRATE_CRC_CC */
+    uint8   SchedulerMode;               /**< \brief Background scheduler mode, see #CS_SET_SCHEDULER_MODE_CC */
+    uint8   RecomputeWorkersBusy;        /**< \brief Number of recompute workers holding an entry */
     uint16  EepromCSErrCounter;          /**< \brief EEPROM miscompare counter */
     uint16  MemoryCSErrCounter;          /**< \brief Memory miscompare counter */
     uint16  AppCSErrCounter;             /**< \brief App miscompare counter */
@@ -65,6 +68,28 @@ typedef struct
     uint32  LastOneShotMaxBytesPerCycle; /**< \brief Max bytes per cycle for last one shot checksum command */
     uint32  LastOneShotChecksum;         /**< \brief Checksum of the last one shot checksum command */
     uint32  PassCounter;                 /**< \brief Number of times CS has passed through all of its tables */
+    uint32  CrcKernelThroughput;         /**< \brief Calibrated throughput of the CRC kernel in KB per second */
+    uint32  CycleTimeBudget;             /**< \brief Microseconds a background cycle may run, 0 for one chunk */
+    uint32  LastCycleTime;               /**< \brief Microseconds the last background cycle ran */
+    uint32  LastCycleBytes;              /**< \brief Bytes checksummed by the last background cycle */
+    uint32  CycleTimeTarget;             /**< \brief Microseconds the adaptive controller aims for, 0 when off */
+    uint32  BytesPerCycle;               /**< \brief Current number of bytes to checksum per cycle */
+    uint32  CycleOvershootCount;         /**< \brief Number of background cycles that ran past the time target */
+    uint32  MaxCycleOvershoot;           /**< \brief Largest number of microseconds a cycle ran past the target */
+    uint32  DeadlineMissCount;           /**< \brief Number of entries verified later than their MaxStaleness */
+    uint32  PacingPeriod;                /**< \brief Milliseconds between self-clocked background cycles, 0 when off */
+    uint32  PacedCycleCount;             /**< \brief Number of background cycles CS has started on its own */
+    uint32  LastPacingJitter;            /**< \brief Microseconds the last self-clocked cycle started late */
+    uint32  MaxPacingJitter;             /**< \brief Largest number of microseconds a self-clocked cycle started late */
+    uint32  MissedPacedCycles;           /**< \brief Number of self-clocked cycles skipped because CS ran late */
+    uint32  IdleBytesPerWakeup;          /**< \brief Bytes checksummed when the command pipe is idle, 0 when off */
+    uint32  IdleBytesChecked;            /**< \brief Bytes checksummed while the command pipe was idle */
+    uint32  QueuedRequestCount;          /**< \brief Number of child task requests queued while it was in use */
+    uint32  DroppedRequestCount;         /**< \brief Number of child task requests rejected with the queue full */
+    uint32  BytesChecked[CS_NUM_TABLES]; /**< \brief Bytes checksummed in the background for each checksum type */
+    uint16  CurrentCategory;             /**< \brief Checksum type whose weighted or interleaved turn it is */
+    uint16  EntryCursor[CS_NUM_TABLES];  /**< \brief Next entry of each checksum type in weighted or interleaved mode */
+    uint16  RequestQueueDepth;           /**< \brief Number of child task requests waiting to start */
 } CS_HkPacket_Payload_t;
 
 /**
@@ -126,6 +151,57 @@ typedef struct
                                 value */
 } CS_OneShotCmd_Payload_t;
 
+/**
+ * \brief Payload for setting the background cycle time budget
+ */
+typedef struct
+{
+    uint32 CycleTimeBudget; /**< \brief Microseconds each background cycle may run, 0 for one chunk per cycle */
+} CS_SetCycleTimeBudgetCmd_Payload_t;
+
+/**
+ * \brief Payload for setting the adaptive background cycle time target
+ */
+typedef struct
+{
+    uint32 CycleTimeTarget; /**< \brief Microseconds each background cycle should take, 0 to turn the controller off */
+} CS_SetCycleTimeTargetCmd_Payload_t;
+
+/**
+ * \brief Payload for setting a byte budget
+ */
+typedef struct
+{
+    uint16 Budget;        /**< \brief Checksum type number, or #CS_CHILD_TASK_BUDGET */
+    uint16 Padding;       /**< \brief Structure padding */
+    uint32 BytesPerCycle; /**< \brief Bytes per cycle, 0 to use the shared bytes per cycle */
+} CS_SetBytesPerCycleCmd_Payload_t;
+
+/**
+ * \brief Payload for setting the background scheduler mode
+ */
+typedef struct
+{
+    uint16 Mode;    /**< \brief A CS_SCHEDULER_... mode */
+    uint16 Padding; /**< \brief Structure padding */
+} CS_SetSchedulerModeCmd_Payload_t;
+
+/**
+ * \brief Payload for setting the self-clocked background cycle period
+ */
+typedef struct
+{
+    uint32 PacingPeriod; /**< \brief Milliseconds between background cycles, 0 to follow the scheduler */
+} CS_SetPacingPeriodCmd_Payload_t;
+
+/**
+ * \brief Payload for setting the idle time checksumming budget
+ */
+typedef struct
+{
+    uint32 IdleBytes; /**< \brief Bytes to checksum on each idle wakeup, 0 to turn off */
+} CS_SetIdleBytesCmd_Payload_t;
+
 /**
  * \brief No arguments command data type
  *
@@ -198,6 +274,72 @@ typedef struct
     CS_OneShotCmd_Payload_t Payload;
 } CS_OneShotCmd_t;
 
+/**
+ * \brief Command type for setting the background cycle time budget
+ *
+ *  For command details see #CS_SET_CYCLE_TIME_BUDGET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t            CmdHeader;
+    CS_SetCycleTimeBudgetCmd_Payload_t Payload;
+} CS_SetCycleTimeBudgetCmd_t;
+
+/**
+ * \brief Command type for setting the adaptive background cycle time target
+ *
+ *  For command details see #CS_SET_CYCLE_TIME_TARGET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t            CmdHeader;
+    CS_SetCycleTimeTargetCmd_Payload_t Payload;
+} CS_SetCycleTimeTargetCmd_t;
+
+/**
+ * \brief Command type for setting a byte budget
+ *
+ *  For command details see #CS_SET_BYTES_PER_CYCLE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CmdHeader;
+    CS_SetBytesPerCycleCmd_Payload_t Payload;
+} CS_SetBytesPerCycleCmd_t;
+
+/**
+ * \brief Command type for setting the background scheduler mode
+ *
+ *  For command details see #CS_SET_SCHEDULER_MODE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CmdHeader;
+    CS_SetSchedulerModeCmd_Payload_t Payload;
+} CS_SetSchedulerModeCmd_t;
+
+/**
+ * \brief Command type for setting the self-clocked background cycle period
+ *
+ *  For command details see #CS_SET_PACING_PERIOD_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t         CmdHeader;
+    CS_SetPacingPeriodCmd_Payload_t Payload;
+} CS_SetPacingPeriodCmd_t;
+
+/**
+ * \brief Command type for setting the idle time checksumming budget
+ *
+ *  For command details see #CS_SET_IDLE_BYTES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t      CmdHeader;
+    CS_SetIdleBytesCmd_Payload_t Payload;
+} CS_SetIdleBytesCmd_t;
+
 /**\}*/
 
 #endif
@@ -101,8 +101,8 @@
  *  \par Description
  *         Computes a checksum on the command specified address
  *         and size of memory at the command specified rate.
- *         This command spawns a child task to complete the
- *         checksum.
+ *         This command hands the checksum to the one shot
+ *         child task, which is created at startup.
  *
  *  \par Command Structure
  *       #CS_OneShotCmd_t
@@ -116,22 +116,27 @@
  *       - The CS_ONESHOT_FINISHED_INF_EID informational message will
  *         be generated when the compuation finishes.
  *       - #CS_HkPacket_Payload_t.LastOneShotChecksum will be updated to the new value
+ *       - While a recompute or one shot is running the command is queued,
+ *         and the #CS_REQUEST_QUEUED_DBG_EID debug event message is
+ *         generated. The telemetry above follows once the queued command
+ *         starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The address and size cannot be validated
  *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created
+ *         already running and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for it. A one shot only runs while no
+ *         recompute is running.
+ *       - The one shot could not be put on the child task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_ONESHOT_MEMVALIDATE_ERR_EID
  *       - Error specific event message #CS_ONESHOT_CHDTASK_ERR_EID
- *       - Error specific event message #CS_ONESHOT_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_ONESHOT_POST_WORK_ERR_EID
  *
  *  \par Criticality
  *       None
@@ -165,14 +170,13 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
- *       - A one shot calculation is not in progress
- *       - The child task could not be deleted
+ *       - A one shot calculation is not in progress, or it has
+ *         already been cancelled and has not stopped yet
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID
- *       - Error specific event message #CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID
  *
  *  \par Criticality
  *       None
@@ -358,19 +362,27 @@
  *       - #CS_HkPacket_Payload_t.CmdCounter will increment
  *       - The #CS_RECOMPUTE_CFECORE_STARTED_DBG_EID debug event message will be
  *         generated when the command is received
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_CFECORE_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -497,19 +509,27 @@
  *       - #CS_HkPacket_Payload_t.CmdCounter will increment
  *       - The #CS_RECOMPUTE_OS_STARTED_DBG_EID debug event message will be
  *         generated when the command is received
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_OS_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_OS_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -628,7 +648,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the EEPROM
  *       table entry and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command hands the recompute to an idle recompute worker task.
  *
  *  \par Command Structure
  *       #CS_EntryCmd_t
@@ -641,21 +661,29 @@
  *         message will be generated when the command is received
  *       - The #CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID informational event
  *         message will be generated when the recompute is finished
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified Entry ID is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_INVALID_ENTRY_EEPROM_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_EEPROM_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -872,7 +900,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the Memory
  *       table entry and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command hands the recompute to an idle recompute worker task.
  *
  *  \par Command Structure
  *       #CS_EntryCmd_t
@@ -885,21 +913,29 @@
  *         message will be generated when the command is received
  *       - The #CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID informational event
  *         message will be generated when the recompute is finished
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified Entry ID is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_INVALID_ENTRY_MEMORY_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_MEMORY_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_MEMORY_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_MEMORY_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1117,7 +1153,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the
  *       table and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command hands the recompute to an idle recompute worker task.
  *
  *  \par Command Structure
  *       #CS_TableNameCmd_t
@@ -1136,21 +1172,29 @@
  *         entry for itself modifies the contents of the table being
  *         recomputed. Thus, recomputing the CS Tables Definition Table
  *         checksum is not recommended.
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified table name is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_UNKNOWN_NAME_TABLES_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_TABLES_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1335,7 +1379,7 @@
  *  \par Description
  *       Recompute the baseline checksum of the
  *       app and use that value as the new baseline.
- *       This command spawns a child task to do the recompute.
+ *       This command hands the recompute to an idle recompute worker task.
  *
  *  \par Command Structure
  *       #CS_AppNameCmd_t
@@ -1348,21 +1392,29 @@
  *         message will be generated when the command is received
  *       - The #CS_RECOMPUTE_FINISH_APP_INF_EID informational event
  *         message will be generated when the recompute is finished
+ *       - While all #CS_MAX_RECOMPUTE_WORKERS recompute workers are in
+ *         use or a one shot is running the command is queued, and the
+ *         #CS_REQUEST_QUEUED_DBG_EID debug event message is generated. The
+ *         telemetry above follows once the queued command starts.
  *
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
  *       - The command specified app name is invalid
- *       - A child task (recompute baseline or one shot ) is
- *         already running, precluding starting another. Only one child
- *         task is allowed to run at any given time.
- *       - The child task failed to be created by Executive Services (ES)
+ *       - All recompute workers or the one shot child task are
+ *         already in use and #CS_MAX_QUEUED_REQUESTS commands are
+ *         already waiting for them. Up to #CS_MAX_RECOMPUTE_WORKERS
+ *         recomputes may run at the same time, but never alongside a
+ *         one shot.
+ *       - The entry is already being recomputed by another worker
+ *         (#CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID)
+ *       - The recompute could not be put on the worker task's queue
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
  *       - Error specific event message #CS_LEN_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_UNKNOWN_NAME_APP_ERR_EID
- *       - Error specific event message #CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID
+ *       - Error specific event message #CS_RECOMPUTE_APP_POST_WORK_ERR_EID
  *       - Error specific event message #CS_RECOMPUTE_APP_CHDTASK_ERR_EID
  *
  *  \par Criticality
@@ -1443,6 +1495,283 @@
  */
 #define CS_DISABLE_NAME_APP_CC 39
 
+/**
+ * \brief Calibrate the CRC kernels
+ *
+ *  \par Description
+ *       Times each kernel that can compute #CS_DEFAULT_ALGORITHM on a
+ *       scratch buffer and selects the fastest one whose result matches
+ *       the table-driven kernel exactly. The same calibration is run
+ *       once at startup; this command re-runs it, for example after
+ *       the processor clock has changed.
+ *
+ *  \par Command Structure
+ *       #CS_NoArgsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.CrcKernel will show the selected kernel
+ *       - #CS_HkPacket_Payload_t.CrcKernelThroughput will show its measured throughput
+ *       - The #CS_CALIBRATE_CRC_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       The command pipe is busy for as long as the calibration runs,
+ *       see #CS_CRC_CALIBRATION_BYTES and #CS_CRC_CALIBRATION_PASSES.
+ */
+#define CS_CALIBRATE_CRC_CC 40
+
+/**
+ * \brief Set the background cycle time budget
+ *
+ *  \par Description
+ *       Sets the number of microseconds each background cycle may spend
+ *       checksumming. With a nonzero budget a cycle keeps checksumming
+ *       chunks of up to the configured bytes per cycle until the budget
+ *       has been used. A budget of zero returns to checksumming a single
+ *       chunk per cycle.
+ *
+ *  \par Command Structure
+ *       #CS_SetCycleTimeBudgetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.CycleTimeBudget will show the new budget
+ *       - The #CS_SET_CYCLE_TIME_BUDGET_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Budget greater than #CS_MAX_CYCLE_TIME_BUDGET
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_CYCLE_TIME_BUDGET_ERR_EID
+ *
+ *  \par Criticality
+ *       A large budget takes CPU time from lower priority tasks on every
+ *       background cycle.
+ */
+#define CS_SET_CYCLE_TIME_BUDGET_CC 41
+
+/**
+ * \brief Set the adaptive background cycle time target
+ *
+ *  \par Description
+ *       Sets the number of microseconds each background cycle should
+ *       take. With a nonzero target the bytes checksummed per cycle are
+ *       adjusted after every cycle to hold the target as the system
+ *       load changes. A target of zero turns the controller off and
+ *       returns to #CS_DEFAULT_BYTES_PER_CYCLE. The overshoot statistics
+ *       are cleared either way.
+ *
+ *  \par Command Structure
+ *       #CS_SetCycleTimeTargetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.CycleTimeTarget will show the new target
+ *       - The #CS_SET_CYCLE_TIME_TARGET_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Target greater than #CS_MAX_CYCLE_TIME_BUDGET
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_CYCLE_TIME_TARGET_ERR_EID
+ *
+ *  \par Criticality
+ *       The controller does not run while a cycle time budget is set with
+ *       #CS_SET_CYCLE_TIME_BUDGET_CC.
+ */
+#define CS_SET_CYCLE_TIME_TARGET_CC 42
+
+/**
+ * \brief Set a byte budget
+ *
+ *  \par Description
+ *       Sets the number of bytes one checksum type may checksum in a
+ *       background cycle, or the number of bytes recompute and one shot
+ *       child tasks checksum between delays, in the byte budget table.
+ *       A budget of zero uses the shared bytes per cycle.
+ *
+ *  \par Command Structure
+ *       #CS_SetBytesPerCycleCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - The #CS_SET_BYTES_PER_CYCLE_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Budget number not less than #CS_NUM_BUDGETS
+ *       - Bytes per cycle greater than #CS_MAX_BUDGET_BYTES_PER_CYCLE
+ *       - Byte budget table not loaded
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_BYTES_PER_CYCLE_ERR_EID
+ *
+ *  \par Criticality
+ *       The change is made to the loaded table, so it is lost when a new
+ *       table is loaded. A checksum type that has used its budget ends the
+ *       background cycle, so a small budget slows that type down.
+ */
+#define CS_SET_BYTES_PER_CYCLE_CC 43
+
+/**
+ * \brief Set the background scheduler mode
+ *
+ *  \par Description
+ *       Selects how the background cycle picks the next entry to
+ *       checksum. In #CS_SCHEDULER_SEQUENTIAL mode every table is swept
+ *       in order. In #CS_SCHEDULER_DEADLINE mode the entry that is most
+ *       overdue for verification is checksummed first, and the ordered
+ *       sweep continues once no entry is overdue. An entry is overdue
+ *       once the time since it was last verified exceeds the MaxStaleness
+ *       set in its definition table. In #CS_SCHEDULER_WEIGHTED mode the
+ *       bytes of each cycle are shared between the checksum types in
+ *       proportion to their weights in the byte budget table, with each
+ *       type sweeping its own table in order. In
+ *       #CS_SCHEDULER_INTERLEAVED mode each checksum type in turn gets
+ *       one chunk of an equal share of the bytes per cycle, so no entry
+ *       waits on a whole pass of the other tables. The weighted and
+ *       interleaved modes keep their own place in each table, see
+ *       #CS_HkPacket_Payload_t.CurrentCategory and
+ *       #CS_HkPacket_Payload_t.EntryCursor.
+ *
+ *  \par Command Structure
+ *       #CS_SetSchedulerModeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.SchedulerMode will show the new mode
+ *       - The #CS_SET_SCHEDULER_MODE_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Mode is not #CS_SCHEDULER_SEQUENTIAL, #CS_SCHEDULER_DEADLINE,
+ *         #CS_SCHEDULER_WEIGHTED or #CS_SCHEDULER_INTERLEAVED
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_SCHEDULER_MODE_ERR_EID
+ *
+ *  \par Criticality
+ *       Entries with a short MaxStaleness can hold back the ordered sweep,
+ *       and the cFE core and OS code segments are only checksummed by it.
+ *       A checksum type with weight zero is not checksummed in weighted mode.
+ */
+#define CS_SET_SCHEDULER_MODE_CC 44
+
+/**
+ * \brief Set the self-clocked background cycle period
+ *
+ *  \par Description
+ *       Sets the number of milliseconds between background cycles that
+ *       CS starts on its own. With a nonzero period CS times its
+ *       background cycles from its command pipe receive loop and ignores
+ *       the background cycle message, so the verification rate no longer
+ *       depends on the scheduler. A period of zero returns to background
+ *       cycles driven by the scheduler. The first paced cycle runs at
+ *       once, and the jitter statistics are cleared either way.
+ *
+ *  \par Command Structure
+ *       #CS_SetPacingPeriodCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.PacingPeriod will show the new period
+ *       - The #CS_SET_PACING_PERIOD_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Period greater than #CS_MAX_PACING_PERIOD
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_PACING_PERIOD_ERR_EID
+ *
+ *  \par Criticality
+ *       Paced cycles run in the CS main task, so commands and other
+ *       messages wait while one runs. A cycle that starts more than a
+ *       period late skips the missed cycles rather than running them
+ *       back to back.
+ */
+#define CS_SET_PACING_PERIOD_CC 45
+
+/**
+ * \brief Set the idle time checksumming budget
+ *
+ *  \par Description
+ *       Sets the number of bytes CS checksums each time its command
+ *       pipe receive times out with nothing to do. Idle bytes continue
+ *       the sequential sweep, whatever the scheduler mode, and come on
+ *       top of the bytes of the scheduled background cycles. A budget
+ *       of zero stops idle time checksumming.
+ *
+ *  \par Command Structure
+ *       #CS_SetIdleBytesCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdCounter will increment
+ *       - #CS_HkPacket_Payload_t.IdleBytesPerWakeup will show the new budget
+ *       - The #CS_SET_IDLE_BYTES_INF_EID informational event message will be
+ *         generated when the command is received
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Budget greater than #CS_MAX_IDLE_BYTES_PER_WAKEUP
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #CS_HkPacket_Payload_t.CmdErrCounter will increment
+ *       - Error specific event message #CS_LEN_ERR_EID
+ *       - Error specific event message #CS_SET_IDLE_BYTES_ERR_EID
+ *
+ *  \par Criticality
+ *       Idle bytes are checksummed in the CS main task, so a command that
+ *       arrives just after a timeout waits for them.
+ */
+#define CS_SET_IDLE_BYTES_CC 46
+
 /**\}*/
 
 /**
@@ -1458,6 +1787,26 @@
 #define CS_NUM_TABLES   6 /**< \brief Number of checksum types*/
 /**\}*/
 
+/**
+ * \name CS Byte Budget Numbers
+ *
+ * Budgets 0 to #CS_NUM_TABLES - 1 are the checksum type numbers above
+ * \{
+ */
+#define CS_CHILD_TASK_BUDGET 6 /**< \brief Recompute and one shot budget */
+#define CS_NUM_BUDGETS       7 /**< \brief Number of byte budgets */
+/**\}*/
+
+/**
+ * \name CS Scheduler Modes
+ * \{
+ */
+#define CS_SCHEDULER_SEQUENTIAL  0 /**< \brief Sweep the tables in order */
+#define CS_SCHEDULER_DEADLINE    1 /**< \brief Checksum the most overdue entry first */
+#define CS_SCHEDULER_WEIGHTED    2 /**< \brief Share each cycle between checksum types by weight */
+#define CS_SCHEDULER_INTERLEAVED 3 /**< \brief Take one chunk from each checksum type in turn */
+/**\}*/
+
 /**
  * \name CS Checkum States
  * \{
@@ -1468,6 +1817,28 @@
 #define CS_STATE_UNDEFINED 0x03 /**< \brief Entry not found state undefined */
 /**\}*/
 
+/**
+ * \name CS Checksum Algorithms
+ *
+ * Algorithms computed by CS in addition to the #CFE_ES_CrcType_Enum_t
+ * values defined by cFE
+ * \{
+ */
+#define CS_ALGORITHM_DEFAULT     0 /**< \brief The mission default, #CS_DEFAULT_ALGORITHM */
+#define CS_ALGORITHM_CRC_32C     4 /**< \brief CRC-32C (Castagnoli) */
+#define CS_ALGORITHM_XXHASH_64   5 /**< \brief 64 bit xxHash (XXH64), seed 0 */
+#define CS_ALGORITHM_FLETCHER_64 6 /**< \brief 64 bit Fletcher over little endian 32 bit words */
+/**\}*/
+
+/**
+ * \name CS CRC Kernels
+ * \{
+ */
+#define CS_CRC_KERNEL_TABLE    0 /**< \brief Table-driven kernel */
+#define CS_CRC_KERNEL_HARDWARE 1 /**< \brief Processor CRC or carry-less multiply instructions */
+#define CS_CRC_KERNEL_CFE      2 /**< \brief #CFE_ES_CalculateCRC */
+/**\}*/
+
 #ifndef CS_OMIT_DEPRECATED
 #define CS_ONESHOT_CC                    CS_ONE_SHOT_CC
 #define CS_CANCEL_ONESHOT_CC             CS_CANCEL_ONE_SHOT_CC
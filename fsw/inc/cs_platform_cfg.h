@@ -84,6 +84,20 @@
  */
 #define CS_DEF_APP_TABLE_FILENAME "/cf/cs_apptbl.tbl"
 
+/**
+ * \brief Byte budget table filename
+ *
+ *  \par  Description:
+ *        Name of the table file holding the byte budget for each checksum
+ *        type and for recompute and one shot child tasks. When the file
+ *        cannot be loaded every budget uses the shared bytes per cycle.
+ *
+ *  \par Limits:
+ *       The length of this string, including the NULL terminator cannot exceed
+ *       the #OS_MAX_PATH_LEN value.
+ */
+#define CS_DEF_BUDGET_TABLE_FILENAME "/cf/cs_budgettbl.tbl"
+
 /**
  *  \brief Application Pipe Depth
  *
@@ -153,7 +167,10 @@
  * \brief Default number of bytes to checksum per cycle
  *
  *  \par  Description:
- *        The default number of bytes that are checksummed in a single CS cycle
+ *        The default number of bytes that are checksummed in a single CS cycle.
+ *        Bytes left over when an entry is finished are used on the entries
+ *        and tables that follow it, so many small entries can be checksummed
+ *        in one cycle.
  *
  *  \par Limits:
  *       This parameter is limited by the maximum value allowed by the data type.
@@ -163,6 +180,271 @@
  */
 #define CS_DEFAULT_BYTES_PER_CYCLE (1024 * 16)
 
+/**
+ * \brief Default time budget for a background cycle
+ *
+ *  \par  Description:
+ *        The number of microseconds a single background cycle may spend
+ *        checksumming. When nonzero, each cycle keeps checksumming chunks
+ *        of up to #CS_DEFAULT_BYTES_PER_CYCLE bytes until the budget has
+ *        been used, so fast memory gets more bytes verified per cycle
+ *        than slow memory. When zero, each cycle checksums a single chunk.
+ *        The budget can be changed with #CS_SET_CYCLE_TIME_BUDGET_CC.
+ *
+ *  \par Limits:
+ *       This parameter cannot be greater than #CS_MAX_CYCLE_TIME_BUDGET.
+ *       A cycle may overrun its budget by the time taken by one chunk.
+ */
+#define CS_DEFAULT_CYCLE_TIME_BUDGET 0
+
+/**
+ * \brief Maximum time budget for a background cycle
+ *
+ *  \par  Description:
+ *        The largest number of microseconds that can be commanded as the
+ *        background cycle time budget.
+ *
+ *  \par Limits:
+ *       This parameter should be less than the period of the background
+ *       cycle message, so that a cycle finishes before the next one is due.
+ */
+#define CS_MAX_CYCLE_TIME_BUDGET 100000
+
+/**
+ * \brief Default CPU time target for a background cycle
+ *
+ *  \par  Description:
+ *        The number of microseconds the adaptive controller aims for each
+ *        background cycle to take. When nonzero, the number of bytes
+ *        checksummed per cycle is adjusted after every cycle from the
+ *        measured throughput, so that cycles take about this long whatever
+ *        the system load. When zero, the bytes per cycle stay at
+ *        #CS_DEFAULT_BYTES_PER_CYCLE. The target can be changed with
+ *        #CS_SET_CYCLE_TIME_TARGET_CC.
+ *
+ *  \par Limits:
+ *       This parameter cannot be greater than #CS_MAX_CYCLE_TIME_BUDGET.
+ *       The controller does not run while a cycle time budget is set.
+ */
+#define CS_DEFAULT_CYCLE_TIME_TARGET 0
+
+/**
+ * \brief Smallest number of bytes per cycle the adaptive controller may set
+ *
+ *  \par  Description:
+ *        Lower limit on the bytes per cycle chosen by the adaptive
+ *        controller, so that checksumming still makes progress when the
+ *        processor is heavily loaded.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and cannot be greater than
+ *       #CS_MAX_ADAPTIVE_BYTES_PER_CYCLE.
+ */
+#define CS_MIN_ADAPTIVE_BYTES_PER_CYCLE 256
+
+/**
+ * \brief Largest number of bytes per cycle the adaptive controller may set
+ *
+ *  \par  Description:
+ *        Upper limit on the bytes per cycle chosen by the adaptive
+ *        controller. The controller at most doubles the bytes per cycle
+ *        from one cycle to the next, but cuts them at once when a cycle
+ *        overshoots its target.
+ *
+ *  \par Limits:
+ *       This parameter is limited by the maximum value allowed by the data
+ *       type, an unsigned 32-bit integer.
+ */
+#define CS_MAX_ADAPTIVE_BYTES_PER_CYCLE (1024 * 1024)
+
+/**
+ * \brief Largest byte budget in the byte budget table
+ *
+ *  \par  Description:
+ *        Upper limit on each byte budget, whether set by a byte budget
+ *        table load or by #CS_SET_BYTES_PER_CYCLE_CC.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and is limited by the maximum
+ *       value allowed by the data type, an unsigned 32-bit integer.
+ */
+#define CS_MAX_BUDGET_BYTES_PER_CYCLE (1024 * 1024)
+
+/**
+ * \brief Default background scheduler mode
+ *
+ *  \par  Description:
+ *        How the background cycle picks the next entry to checksum at
+ *        startup. #CS_SCHEDULER_SEQUENTIAL sweeps every table in order.
+ *        #CS_SCHEDULER_DEADLINE checksums the entry that is most overdue
+ *        for verification first, going by the MaxStaleness of each
+ *        definition table entry. #CS_SCHEDULER_WEIGHTED shares each
+ *        cycle between the checksum types by the weights in the byte
+ *        budget table. #CS_SCHEDULER_INTERLEAVED takes one chunk from
+ *        each checksum type in turn. The mode can be changed with
+ *        #CS_SET_SCHEDULER_MODE_CC.
+ *
+ *  \par Limits:
+ *       This parameter is limited to #CS_SCHEDULER_SEQUENTIAL,
+ *       #CS_SCHEDULER_DEADLINE, #CS_SCHEDULER_WEIGHTED or
+ *       #CS_SCHEDULER_INTERLEAVED.
+ */
+#define CS_DEFAULT_SCHEDULER_MODE CS_SCHEDULER_SEQUENTIAL
+
+/**
+ * \brief Default period of self-clocked background cycles
+ *
+ *  \par  Description:
+ *        The number of milliseconds between background cycles that CS
+ *        starts on its own, timed from its command pipe receive loop.
+ *        While nonzero, the background cycle message from the scheduler
+ *        is ignored, so verification carries on if the scheduler stops
+ *        sending it. When zero, background cycles follow the background
+ *        cycle message. The period can be changed with
+ *        #CS_SET_PACING_PERIOD_CC.
+ *
+ *  \par Limits:
+ *       This parameter cannot be greater than #CS_MAX_PACING_PERIOD.
+ */
+#define CS_DEFAULT_PACING_PERIOD 0
+
+/**
+ * \brief Maximum period of self-clocked background cycles
+ *
+ *  \par  Description:
+ *        The largest number of milliseconds that can be commanded as the
+ *        period of self-clocked background cycles.
+ *
+ *  \par Limits:
+ *       This parameter is limited by the maximum value allowed by the data
+ *       type, an unsigned 32-bit integer.
+ */
+#define CS_MAX_PACING_PERIOD 60000
+
+/**
+ * \brief Default idle time checksumming budget
+ *
+ *  \par  Description:
+ *        The number of bytes CS checksums each time its command pipe
+ *        receive times out with nothing to do, on top of the bytes of
+ *        the scheduled background cycles. A full pass then finishes
+ *        sooner on a lightly loaded system, while the budget of the
+ *        scheduled cycles stays the same. When zero, idle time is not
+ *        used. The budget can be changed with #CS_SET_IDLE_BYTES_CC.
+ *
+ *  \par Limits:
+ *       This parameter cannot be greater than #CS_MAX_IDLE_BYTES_PER_WAKEUP.
+ */
+#define CS_DEFAULT_IDLE_BYTES_PER_WAKEUP 0
+
+/**
+ * \brief Maximum idle time checksumming budget
+ *
+ *  \par  Description:
+ *        The largest number of bytes that can be commanded as the idle
+ *        time checksumming budget. Commands wait while idle bytes are
+ *        checksummed, so this bounds how late a command that arrives
+ *        just after a timeout can be.
+ *
+ *  \par Limits:
+ *       This parameter is limited by the maximum value allowed by the data
+ *       type, an unsigned 32-bit integer.
+ */
+#define CS_MAX_IDLE_BYTES_PER_WAKEUP (1024 * 1024)
+
+/**
+ * \brief Use processor CRC instructions when available
+ *
+ *  \par Description:
+ *       When true, CS checks at startup whether the processor provides
+ *       CRC instructions (SSE4.2 on x86, the CRC extension on ARMv8) and
+ *       uses them for the algorithms they implement. Otherwise, or when
+ *       the instructions are not present, the portable table-driven
+ *       kernel is used. Both produce identical checksums.
+ *
+ *  \par Limits:
+ *       This can either be true or false
+ */
+#define CS_CRC_USE_HW_INSTRUCTIONS true
+
+/**
+ * \brief Minimum chunk size for the CRC-32 folding kernel
+ *
+ *  \par Description:
+ *       On processors with carry-less multiply instructions (PCLMULQDQ),
+ *       CRC-32 chunks of at least this many bytes are computed by
+ *       folding 64 bytes per step instead of with the table-driven
+ *       kernel. Smaller chunks do not repay the folding setup cost.
+ *       Only used when #CS_CRC_USE_HW_INSTRUCTIONS is true.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 64.
+ */
+#define CS_CRC_FOLD_MIN_BYTES 256
+
+/**
+ * \brief Minimum chunk size for the interleaved CRC kernels
+ *
+ *  \par Description:
+ *       Chunks of at least this many bytes that are not folded are
+ *       split into four equal sub-blocks, which are checksummed side by
+ *       side so that each step does not wait on the one before it. The
+ *       four CRCs are then combined into the CRC of the whole chunk, so
+ *       the result is identical to checksumming the chunk in one pass.
+ *       Smaller chunks do not repay the cost of combining.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 32.
+ */
+#define CS_CRC_INTERLEAVE_MIN_BYTES 1024
+
+/**
+ * \brief Size of the CRC kernel calibration buffer
+ *
+ *  \par Description:
+ *       At startup, and on command, CS times each kernel that can
+ *       compute #CS_DEFAULT_ALGORITHM over a scratch buffer of this many
+ *       bytes and selects the fastest. A size close to
+ *       #CS_DEFAULT_BYTES_PER_CYCLE times the kernels on the chunk
+ *       sizes they will see in the background cycle.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1. The buffer is statically
+ *       allocated.
+ */
+#define CS_CRC_CALIBRATION_BYTES 4096
+
+/**
+ * \brief Number of passes over the calibration buffer per kernel
+ *
+ *  \par Description:
+ *       Each kernel is timed over this many passes of the
+ *       #CS_CRC_CALIBRATION_BYTES buffer. More passes give a more
+ *       repeatable result, but keep CS busy for longer.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.
+ */
+#define CS_CRC_CALIBRATION_PASSES 16
+
+/**
+ * \brief Number of sub-ranges in an EEPROM or Memory results entry
+ *
+ *  \par Description:
+ *       Each EEPROM, Memory, OS and cFE core results entry is divided
+ *       into this many equal sub-ranges whose checksums are kept
+ *       separately and combined into the checksum of the whole entry.
+ *       Sub-ranges may be checksummed in any order or in parallel, and
+ *       a single sub-range may be re-checksummed on its own. A split
+ *       recompute, see #CS_SPLIT_RECOMPUTE_MIN_BYTES, runs one child
+ *       task per sub-range. Each recompute worker has its own sub-range
+ *       tasks, created at startup, when this is more than 1.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 32.
+ */
+#define CS_NUM_SUB_RANGES 4
+
 /**
  * \brief CS Child Task Priority
  *
@@ -175,6 +457,55 @@
  */
 #define CS_CHILD_TASK_PRIORITY 200
 
+/**
+ * \brief Number of recompute workers
+ *
+ *  \par  Description:
+ *        Recompute baseline commands for different entries run in
+ *        parallel, each in its own child task, up to this many at a
+ *        time. Each worker holds the entry it is recomputing so no
+ *        other worker can start on the same entry. Missions on single
+ *        core targets may set this to 1 to recompute one entry at a time.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 8.
+ */
+#define CS_MAX_RECOMPUTE_WORKERS 2
+
+/**
+ * \brief Minimum size of a split recompute
+ *
+ *  \par  Description:
+ *        Recomputing the baseline of the OS or cFE core code segment,
+ *        or of a Memory entry, of at least this many bytes splits the
+ *        entry into #CS_NUM_SUB_RANGES sub-ranges, each checksummed by
+ *        its own child task, and merges their checksums into the same
+ *        baseline the sequential recompute gives. The sub-range tasks
+ *        share the #CS_CHILD_TASK_BUDGET bytes per delay of a single
+ *        recompute task, so splitting never raises the total bandwidth
+ *        used, and finishes sooner when the sub-range tasks run on
+ *        separate cores. Entries using a 64 bit algorithm are never
+ *        split.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 0xFFFFFFFF.
+ */
+#define CS_SPLIT_RECOMPUTE_MIN_BYTES 0x100000
+
+/**
+ * \brief Maximum number of queued child task requests
+ *
+ *  \par  Description:
+ *        Recompute baseline and one shot commands that arrive while the
+ *        child task is in use wait in a queue of this many commands, and
+ *        are started in the order they arrived. Commands that arrive
+ *        while the queue is full are rejected.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 65535.
+ */
+#define CS_MAX_QUEUED_REQUESTS 16
+
 /**
  * \brief Delay between checksumming cycles for child task
  *
@@ -30,6 +30,8 @@
  **
  **************************************************************************/
 #include <cfe.h>
+#include "cs_msgdefs.h"
+#include "cs_platform_cfg.h"
 
 /**************************************************************************
  **
@@ -45,6 +47,7 @@
 #define CS_DEF_MEMORY_TABLE_NAME "DefMemoryTbl"
 #define CS_DEF_TABLES_TABLE_NAME "DefTablesTbl"
 #define CS_DEF_APP_TABLE_NAME    "DefAppTbl"
+#define CS_DEF_BUDGET_TABLE_NAME "DefBudgetTbl"
 /**\}*/
 
 /**
@@ -57,12 +60,31 @@
 #define CS_RESULTS_APP_TABLE_NAME    "ResAppTbl"
 /**\}*/
 
+/**
+ * \brief Number of 64 bit accumulators in an unfinished 64 bit checksum
+ */
+#define CS_HASH_LANES 4
+
+/**
+ * \brief Number of bytes the 64 bit checksum accumulators consume at a time
+ */
+#define CS_HASH_STRIPE_BYTES (CS_HASH_LANES * 8)
+
 /**************************************************************************
  **
  ** Type definitions
  **
  **************************************************************************/
 
+/**
+ * \brief Unfinished state of a 64 bit checksum algorithm
+ */
+typedef struct
+{
+    uint64 Lane[CS_HASH_LANES];           /**< \brief The accumulators */
+    uint8  Pending[CS_HASH_STRIPE_BYTES]; /**< \brief Bytes not yet consumed by the accumulators */
+} CS_Hash_State_t;
+
 /**
  * \brief Data structure for the EEPROM or Memory definition table
  */
@@ -70,8 +92,9 @@ typedef struct
 {
     cpuaddr StartAddress;       /**< \brief The Start address to Checksum */
     uint16  State;              /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  Filler16;           /** <\brief Padding */
+    uint16  Algorithm;          /**< \brief CS_ALGORITHM_... checksum algorithm to use */
     uint32  NumBytesToChecksum; /**< \brief The number of Bytes to Checksum */
+    uint32  MaxStaleness;       /**< \brief Most seconds between verifications, 0 for no limit */
 } CS_Def_EepromMemory_Table_Entry_t;
 
 /**
@@ -79,14 +102,21 @@ typedef struct
  */
 typedef struct
 {
-    cpuaddr StartAddress;       /**< \brief The Start address to Checksum */
-    uint16  State;              /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  ComputedYet;        /**< \brief Have we computed an Integrity value yet */
-    uint32  NumBytesToChecksum; /**< \brief The number of Bytes to Checksum */
-    uint32  ComparisonValue;    /**< \brief The Memory Integrity Value */
-    uint32  ByteOffset;         /**< \brief Where a previous unfinished calc left off */
-    uint32  TempChecksumValue;  /**< \brief The unfinished caluculation */
-    uint32  Filler32;           /**< \brief Padding */
+    cpuaddr         StartAddress;                        /**< \brief The Start address to Checksum */
+    uint16          State;                               /**< \brief Uses the CS_STATE_... defines from above */
+    uint16          ComputedYet;                         /**< \brief Have we computed an Integrity value yet */
+    uint32          NumBytesToChecksum;                  /**< \brief The number of Bytes to Checksum */
+    uint32          ComparisonValue;                     /**< \brief The Memory Integrity Value */
+    uint32          ByteOffset;                          /**< \brief Where a previous unfinished calc left off */
+    uint32          TempChecksumValue;                   /**< \brief The unfinished caluculation */
+    uint16          Algorithm;                           /**< \brief Checksum algorithm used for this entry */
+    uint16          Filler16;                            /**< \brief Padding */
+    uint32          SubRangeMask;                        /**< \brief Bit mask of the sub-ranges with a computed checksum */
+    uint32          SubRangeChecksum[CS_NUM_SUB_RANGES]; /**< \brief The checksum of each sub-range */
+    uint32          ComparisonValueHigh;                 /**< \brief Upper half of a 64 bit Memory Integrity Value */
+    CS_Hash_State_t TempHashState;                       /**< \brief The unfinished 64 bit calculation */
+    uint32          MaxStaleness;                        /**< \brief Most seconds between verifications */
+    uint32          VerifiedTime;                        /**< \brief Seconds timestamp of the last verification */
 } CS_Res_EepromMemory_Table_Entry_t;
 
 /**
@@ -95,6 +125,8 @@ typedef struct
 typedef struct
 {
     uint16 State;                           /**< \brief Uses the CS_STATE_... defines from above */
+    uint16 Algorithm;                       /**< \brief CS_ALGORITHM_... checksum algorithm to use */
+    uint32 MaxStaleness;                    /**< \brief Most seconds between verifications, 0 for no limit */
     char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
 } CS_Def_Tables_Table_Entry_t;
 
@@ -104,6 +136,8 @@ typedef struct
 typedef struct
 {
     uint16 State;                 /**< \brief Uses the CS_STATE_... defines from above */
+    uint16 Algorithm;             /**< \brief CS_ALGORITHM_... checksum algorithm to use */
+    uint32 MaxStaleness;          /**< \brief Most seconds between verifications, 0 for no limit */
     char   Name[OS_MAX_API_NAME]; /**< \brief name of the app */
 } CS_Def_App_Table_Entry_t;
 
@@ -122,7 +156,12 @@ typedef struct
     CFE_TBL_Handle_t TblHandle;                       /**< \brief handle recieved from CFE_TBL */
     bool             IsCSOwner;                       /**< \brief Is CS the original owner of this table */
     bool             Filler8;                         /**< \brief Padding */
+    uint16           Algorithm;                       /**< \brief Checksum algorithm used for this entry */
     char             Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief name of the table */
+    uint32           ComparisonValueHigh;             /**< \brief Upper half of a 64 bit Memory Integrity Value */
+    CS_Hash_State_t  TempHashState;                   /**< \brief The unfinished 64 bit calculation */
+    uint32           MaxStaleness;                    /**< \brief Most seconds between verifications */
+    uint32           VerifiedTime;                    /**< \brief Seconds timestamp of the last verification */
 } CS_Res_Tables_Table_Entry_t;
 
 /**
@@ -130,22 +169,78 @@ typedef struct
  */
 typedef struct
 {
-    cpuaddr StartAddress;          /**< \brief The Start address to Checksum */
-    uint16  State;                 /**< \brief Uses the CS_STATE_... defines from above */
-    uint16  ComputedYet;           /**< \brief Have we computed an Integrity value yet */
-    uint32  NumBytesToChecksum;    /**< \brief The number of Bytes to Checksum */
-    uint32  ComparisonValue;       /**< \brief The Memory Integrity Value */
-    uint32  ByteOffset;            /**< \brief Where a previous unfinished calc left off */
-    uint32  TempChecksumValue;     /**< \brief The unfinished caluculation */
-    char    Name[OS_MAX_API_NAME]; /**< \brief name of the app */
+    cpuaddr         StartAddress;          /**< \brief The Start address to Checksum */
+    uint16          State;                 /**< \brief Uses the CS_STATE_... defines from above */
+    uint16          ComputedYet;           /**< \brief Have we computed an Integrity value yet */
+    uint32          NumBytesToChecksum;    /**< \brief The number of Bytes to Checksum */
+    uint32          ComparisonValue;       /**< \brief The Memory Integrity Value */
+    uint32          ByteOffset;            /**< \brief Where a previous unfinished calc left off */
+    uint32          TempChecksumValue;     /**< \brief The unfinished caluculation */
+    uint16          Algorithm;             /**< \brief Checksum algorithm used for this entry */
+    uint16          Filler16;              /**< \brief Padding */
+    char            Name[OS_MAX_API_NAME]; /**< \brief name of the app */
+    uint32          ComparisonValueHigh;   /**< \brief Upper half of a 64 bit Memory Integrity Value */
+    CS_Hash_State_t TempHashState;         /**< \brief The unfinished 64 bit calculation */
+    uint32          MaxStaleness;          /**< \brief Most seconds between verifications */
+    uint32          VerifiedTime;          /**< \brief Seconds timestamp of the last verification */
 } CS_Res_App_Table_Entry_t;
 
+/**
+ * \brief Data structure for the byte budget table
+ *
+ * Indexed by checksum type number, with #CS_CHILD_TASK_BUDGET for recompute
+ * and one shot child tasks. A budget of zero uses the shared bytes per cycle.
+ * The weights set each checksum type's share of the background cycle in
+ * #CS_SCHEDULER_WEIGHTED mode. A type with weight zero is not checksummed in
+ * that mode, unless every weight is zero, which gives every type an equal share.
+ */
+typedef struct
+{
+    uint32 BytesPerCycle[CS_NUM_BUDGETS]; /**< \brief Bytes to checksum per cycle */
+    uint32 Weight[CS_NUM_TABLES];         /**< \brief Relative share of the background cycle */
+} CS_Def_Budget_Table_t;
+
 /**************************************************************************
  **
  **  Function Prototypes
  **
  **************************************************************************/
 
+/**
+ * \brief Validate the checksum algorithm of a definition table entry
+ *
+ *  \par Description
+ *       Checks that the algorithm requested by a definition table entry
+ *       is one that CS can compute.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CS_ALGORITHM_DEFAULT is always valid.
+ *
+ *  \param [in]  Algorithm     The algorithm field of the entry
+ *
+ *  \return Boolean algorithm valid response
+ *  \retval true  The algorithm can be computed
+ *  \retval false The algorithm is not supported
+ */
+bool CS_ValidateAlgorithm(uint16 Algorithm);
+
+/**
+ * \brief Get the checksum algorithm of a definition table entry
+ *
+ *  \par Description
+ *       Returns the algorithm a results table entry uses for a
+ *       definition table entry, replacing #CS_ALGORITHM_DEFAULT with
+ *       #CS_DEFAULT_ALGORITHM.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The algorithm has already been validated.
+ *
+ *  \param [in]  Algorithm     The algorithm field of the entry
+ *
+ *  \return The algorithm to compute the entry with
+ */
+uint16 CS_GetEntryAlgorithm(uint16 Algorithm);
+
 /**
  * \brief Validate EEPROM definition table
  *
@@ -218,6 +313,26 @@ CFE_Status_t CS_ValidateTablesChecksumDefinitionTable(void *TblPtr);
  */
 CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr);
 
+/**
+ * \brief Validate byte budget table
+ *
+ *  \par Description
+ *       This function is a callback to cFE Table Services that gets called
+ *       when a validation is requested.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Accepts the same budgets as #CS_SET_BYTES_PER_CYCLE_CC, so none
+ *       may be greater than #CS_MAX_BUDGET_BYTES_PER_CYCLE. Every weight
+ *       is valid.
+ *
+ *  \param [in]  TblPtr        A pointer to the table to be validated
+ *
+ *  \return Execution status see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS    \copydoc CFE_SUCCESS
+ *  \retval #CS_TABLE_ERROR \copydoc CS_TABLE_ERROR
+ */
+CFE_Status_t CS_ValidateBudgetTable(void *TblPtr);
+
 /**
  * \brief Processes a new definition table for EEPROM or Memory tables
  *
@@ -404,4 +519,53 @@ CFE_Status_t CS_HandleTableUpdate(void *DefinitionTblPtr, void *ResultsTblPtr,
                                   const CFE_TBL_Handle_t ResultsTableHandle, const uint16 Table,
                                   const uint16 NumEntries);
 
+/**
+ * \brief Initializes the byte budget table
+ *
+ *  \par Description
+ *       Registers the byte budget table with Table Services and loads it
+ *       from #CS_DEF_BUDGET_TABLE_FILENAME, or from the default table in
+ *       CS when the file cannot be loaded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The table is validated by #CS_ValidateBudgetTable. When this
+ *       fails the table pointer is NULL and every budget uses the shared
+ *       bytes per cycle.
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t CS_BudgetTableInit(void);
+
+/**
+ * \brief Handles updates to the byte budget table
+ *
+ *  \par Description
+ *       Completes the handshake with Table Services that releases
+ *       the address of the byte budget table and checks for updates
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing when the table was never registered. When this
+ *       fails the table pointer is NULL and every budget uses the shared
+ *       bytes per cycle.
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t CS_HandleBudgetTableUpdate(void);
+
+/**
+ * \brief Refreshes the copy of the byte budgets
+ *
+ *  \par Description
+ *       Copies the byte budgets from the byte budget table, or clears
+ *       them when the table is not loaded, so every budget uses the
+ *       shared bytes per cycle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the main task only, each time the table pointer or
+ *       the table contents change.
+ */
+void CS_RefreshBudgets(void);
+
 #endif
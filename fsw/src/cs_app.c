@@ -30,6 +30,7 @@
 #include "cs_events.h"
 #include "cs_utils.h"
 #include "cs_compute.h"
+#include "cs_crc.h"
 #include "cs_eeprom_cmds.h"
 #include "cs_table_cmds.h"
 #include "cs_memory_cmds.h"
@@ -58,8 +59,9 @@ CS_AppData_t CS_AppData;
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_AppMain(void)
 {
-    CFE_Status_t     Result = 0;
-    CFE_SB_Buffer_t *BufPtr = NULL;
+    CFE_Status_t     Result     = 0;
+    CFE_SB_Buffer_t *BufPtr     = NULL;
+    bool             IdleWakeup = false;
 
     /* Performance Log (start time counter) */
     CFE_ES_PerfLogEntry(CS_APPMAIN_PERF_ID);
@@ -82,8 +84,8 @@ void CS_AppMain(void)
         /* Performance Log (stop time counter) */
         CFE_ES_PerfLogExit(CS_APPMAIN_PERF_ID);
 
-        /* Wait for the next Software Bus message */
-        Result = CFE_SB_ReceiveBuffer(&BufPtr, CS_AppData.CmdPipe, CS_WAKEUP_TIMEOUT);
+        /* Wait for the next Software Bus message, or until the next self-clocked background cycle */
+        Result = CFE_SB_ReceiveBuffer(&BufPtr, CS_AppData.CmdPipe, CS_GetPipeTimeout());
 
         /* Performance Log (start time counter)  */
         CFE_ES_PerfLogEntry(CS_APPMAIN_PERF_ID);
@@ -95,7 +97,16 @@ void CS_AppMain(void)
         }
         else if ((Result == CFE_SB_TIME_OUT) || (Result == CFE_SB_NO_MESSAGE))
         {
+            /* Nothing arrived for a whole wait, so the time is free for checksumming.
+               A poll for a paced cycle that is due is not idle time */
+            IdleWakeup = (Result == CFE_SB_TIME_OUT);
+
             Result = CS_HandleRoutineTableUpdates();
+
+            if ((Result == CFE_SUCCESS) && (IdleWakeup == true))
+            {
+                CS_HarvestIdleTime();
+            }
         }
         else
         {
@@ -103,6 +114,14 @@ void CS_AppMain(void)
                Result != CFE_SUCCESS */
         }
 
+        /* Queued child task requests and self-clocked background cycles
+           start whether or not a message came in */
+        if (Result == CFE_SUCCESS)
+        {
+            CS_StartQueuedRequests();
+            CS_PaceBackgroundCycle();
+        }
+
         /*
          ** Note: If there were some reason to exit the task
          **       normally (without error) then we would set
@@ -166,11 +185,25 @@ CFE_Status_t CS_AppInit(void)
         Result = CS_SbInit();
     }
 
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CS_InitRecomputeWorkers();
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CS_InitWorkerTasks();
+    }
+
     if (Result == CFE_SUCCESS)
     {
         /* Set up default tables in memory */
         CS_InitializeDefaultTables();
 
+        /* Set up the CRC kernels before any checksum is computed */
+        CS_InitCRC();
+        CS_CalibrateDefaultCRC();
+
         CS_AppData.HkPacket.Payload.EepromCSState = CS_EEPROM_TBL_POWERON_STATE;
         CS_AppData.HkPacket.Payload.MemoryCSState = CS_MEMORY_TBL_POWERON_STATE;
         CS_AppData.HkPacket.Payload.AppCSState    = CS_APPS_TBL_POWERON_STATE;
@@ -204,7 +237,14 @@ CFE_Status_t CS_AppInit(void)
         CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
         CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
-        CS_AppData.MaxBytesPerCycle = CS_DEFAULT_BYTES_PER_CYCLE;
+        CS_AppData.MaxBytesPerCycle                    = CS_DEFAULT_BYTES_PER_CYCLE;
+        CS_AppData.HkPacket.Payload.CycleTimeBudget    = CS_DEFAULT_CYCLE_TIME_BUDGET;
+        CS_AppData.HkPacket.Payload.CycleTimeTarget    = CS_DEFAULT_CYCLE_TIME_TARGET;
+        CS_AppData.HkPacket.Payload.SchedulerMode      = CS_DEFAULT_SCHEDULER_MODE;
+        CS_AppData.HkPacket.Payload.PacingPeriod       = CS_DEFAULT_PACING_PERIOD;
+        CS_AppData.HkPacket.Payload.IdleBytesPerWakeup = CS_DEFAULT_IDLE_BYTES_PER_WAKEUP;
+
+        OS_GetLocalTime(&CS_AppData.NextPacedCycle);
 
         /* Application startup event message */
         Result =
@@ -302,6 +342,55 @@ void CS_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
             }
             break;
 
+        case CS_CALIBRATE_CRC_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_NoArgsCmd_t)))
+            {
+                CS_CalibrateCRCCmd((CS_NoArgsCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_CYCLE_TIME_BUDGET_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetCycleTimeBudgetCmd_t)))
+            {
+                CS_SetCycleTimeBudgetCmd((CS_SetCycleTimeBudgetCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_CYCLE_TIME_TARGET_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetCycleTimeTargetCmd_t)))
+            {
+                CS_SetCycleTimeTargetCmd((CS_SetCycleTimeTargetCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_BYTES_PER_CYCLE_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetBytesPerCycleCmd_t)))
+            {
+                CS_SetBytesPerCycleCmd((CS_SetBytesPerCycleCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_SCHEDULER_MODE_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetSchedulerModeCmd_t)))
+            {
+                CS_SetSchedulerModeCmd((CS_SetSchedulerModeCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_PACING_PERIOD_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetPacingPeriodCmd_t)))
+            {
+                CS_SetPacingPeriodCmd((CS_SetPacingPeriodCmd_t *)BufPtr);
+            }
+            break;
+
+        case CS_SET_IDLE_BYTES_CC:
+            if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_SetIdleBytesCmd_t)))
+            {
+                CS_SetIdleBytesCmd((CS_SetIdleBytesCmd_t *)BufPtr);
+            }
+            break;
+
         case CS_ENABLE_ALL_CS_CC:
             if (CS_VerifyCmdLength(&BufPtr->Msg, sizeof(CS_NoArgsCmd_t)))
             {
@@ -598,6 +687,8 @@ void CS_HousekeepingCmd(const CS_NoArgsCmd_t *CmdPtr)
     }
     else
     {
+        CS_AppData.HkPacket.Payload.BytesPerCycle = CS_AppData.MaxBytesPerCycle;
+
         /* Send housekeeping telemetry packet */
         CFE_SB_TimeStampMsg(&CS_AppData.HkPacket.TlmHeader.Msg);
         CFE_SB_TransmitMsg(&CS_AppData.HkPacket.TlmHeader.Msg, true);
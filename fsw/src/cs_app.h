@@ -55,6 +55,7 @@
 #define CS_ERROR         (-1) /**< \brief Error code returned when a checksum compare failed */
 #define CS_ERR_NOT_FOUND (-2) /**< \brief Error code returned the app or table requested could not be found */
 #define CS_TABLE_ERROR   (-3) /**< \brief Error code returned on table validation error */
+#define CS_ENTRY_LOCKED  (-4) /**< \brief Error code returned when a worker is already recomputing the entry */
 /**\}*/
 
 /**
@@ -76,15 +77,38 @@
  * \name CS Child Task Names
  * \{
  */
-#define CS_RECOMP_OS_TASK_NAME      "CS_RecmpOSTsk"
-#define CS_RECOMP_CFECORE_TASK_NAME "CS_RecmpCfeCoreTsk"
-#define CS_RECOMP_MEMORY_TASK_NAME  "CS_RecmpMemoryTsk"
-#define CS_RECOMP_EEPROM_TASK_NAME  "CS_RecmpEepromTsk"
-#define CS_RECOMP_APP_TASK_NAME     "CS_RecmpAppTsk"
-#define CS_RECOMP_TABLES_TASK_NAME  "CS_RecmpTableTsk"
-#define CS_ONESHOT_TASK_NAME        "CS_OneShotTask"
+#define CS_RECOMP_WORKER_TASK_NAME "CS_RecmpWorker"
+#define CS_ONESHOT_TASK_NAME       "CS_OneShotTask"
+#define CS_SUB_RANGE_TASK_NAME     "CS_SubRangeTsk"
 /**\}*/
 
+/**
+ * \name CS Worker Task Queue Names
+ * \{
+ */
+#define CS_RECOMP_WORKER_QUEUE_NAME "CS_RecmpWorkerQ"
+#define CS_ONESHOT_QUEUE_NAME       "CS_OneShotQ"
+#define CS_SUB_RANGE_QUEUE_NAME     "CS_SubRangeQ"
+/**\}*/
+
+/**
+ * \brief Depth of each worker task queue
+ *
+ * A worker is only given work while it is free, so it never has more
+ * than one work item waiting.
+ */
+#define CS_WORKER_QUEUE_DEPTH 1
+
+/**
+ * \brief Name of the mutex guarding the recompute workers
+ */
+#define CS_WORKER_MUTEX_NAME "CS_WorkerMutex"
+
+/**
+ * \brief Number of 32 bit words in a bitmap of enabled entries
+ */
+#define CS_ENABLED_MAP_WORDS(NumEntries) (((NumEntries) + 31) / 32)
+
 /**
  * \brief Wakeup for CS
  *
@@ -100,6 +124,35 @@
  **
  **************************************************************************/
 
+/**
+ *  \brief A queued child task request, kept as the whole command
+ */
+typedef union
+{
+    CFE_SB_Buffer_t   Buf;          /**< \brief Command as a software bus buffer */
+    CS_NoArgsCmd_t    NoArgsCmd;    /**< \brief cFE core or OS recompute command */
+    CS_EntryCmd_t     EntryCmd;     /**< \brief EEPROM or Memory recompute command */
+    CS_TableNameCmd_t TableNameCmd; /**< \brief Tables recompute command */
+    CS_AppNameCmd_t   AppNameCmd;   /**< \brief Apps recompute command */
+    CS_OneShotCmd_t   OneShotCmd;   /**< \brief One shot command */
+} CS_ChildTaskRequest_t;
+
+/**
+ *  \brief A recompute worker, free while EntryPtr is NULL
+ */
+typedef struct
+{
+    CFE_ES_TaskId_t TaskID;   /**< \brief Worker task, created at startup */
+    osal_id_t       QueueID;  /**< \brief Queue the worker task waits on for work */
+    uint16          Table;    /**< \brief Table of the entry being recomputed */
+    uint16          EntryID;  /**< \brief Entry ID being recomputed, for the EEPROM and Memory tables */
+    void *          EntryPtr; /**< \brief Results entry the worker holds until its recompute finishes */
+
+    CFE_ES_TaskId_t SubRangeTaskID[CS_NUM_SUB_RANGES];  /**< \brief Split recompute tasks, one per sub-range */
+    osal_id_t       SubRangeQueueID[CS_NUM_SUB_RANGES]; /**< \brief Queues the split recompute tasks wait on for work */
+    uint32          SubRangeBusyMask;                   /**< \brief Bit for each sub-range its task is checksumming */
+} CS_RecomputeWorker_t;
+
 /**
  *  \brief CS global data structure
  */
@@ -110,21 +163,45 @@ typedef struct
     char   PipeName[CS_CMD_PIPE_NAME_LEN]; /**< \brief Command pipe name */
     uint16 PipeDepth;                      /**< \brief Command pipe depth */
 
-    uint16          ChildTaskTable;   /**< \brief Table for the child task to process */
-    uint16          ChildTaskEntryID; /**< \brief Entry in table for child task to process */
-    CFE_ES_TaskId_t ChildTaskID;      /**< \brief Task ID for the child task */
+    CFE_ES_TaskId_t ChildTaskID;    /**< \brief Task ID for the one shot child task, created at startup */
+    osal_id_t       OneShotQueueID; /**< \brief Queue the one shot child task waits on for work */
 
-    uint32 MaxBytesPerCycle; /**< \brief Max number of bytes to process in a cycle */
+    /**
+     * \brief The running one shot is to stop at its next chunk
+     *
+     * Set by the cancel command on the main task and polled by the one shot
+     * child task between chunks, which clears it once it has stopped. It is
+     * volatile so the child task reads it afresh on every chunk.
+     */
+    volatile bool OneShotCancelled;
 
-    uint32 RunStatus; /**< \brief Application run status */
+    CS_RecomputeWorker_t RecomputeWorkers[CS_MAX_RECOMPUTE_WORKERS]; /**< \brief Recompute worker pool */
+    osal_id_t            WorkerMutex;                                /**< \brief Guards the recompute workers */
+
+    uint32 MaxBytesPerCycle;                   /**< \brief Max number of bytes to process in a cycle */
+    uint32 CycleBytesBudget;                   /**< \brief Bytes the current background cycle started with */
+    uint32 CycleBytesRemaining;                /**< \brief Bytes the current background cycle may still process */
+    uint32 TableBytesRemaining[CS_NUM_TABLES]; /**< \brief Bytes each checksum type may still process this cycle */
 
-    CS_Res_EepromMemory_Table_Entry_t *RecomputeEepromMemoryEntryPtr; /**< \brief Pointer to an entry to recompute in
-                                                                         the EEPROM or Memory table */
+    /**
+     * \brief Copy of the byte budgets in the byte budget table
+     *
+     * Refreshed only by the main task whenever it gets the table address, and read
+     * by the child tasks, which so never follow a table pointer the main task may
+     * set NULL or move at the same time. All zero while the table is not loaded.
+     */
+    uint32 BytesPerCycleBudget[CS_NUM_BUDGETS];
 
-    CS_Res_App_Table_Entry_t *RecomputeAppEntryPtr;       /**< \brief Pointer to an entry to recompute in the
-                                                                      Application table */
-    CS_Res_Tables_Table_Entry_t *RecomputeTablesEntryPtr; /**< \brief Pointer to an entry to recompute in the
-                                                                      Tables table */
+    uint32 Deficit[CS_NUM_TABLES]; /**< \brief Bytes each checksum type may still process in its weighted turn */
+    uint16 CategoriesDone;         /**< \brief Bit for each checksum type through its table in this pass */
+
+    OS_time_t NextPacedCycle; /**< \brief When the next self-clocked background cycle is due */
+
+    CS_ChildTaskRequest_t RequestQueue[CS_MAX_QUEUED_REQUESTS]; /**< \brief Child task requests waiting to start */
+    uint16                RequestQueueHead;                     /**< \brief Oldest request in the queue */
+    bool                  StartingQueuedRequest;                /**< \brief Set while a queued request is replayed */
+
+    uint32 RunStatus; /**< \brief Application run status */
 
     CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID */
 
@@ -140,6 +217,8 @@ typedef struct
     CFE_TBL_Handle_t DefAppTableHandle; /**< \brief Handle to the Apps definition table */
     CFE_TBL_Handle_t ResAppTableHandle; /**< \brief Hanlde to the Apps results table */
 
+    CFE_TBL_Handle_t DefBudgetTableHandle; /**< \brief Handle to the byte budget table */
+
     CS_Def_EepromMemory_Table_Entry_t *DefEepromTblPtr; /**< \brief Pointer to the EEPROM definition table */
     CS_Res_EepromMemory_Table_Entry_t *ResEepromTblPtr; /**< \brief Pointer to the EEPROM results table */
 
@@ -152,6 +231,16 @@ typedef struct
     CS_Def_App_Table_Entry_t *DefAppTblPtr; /**< \brief Pointer to the Apps definition table */
     CS_Res_App_Table_Entry_t *ResAppTblPtr; /**< \brief Pointer to the Apps results table */
 
+    CS_Def_Budget_Table_t *DefBudgetTblPtr; /**< \brief Pointer to the byte budget table */
+
+    /* One bit per results entry, set while the entry is enabled, so the next entry to
+     * checksum is found without walking the disabled and empty entries */
+
+    uint32 EepromEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_EEPROM_TABLE_ENTRIES)]; /**< \brief EEPROM enabled map */
+    uint32 MemoryEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_MEMORY_TABLE_ENTRIES)]; /**< \brief Memory enabled map */
+    uint32 TablesEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_TABLES_TABLE_ENTRIES)]; /**< \brief Tables enabled map */
+    uint32 AppEnabledMap[CS_ENABLED_MAP_WORDS(CS_MAX_NUM_APP_TABLE_ENTRIES)];       /**< \brief Apps enabled map */
+
     CS_Res_EepromMemory_Table_Entry_t OSCodeSeg;      /**< \brief OS code segment 'table' */
     CS_Res_EepromMemory_Table_Entry_t CfeCoreCodeSeg; /**< \brief cFE core code segment 'table' */
 
@@ -163,6 +252,7 @@ typedef struct
         DefaultTablesDefTable[CS_MAX_NUM_TABLES_TABLE_ENTRIES]; /**< \brief Default Tables definition table */
     CS_Def_App_Table_Entry_t
         DefaultAppDefTable[CS_MAX_NUM_APP_TABLE_ENTRIES]; /**< \brief Default Apps definition table */
+    CS_Def_Budget_Table_t DefaultBudgetDefTable;          /**< \brief Default byte budget table */
 
     /* The following pointers locate the results for CS tables that get checksummed because they are listed in the CS
      * Tables table */
@@ -101,7 +101,8 @@ void CS_ReportBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
             {
                 Baseline = ResultsEntry->ComparisonValue;
                 CFE_EVS_SendEvent(CS_BASELINE_APP_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Report baseline of app %s is 0x%08X", Name, (unsigned int)Baseline);
+                                  "Report baseline of app %s is 0x%08X, algorithm %d", Name, (unsigned int)Baseline,
+                                  (int)ResultsEntry->Algorithm);
             }
             else
             {
@@ -126,12 +127,12 @@ void CS_ReportBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
 void CS_RecomputeBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t           ChildTaskID;
     CFE_Status_t              Status;
+    uint16                    EntryID;
     CS_Res_App_Table_Entry_t *ResultsEntry;
     char                      Name[OS_MAX_API_NAME];
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (CS_ChildTaskIsFree() == true)
         {
             strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
             Name[sizeof(Name) - 1] = '\0';
@@ -139,29 +140,25 @@ void CS_RecomputeBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
             /* make sure the entry is a valid number and is defined in the table */
             if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable = CS_APP_TABLE;
-
-                CS_AppData.RecomputeAppEntryPtr = ResultsEntry;
-
-                Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_APP_TASK_NAME, CS_RecomputeAppChildTask, NULL,
-                                                CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+                EntryID = (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr);
+                Status  = CS_StartRecomputeWorker(CS_APP_TABLE, EntryID, ResultsEntry, CS_RecomputeAppChildTask);
                 if (Status == CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_APP_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of app %s started", Name);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else if (Status == CS_ENTRY_LOCKED)
                 {
-                    CFE_EVS_SendEvent(CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Recompute baseline of app %s failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                    /* the event was sent when the entry was found in use */
+                    CS_AppData.HkPacket.Payload.CmdErrCounter++;
+                }
+                else /* handing the work to the worker task failed */
+                {
+                    CFE_EVS_SendEvent(CS_RECOMPUTE_APP_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Recompute baseline of app %s failed, posting to worker queue failed: 0x%08X",
                                       Name, (unsigned int)Status);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -171,9 +168,9 @@ void CS_RecomputeBaselineAppCmd(const CS_AppNameCmd_t *CmdPtr)
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
         }
-        else
+        else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
         {
-            /*send event that we can't start another task right now */
+            /* the request queue is full too, send event that we can't start another task right now */
             CFE_EVS_SendEvent(CS_RECOMPUTE_APP_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                               "App recompute baseline for app %s failed: child task in use", Name);
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -202,6 +199,7 @@ void CS_DisableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
                 ResultsEntry->State             = CS_STATE_DISABLED;
                 ResultsEntry->TempChecksumValue = 0;
                 ResultsEntry->ByteOffset        = 0;
+                CS_SetEntryEnabled(CS_APP_TABLE, (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr), false);
 
                 CFE_EVS_SendEvent(CS_DISABLE_APP_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of app %s is Disabled", Name);
@@ -250,6 +248,7 @@ void CS_EnableNameAppCmd(const CS_AppNameCmd_t *CmdPtr)
             if (CS_GetAppResTblEntryByName(&ResultsEntry, Name))
             {
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEntryEnabled(CS_APP_TABLE, (uint16)(ResultsEntry - CS_AppData.ResAppTblPtr), true);
 
                 CFE_EVS_SendEvent(CS_ENABLE_APP_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of app %s is Enabled", Name);
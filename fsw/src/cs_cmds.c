@@ -34,6 +34,7 @@
 #include "cs_cmds.h"
 #include "cs_utils.h"
 #include "cs_compute.h"
+#include <string.h>
 
 /**************************************************************************
  **
@@ -71,6 +72,15 @@ void CS_ResetCmd(const CS_NoArgsCmd_t *CmdPtr)
         CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter = 0;
         CS_AppData.HkPacket.Payload.OSCSErrCounter      = 0;
         CS_AppData.HkPacket.Payload.PassCounter         = 0;
+        CS_AppData.HkPacket.Payload.CycleOvershootCount = 0;
+        CS_AppData.HkPacket.Payload.MaxCycleOvershoot   = 0;
+        CS_AppData.HkPacket.Payload.DeadlineMissCount   = 0;
+        CS_AppData.HkPacket.Payload.MaxPacingJitter     = 0;
+        CS_AppData.HkPacket.Payload.MissedPacedCycles   = 0;
+        CS_AppData.HkPacket.Payload.IdleBytesChecked    = 0;
+        CS_AppData.HkPacket.Payload.QueuedRequestCount  = 0;
+        CS_AppData.HkPacket.Payload.DroppedRequestCount = 0;
+        memset(CS_AppData.HkPacket.Payload.BytesChecked, 0, sizeof(CS_AppData.HkPacket.Payload.BytesChecked));
 
         CFE_EVS_SendEvent(CS_RESET_DBG_EID, CFE_EVS_EventType_DEBUG, "Reset Counters command recieved");
 }
@@ -84,8 +94,6 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
 {
     /* command verification variables */
     size_t            ExpectedLength = sizeof(CS_NoArgsCmd_t);
-    bool              DoneWithCycle  = false;
-    bool              EndOfList      = false;
     CFE_SB_MsgId_t    MessageID      = CFE_SB_INVALID_MSG_ID;
     CFE_MSG_FcnCode_t CommandCode    = 0;
     size_t            ActualLength   = 0;
@@ -103,84 +111,337 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
                           (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode, (unsigned long)ActualLength,
                           (unsigned long)ExpectedLength);
     }
+    else if (CS_AppData.HkPacket.Payload.PacingPeriod == 0)
+    {
+        CS_RunBackgroundCycle();
+    }
     else
     {
-        if (CS_AppData.HkPacket.Payload.ChecksumState == CS_STATE_ENABLED)
-        {
-            DoneWithCycle = false;
-            EndOfList     = false;
+        /* CS is clocking its own background cycles */
+    }
+}
 
-            /* Skip this background cycle if there's a recompute or one shot in
-             * progress */
-            if (CS_AppData.HkPacket.Payload.RecomputeInProgress == true || CS_AppData.HkPacket.Payload.OneShotInProgress == true)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Run one background checksumming cycle                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RunBackgroundCycle(void)
+{
+    bool      DoneWithCycle = false;
+    bool      EndOfList     = false;
+    bool      PassCarried   = false;
+    bool      ServeOverdue  = false;
+    bool      OverdueDone   = false;
+    uint32    CycleBytes    = 0;
+    uint32    BytesBefore   = 0;
+    uint16    OverdueTable  = 0;
+    uint16    OverdueEntry  = 0;
+    int64     ElapsedTime   = 0;
+    OS_time_t StartTime;
+    OS_time_t StopTime;
+
+    if (CS_AppData.HkPacket.Payload.ChecksumState == CS_STATE_ENABLED)
+    {
+        DoneWithCycle = false;
+        EndOfList     = false;
+
+        /* A recompute or one shot in progress does not stop the cycle. The
+           entries being recomputed are skipped, and the cycle's bytes are
+           shared with the child tasks */
+        CS_ResetCycleBytes();
+        OS_GetLocalTime(&StartTime);
+
+        ServeOverdue = (CS_AppData.HkPacket.Payload.SchedulerMode == CS_SCHEDULER_DEADLINE);
+
+        /* We check for end-of-list because we don't necessarily know the
+           order in which the table entries are defined, and we don't
+           want to keep looping through the list. Going around again
+           only happens after bytes have been checksummed, so a list
+           with nothing enabled still ends */
+
+        while ((DoneWithCycle != true) && (EndOfList != true))
+        {
+            /* The most overdue entry goes first. One that checksums
+               nothing leaves the rest of the cycle to the sweep, so an
+               entry that can not make progress is not picked forever */
+            if ((ServeOverdue == true) && (CS_FindOverdueEntry(&OverdueTable, &OverdueEntry) == true))
             {
-                CFE_EVS_SendEvent(CS_BKGND_COMPUTE_PROG_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Skipping background cycle. Recompute or oneshot in progress.");
-                DoneWithCycle = true;
+                BytesBefore   = CS_AppData.CycleBytesRemaining;
+                DoneWithCycle = CS_BackgroundEntry(OverdueTable, &OverdueEntry, &OverdueDone);
+
+                if ((DoneWithCycle != true) && (CS_AppData.CycleBytesRemaining == BytesBefore))
+                {
+                    ServeOverdue = false;
+                }
             }
+            else if ((CS_AppData.HkPacket.Payload.SchedulerMode == CS_SCHEDULER_WEIGHTED) ||
+                     (CS_AppData.HkPacket.Payload.SchedulerMode == CS_SCHEDULER_INTERLEAVED))
+            {
+                BytesBefore = CS_AppData.CycleBytesRemaining;
 
-            /* We check for end-of-list because we don't necessarily know the
-               order in which the table entries are defined, and we don't
-               want to keep looping through the list */
+                if (CS_AppData.HkPacket.Payload.SchedulerMode == CS_SCHEDULER_WEIGHTED)
+                {
+                    DoneWithCycle = CS_BackgroundWeighted();
+                }
+                else
+                {
+                    DoneWithCycle = CS_BackgroundInterleaved();
+                }
 
-            while ((DoneWithCycle != true) && (EndOfList != true))
+                /* No checksum type had anything to checksum */
+                if (CS_AppData.CycleBytesRemaining == BytesBefore)
+                {
+                    EndOfList = true;
+                }
+            }
+            else
             {
                 /* We need to check the current table value here because
                    it is updated (and possibly reset to zero) inside each
                    function called */
                 if (CS_AppData.HkPacket.Payload.CurrentCSTable >= (CS_NUM_TABLES - 1))
                 {
-                    EndOfList = true;
+                    /* Bytes left at the end of the list carry over into the next
+                       pass, but the end is only passed once per byte budget */
+                    EndOfList   = PassCarried;
+                    PassCarried = true;
                 }
 
-                /* Call the appropriate background function based on the current table
-                   value.  The value is updated inside each function */
-                switch (CS_AppData.HkPacket.Payload.CurrentCSTable)
+                DoneWithCycle = CS_BackgroundCurrentTable();
+            }
+
+            /* With a time budget, keep checksumming chunks until it has been used.
+               A clock that went backwards ends the cycle rather than extending it */
+            if ((DoneWithCycle == true) && (CS_AppData.HkPacket.Payload.CycleTimeBudget != 0) &&
+                (CS_AppData.MaxBytesPerCycle != 0))
+            {
+                OS_GetLocalTime(&StopTime);
+                ElapsedTime = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(StopTime, StartTime));
+
+                if ((ElapsedTime >= 0) && (ElapsedTime < CS_AppData.HkPacket.Payload.CycleTimeBudget))
                 {
-                    case (CS_CFECORE):
-                        DoneWithCycle = CS_BackgroundCfeCore();
-                        break;
+                    CycleBytes += CS_AppData.CycleBytesBudget - CS_AppData.CycleBytesRemaining;
+                    CS_ResetCycleBytes();
 
-                    case (CS_OSCORE):
+                    DoneWithCycle = false;
+                    EndOfList     = false;
+                    PassCarried   = false;
+                }
+            }
+        } /* end while */
 
-                        DoneWithCycle = CS_BackgroundOS();
-                        break;
+        OS_GetLocalTime(&StopTime);
+        ElapsedTime = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(StopTime, StartTime));
 
-                    case (CS_EEPROM_TABLE):
-                        DoneWithCycle = CS_BackgroundEeprom();
-                        break;
+        if (ElapsedTime < 0)
+        {
+            ElapsedTime = 0;
+        }
+        else if (ElapsedTime > 0xFFFFFFFF)
+        {
+            ElapsedTime = 0xFFFFFFFF;
+        }
 
-                    case (CS_MEMORY_TABLE):
-                        DoneWithCycle = CS_BackgroundMemory();
-                        break;
+        CycleBytes += CS_AppData.CycleBytesBudget - CS_AppData.CycleBytesRemaining;
 
-                    case (CS_TABLES_TABLE):
-                        DoneWithCycle = CS_BackgroundTables();
-                        break;
+        CS_AppData.HkPacket.Payload.LastCycleTime  = (uint32)ElapsedTime;
+        CS_AppData.HkPacket.Payload.LastCycleBytes = CycleBytes;
 
-                    case (CS_APP_TABLE):
+        /* A cycle time budget already bounds the cycle, so the bytes
+           per cycle are only adapted without one. A cycle sharing its
+           bytes with child tasks does not measure the full throughput */
+        if ((CS_AppData.HkPacket.Payload.CycleTimeTarget != 0) &&
+            (CS_AppData.HkPacket.Payload.CycleTimeBudget == 0) &&
+            (CS_AppData.CycleBytesBudget == CS_AppData.MaxBytesPerCycle))
+        {
+            CS_UpdateBytesPerCycle((uint32)ElapsedTime, CycleBytes);
+        }
+    }
+    else
+    {
+        /* CS is disabled, Application-wide */
+    }
+}
 
-                        DoneWithCycle = CS_BackgroundApp();
-                        break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Checksum the next chunk of the current table in the sweep    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_BackgroundCurrentTable(void)
+{
+    bool DoneWithCycle = false;
+
+    /* Call the appropriate background function based on the current table
+       value.  The value is updated inside each function */
+    switch (CS_AppData.HkPacket.Payload.CurrentCSTable)
+    {
+        case (CS_CFECORE):
+            DoneWithCycle = CS_BackgroundCfeCore();
+            break;
+
+        case (CS_OSCORE):
+
+            DoneWithCycle = CS_BackgroundOS();
+            break;
+
+        case (CS_EEPROM_TABLE):
+            DoneWithCycle = CS_BackgroundEeprom();
+            break;
+
+        case (CS_MEMORY_TABLE):
+            DoneWithCycle = CS_BackgroundMemory();
+            break;
 
-                        /* default case in case CS_AppData.HkPacket.Payload.CurrentCSTable is some random bad value */
-                    default:
+        case (CS_TABLES_TABLE):
+            DoneWithCycle = CS_BackgroundTables();
+            break;
 
-                        /* We are at the end of the line */
-                        CS_AppData.HkPacket.Payload.CurrentCSTable      = 0;
-                        CS_AppData.HkPacket.Payload.CurrentEntryInTable = 0;
-                        CS_AppData.HkPacket.Payload.PassCounter++;
-                        DoneWithCycle = true;
-                        break;
+        case (CS_APP_TABLE):
 
-                } /* end switch */
-            }     /* end while */
+            DoneWithCycle = CS_BackgroundApp();
+            break;
+
+            /* default case in case CurrentCSTable is some random bad value */
+        default:
+
+            /* We are at the end of the line */
+            CS_AppData.HkPacket.Payload.CurrentCSTable      = 0;
+            CS_AppData.HkPacket.Payload.CurrentEntryInTable = 0;
+            CS_AppData.HkPacket.Payload.PassCounter++;
+            DoneWithCycle = true;
+            break;
+
+    } /* end switch */
+
+    return DoneWithCycle;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Start a self-clocked background cycle when one is due        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_PaceBackgroundCycle(void)
+{
+    int64     Period = (int64)CS_AppData.HkPacket.Payload.PacingPeriod * 1000;
+    int64     Late   = 0;
+    OS_time_t Now;
+
+    if (Period != 0)
+    {
+        OS_GetLocalTime(&Now);
+        Late = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, CS_AppData.NextPacedCycle));
+
+        if (Late >= 0)
+        {
+            /* Cycles missed by more than a period are skipped rather than run back to back,
+               and the cycle is timed from the latest slot so later cycles keep the rate */
+            CS_AppData.HkPacket.Payload.MissedPacedCycles += (uint32)(Late / Period);
+            CS_AppData.NextPacedCycle =
+                OS_TimeAdd(CS_AppData.NextPacedCycle, OS_TimeFromTotalMicroseconds(((Late / Period) + 1) * Period));
+            Late = Late % Period;
+
+            CS_AppData.HkPacket.Payload.LastPacingJitter = (uint32)Late;
+
+            if (CS_AppData.HkPacket.Payload.LastPacingJitter > CS_AppData.HkPacket.Payload.MaxPacingJitter)
+            {
+                CS_AppData.HkPacket.Payload.MaxPacingJitter = CS_AppData.HkPacket.Payload.LastPacingJitter;
+            }
+
+            CS_AppData.HkPacket.Payload.PacedCycleCount++;
+
+            CS_RunBackgroundCycle();
+        }
+        else if (-Late > Period)
+        {
+            /* The clock went backwards, so start timing again from now */
+            CS_AppData.NextPacedCycle = Now;
+        }
+        else
+        {
+            /* The next cycle is not due yet */
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get how long to wait for a message                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CS_GetPipeTimeout(void)
+{
+    int32     Timeout = CS_WAKEUP_TIMEOUT;
+    int64     Wait    = 0;
+    OS_time_t Now;
+
+    if (CS_AppData.HkPacket.Payload.PacingPeriod != 0)
+    {
+        OS_GetLocalTime(&Now);
+        Wait = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(CS_AppData.NextPacedCycle, Now));
+
+        /* Wake up in time for the next paced cycle, rounding up to whole milliseconds */
+        if (Wait <= 0)
+        {
+            Timeout = CFE_SB_POLL;
+        }
+        else if (Wait < ((int64)CS_WAKEUP_TIMEOUT * 1000))
+        {
+            Timeout = (int32)((Wait + 999) / 1000);
         }
         else
         {
-            /* CS is disabled, Application-wide */
+            /* Waking up for routine maintenance comes first */
         }
     }
+
+    return Timeout;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Checksum in the background while the command pipe is idle    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_HarvestIdleTime(void)
+{
+    bool   DoneWithChunk = false;
+    bool   EndOfList     = false;
+    bool   PassCarried   = false;
+    uint32 IdleBytes     = 0;
+    uint16 Table;
+
+    if ((CS_AppData.HkPacket.Payload.IdleBytesPerWakeup != 0) &&
+        (CS_AppData.HkPacket.Payload.ChecksumState == CS_STATE_ENABLED))
+    {
+        /* Idle bytes come from their own budget, which any checksum type may
+           use up. Every background cycle resets the budgets before it starts,
+           so the scheduled cycles keep their full budgets. Running child
+           tasks get their share of the idle bytes too */
+        IdleBytes                      = CS_ShareCycleBytes(CS_AppData.HkPacket.Payload.IdleBytesPerWakeup);
+        CS_AppData.CycleBytesRemaining = IdleBytes;
+
+        for (Table = 0; Table < CS_NUM_TABLES; Table++)
+        {
+            CS_AppData.TableBytesRemaining[Table] = IdleBytes;
+        }
+
+        /* Idle chunks carry on the sweep, whatever the scheduler mode */
+        while ((DoneWithChunk != true) && (EndOfList != true))
+        {
+            if (CS_AppData.HkPacket.Payload.CurrentCSTable >= (CS_NUM_TABLES - 1))
+            {
+                EndOfList   = PassCarried;
+                PassCarried = true;
+            }
+
+            DoneWithChunk = CS_BackgroundCurrentTable();
+        }
+
+        CS_AppData.HkPacket.Payload.IdleBytesChecked += IdleBytes - CS_AppData.CycleBytesRemaining;
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -309,8 +570,9 @@ void CS_ReportBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
         if (CS_AppData.CfeCoreCodeSeg.ComputedYet == true)
         {
             CFE_EVS_SendEvent(CS_BASELINE_CFECORE_INF_EID, CFE_EVS_EventType_INFORMATION,
-                              "Baseline of cFE Core is 0x%08X",
-                              (unsigned int)CS_AppData.CfeCoreCodeSeg.ComparisonValue);
+                              "Baseline of cFE Core is 0x%08X, algorithm %d",
+                              (unsigned int)CS_AppData.CfeCoreCodeSeg.ComparisonValue,
+                              (int)CS_AppData.CfeCoreCodeSeg.Algorithm);
         }
         else
         {
@@ -330,8 +592,8 @@ void CS_ReportBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
         if (CS_AppData.OSCodeSeg.ComputedYet == true)
         {
             CFE_EVS_SendEvent(CS_BASELINE_OS_INF_EID, CFE_EVS_EventType_INFORMATION,
-                              "Baseline of OS code segment is 0x%08X",
-                              (unsigned int)CS_AppData.OSCodeSeg.ComparisonValue);
+                              "Baseline of OS code segment is 0x%08X, algorithm %d",
+                              (unsigned int)CS_AppData.OSCodeSeg.ComparisonValue, (int)CS_AppData.OSCodeSeg.Algorithm);
         }
         else
         {
@@ -349,22 +611,12 @@ void CS_ReportBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 void CS_RecomputeBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
+    CFE_Status_t Status;
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (CS_ChildTaskIsFree() == true)
         {
-            /* There is no child task running right now, we can use it*/
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-            /* fill in child task variables */
-            CS_AppData.ChildTaskTable                = CS_CFECORE;
-            CS_AppData.ChildTaskEntryID              = 0;
-            CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.CfeCoreCodeSeg;
-
-            Status =
-                CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_CFECORE_TASK_NAME, CS_RecomputeEepromMemoryChildTask,
-                                       NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+            Status = CS_StartRecomputeWorker(CS_CFECORE, 0, &CS_AppData.CfeCoreCodeSeg,
+                                             CS_RecomputeEepromMemoryChildTask);
 
             if (Status == CFE_SUCCESS)
             {
@@ -372,18 +624,22 @@ void CS_RecomputeBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
                                   "Recompute of cFE core started");
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
-            else /* child task creation failed */
+            else if (Status == CS_ENTRY_LOCKED)
+            {
+                /* the event was sent when the entry was found in use */
+                CS_AppData.HkPacket.Payload.CmdErrCounter++;
+            }
+            else /* handing the work to the worker task failed */
             {
-                CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Recompute cFE core failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Recompute cFE core failed, posting to worker queue failed: 0x%08X",
                                   (unsigned int)Status);
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
             }
         }
-        else
+        else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
         {
-            /*send event that we can't start another task right now */
+            /* the request queue is full too, send event that we can't start another task right now */
             CFE_EVS_SendEvent(CS_RECOMPUTE_CFECORE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Recompute cFE core failed: child task in use");
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -398,39 +654,33 @@ void CS_RecomputeBaselineCfeCoreCmd(const CS_NoArgsCmd_t *CmdPtr)
 void CS_RecomputeBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
+    CFE_Status_t Status;
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (CS_ChildTaskIsFree() == true)
         {
-            /* There is no child task running right now, we can use it*/
-            CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-            /* fill in child task variables */
-            CS_AppData.ChildTaskTable                = CS_OSCORE;
-            CS_AppData.ChildTaskEntryID              = 0;
-            CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.OSCodeSeg;
-
-            Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_OS_TASK_NAME, CS_RecomputeEepromMemoryChildTask,
-                                            NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+            Status = CS_StartRecomputeWorker(CS_OSCORE, 0, &CS_AppData.OSCodeSeg, CS_RecomputeEepromMemoryChildTask);
             if (Status == CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(CS_RECOMPUTE_OS_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                   "Recompute of OS code segment started");
                 CS_AppData.HkPacket.Payload.CmdCounter++;
             }
-            else /* child task creation failed */
+            else if (Status == CS_ENTRY_LOCKED)
+            {
+                /* the event was sent when the entry was found in use */
+                CS_AppData.HkPacket.Payload.CmdErrCounter++;
+            }
+            else /* handing the work to the worker task failed */
             {
-                CFE_EVS_SendEvent(CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Recompute OS code segment failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                CFE_EVS_SendEvent(CS_RECOMPUTE_OS_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Recompute OS code segment failed, posting to worker queue failed: 0x%08X",
                                   (unsigned int)Status);
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
             }
         }
-        else
+        else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
         {
-            /*send event that we can't start another task right now */
+            /* the request queue is full too, send event that we can't start another task right now */
             CFE_EVS_SendEvent(CS_RECOMPUTE_OS_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Recompute OS code segment failed: child task in use");
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -445,15 +695,15 @@ void CS_RecomputeBaselineOSCmd(const CS_NoArgsCmd_t *CmdPtr)
 void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID;
-    CFE_Status_t    Status;
+    CFE_Status_t Status;
 
         /* validate size and address */
         Status = CFE_PSP_MemValidateRange(CmdPtr->Payload.Address, CmdPtr->Payload.Size, CFE_PSP_MEM_ANY);
 
         if (Status == CFE_SUCCESS)
         {
-            if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+            /* A one shot waits for the recompute workers to finish */
+            if ((CS_ChildTaskIsFree() == true) && (CS_AppData.HkPacket.Payload.RecomputeInProgress == false))
             {
                 /* There is no child task running right now, we can use it*/
                 CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
@@ -463,7 +713,8 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
                 CS_AppData.HkPacket.Payload.LastOneShotSize    = CmdPtr->Payload.Size;
                 if (CmdPtr->Payload.MaxBytesPerCycle == 0)
                 {
-                    CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = CS_AppData.MaxBytesPerCycle;
+                    CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle =
+                        CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET);
                 }
                 else
                 {
@@ -472,21 +723,19 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
 
                 CS_AppData.HkPacket.Payload.LastOneShotChecksum = 0;
 
-                Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_ONESHOT_TASK_NAME, CS_OneShotChildTask, NULL,
-                                                CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+                Status = CS_PostWork(CS_AppData.OneShotQueueID, CS_OneShotChildTask);
                 if (Status == CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(CS_ONESHOT_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "OneShot checksum started on address: 0x%08X, size: %d",
                                       (unsigned int)(CmdPtr->Payload.Address), (int)(CmdPtr->Payload.Size));
 
-                    CS_AppData.ChildTaskID = ChildTaskID;
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else /* handing the work to the worker task failed */
                 {
-                    CFE_EVS_SendEvent(CS_ONESHOT_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "OneShot checkum failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                    CFE_EVS_SendEvent(CS_ONESHOT_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "OneShot checkum failed, posting to worker queue failed: 0x%08X",
                                       (unsigned int)Status);
 
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -494,9 +743,9 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
                     CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
                 }
             }
-            else
+            else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
             {
-                /*send event that we can't start another task right now */
+                /* the request queue is full too, send event that we can't start another task right now */
                 CFE_EVS_SendEvent(CS_ONESHOT_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "OneShot checksum failed: child task in use");
 
@@ -520,30 +769,16 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
-    /* command verification variables */
-    CFE_Status_t Status;
-
-        /* Make sure there is a OneShot command in use */
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == true)
+        /* Make sure there is a OneShot command in use that has not been cancelled already */
+        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false &&
+            CS_AppData.HkPacket.Payload.OneShotInProgress == true && CS_AppData.OneShotCancelled == false)
         {
-            Status = CFE_ES_DeleteChildTask(CS_AppData.ChildTaskID);
-
-            if (Status == CFE_SUCCESS)
-            {
-                CS_AppData.ChildTaskID                  = CFE_ES_TASKID_UNDEFINED;
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-                CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
-                CS_AppData.HkPacket.Payload.CmdCounter++;
-                CFE_EVS_SendEvent(CS_ONESHOT_CANCELLED_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "OneShot checksum calculation has been cancelled");
-            }
-            else
-            {
-                CFE_EVS_SendEvent(CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Cancel OneShot checksum failed, CFE_ES_DeleteChildTask returned:  0x%08X",
-                                  (unsigned int)Status);
-                CS_AppData.HkPacket.Payload.CmdErrCounter++;
-            }
+            /* The one shot task stops at its next chunk and clears OneShotInProgress,
+               so no other one shot can start until it has */
+            CS_AppData.OneShotCancelled = true;
+            CS_AppData.HkPacket.Payload.CmdCounter++;
+            CFE_EVS_SendEvent(CS_ONESHOT_CANCELLED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "OneShot checksum calculation has been cancelled");
         }
         else
         {
@@ -552,3 +787,208 @@ void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
         }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Calibrate CRC kernels command                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_CalibrateCRCCmd(const CS_NoArgsCmd_t *CmdPtr)
+{
+    CS_AppData.HkPacket.Payload.CmdCounter++;
+
+    CS_CalibrateDefaultCRC();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the background cycle time budget command                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetCycleTimeBudgetCmd(const CS_SetCycleTimeBudgetCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.CycleTimeBudget > CS_MAX_CYCLE_TIME_BUDGET)
+    {
+        CFE_EVS_SendEvent(CS_SET_CYCLE_TIME_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set cycle time budget failed, budget %lu us is greater than the maximum %lu us",
+                          (unsigned long)CmdPtr->Payload.CycleTimeBudget, (unsigned long)CS_MAX_CYCLE_TIME_BUDGET);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.CycleTimeBudget = CmdPtr->Payload.CycleTimeBudget;
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_CYCLE_TIME_BUDGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Background cycle time budget set to %lu us",
+                          (unsigned long)CmdPtr->Payload.CycleTimeBudget);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the adaptive background cycle time target command        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetCycleTimeTargetCmd(const CS_SetCycleTimeTargetCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.CycleTimeTarget > CS_MAX_CYCLE_TIME_BUDGET)
+    {
+        CFE_EVS_SendEvent(CS_SET_CYCLE_TIME_TARGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set cycle time target failed, target %lu us is greater than the maximum %lu us",
+                          (unsigned long)CmdPtr->Payload.CycleTimeTarget, (unsigned long)CS_MAX_CYCLE_TIME_BUDGET);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.CycleTimeTarget     = CmdPtr->Payload.CycleTimeTarget;
+        CS_AppData.HkPacket.Payload.CycleOvershootCount = 0;
+        CS_AppData.HkPacket.Payload.MaxCycleOvershoot   = 0;
+
+        if (CmdPtr->Payload.CycleTimeTarget == 0)
+        {
+            CS_AppData.MaxBytesPerCycle = CS_DEFAULT_BYTES_PER_CYCLE;
+        }
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_CYCLE_TIME_TARGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Background cycle time target set to %lu us",
+                          (unsigned long)CmdPtr->Payload.CycleTimeTarget);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set a byte budget command                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetBytesPerCycleCmd(const CS_SetBytesPerCycleCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.Budget >= CS_NUM_BUDGETS)
+    {
+        CFE_EVS_SendEvent(CS_SET_BYTES_PER_CYCLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set bytes per cycle failed, budget %d is not less than %d", (int)CmdPtr->Payload.Budget,
+                          (int)CS_NUM_BUDGETS);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else if (CmdPtr->Payload.BytesPerCycle > CS_MAX_BUDGET_BYTES_PER_CYCLE)
+    {
+        CFE_EVS_SendEvent(CS_SET_BYTES_PER_CYCLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set bytes per cycle failed, %lu is greater than %lu",
+                          (unsigned long)CmdPtr->Payload.BytesPerCycle, (unsigned long)CS_MAX_BUDGET_BYTES_PER_CYCLE);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else if (CS_AppData.DefBudgetTblPtr == NULL)
+    {
+        CFE_EVS_SendEvent(CS_SET_BYTES_PER_CYCLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set bytes per cycle failed, byte budget table is not loaded");
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.DefBudgetTblPtr->BytesPerCycle[CmdPtr->Payload.Budget] = CmdPtr->Payload.BytesPerCycle;
+        CFE_TBL_Modified(CS_AppData.DefBudgetTableHandle);
+        CS_RefreshBudgets();
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_BYTES_PER_CYCLE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Bytes per cycle for budget %d set to %lu", (int)CmdPtr->Payload.Budget,
+                          (unsigned long)CmdPtr->Payload.BytesPerCycle);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the background scheduler mode command                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetSchedulerModeCmd(const CS_SetSchedulerModeCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.Mode > CS_SCHEDULER_INTERLEAVED)
+    {
+        CFE_EVS_SendEvent(CS_SET_SCHEDULER_MODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set scheduler mode failed, mode %d is not valid", (int)CmdPtr->Payload.Mode);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.SchedulerMode = (uint8)CmdPtr->Payload.Mode;
+
+        /* Weighted turns and passes start afresh, each type carrying on from its place */
+        memset(CS_AppData.Deficit, 0, sizeof(CS_AppData.Deficit));
+        CS_AppData.CategoriesDone = 0;
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_SCHEDULER_MODE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Scheduler mode set to %d", (int)CmdPtr->Payload.Mode);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the self-clocked background cycle period command         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetPacingPeriodCmd(const CS_SetPacingPeriodCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.PacingPeriod > CS_MAX_PACING_PERIOD)
+    {
+        CFE_EVS_SendEvent(CS_SET_PACING_PERIOD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set pacing period failed, period %lu ms is greater than the maximum %lu ms",
+                          (unsigned long)CmdPtr->Payload.PacingPeriod, (unsigned long)CS_MAX_PACING_PERIOD);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.PacingPeriod      = CmdPtr->Payload.PacingPeriod;
+        CS_AppData.HkPacket.Payload.LastPacingJitter  = 0;
+        CS_AppData.HkPacket.Payload.MaxPacingJitter   = 0;
+        CS_AppData.HkPacket.Payload.MissedPacedCycles = 0;
+
+        /* The first paced cycle is due at once */
+        OS_GetLocalTime(&CS_AppData.NextPacedCycle);
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_PACING_PERIOD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Background cycle pacing period set to %lu ms",
+                          (unsigned long)CmdPtr->Payload.PacingPeriod);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Set the idle time checksumming budget command                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SetIdleBytesCmd(const CS_SetIdleBytesCmd_t *CmdPtr)
+{
+    if (CmdPtr->Payload.IdleBytes > CS_MAX_IDLE_BYTES_PER_WAKEUP)
+    {
+        CFE_EVS_SendEvent(CS_SET_IDLE_BYTES_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set idle bytes failed, %lu bytes is greater than the maximum %lu bytes",
+                          (unsigned long)CmdPtr->Payload.IdleBytes, (unsigned long)CS_MAX_IDLE_BYTES_PER_WAKEUP);
+
+        CS_AppData.HkPacket.Payload.CmdErrCounter++;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.IdleBytesPerWakeup = CmdPtr->Payload.IdleBytes;
+
+        CS_AppData.HkPacket.Payload.CmdCounter++;
+
+        CFE_EVS_SendEvent(CS_SET_IDLE_BYTES_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Idle time checksumming set to %lu bytes per wakeup",
+                          (unsigned long)CmdPtr->Payload.IdleBytes);
+    }
+}
@@ -73,12 +73,91 @@ void CS_ResetCmd(const CS_NoArgsCmd_t *CmdPtr);
  *       tell CS.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The message is ignored while CS clocks its own background
+ *       cycles, see #CS_SET_PACING_PERIOD_CC.
  *
  *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
  */
 void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr);
 
+/**
+ * \brief Runs one background checking cycle
+ *
+ *  \par Description
+ *       Checksums the next chunks of the enabled entries, as picked by
+ *       the scheduler mode, and updates the cycle statistics.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each chunk checksums up to the maximum bytes per cycle, carrying
+ *       whatever one entry leaves unused on to the next entries and
+ *       tables. With a nonzero cycle time budget, chunks are checksummed
+ *       until the budget has been used, so the cycle may overrun it by
+ *       the time taken by one chunk. Otherwise a single chunk is
+ *       checksummed.
+ */
+void CS_RunBackgroundCycle(void);
+
+/**
+ * \brief Checksums the next chunk of the current table in the sweep
+ *
+ *  \par Description
+ *       Calls the background function of the checksum type the
+ *       sequential sweep has reached, or starts the next pass once the
+ *       sweep has been through every type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used, or a pass has ended
+ *  \retval false Bytes are left for the next checksum type
+ */
+bool CS_BackgroundCurrentTable(void);
+
+/**
+ * \brief Runs a self-clocked background cycle when one is due
+ *
+ *  \par Description
+ *       Called on every pass of the main loop. Once the next paced
+ *       cycle is due, runs it and records how late it started.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing while the pacing period is zero. Cycles missed by
+ *       more than a period are counted and skipped, and the next cycle
+ *       keeps to the original rate.
+ */
+void CS_PaceBackgroundCycle(void);
+
+/**
+ * \brief Gets how long the main loop may wait for a message
+ *
+ *  \par Description
+ *       Returns #CS_WAKEUP_TIMEOUT, or less when the next self-clocked
+ *       background cycle is due sooner.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Milliseconds to wait, or #CFE_SB_POLL when a cycle is due
+ */
+int32 CS_GetPipeTimeout(void);
+
+/**
+ * \brief Checksums in the background while the command pipe is idle
+ *
+ *  \par Description
+ *       Called when the command pipe receive times out with nothing to
+ *       do. Continues the sequential sweep for up to the idle budget
+ *       and adds the bytes to the idle telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing while the idle budget is zero, background
+ *       checksumming is disabled, or a recompute or one shot is in
+ *       progress. The byte budgets of the scheduled cycles are not
+ *       touched, since each cycle resets them before it starts.
+ */
+void CS_HarvestIdleTime(void);
+
 /**
  * \brief Process a disable overall background checking command
  *
@@ -278,4 +357,127 @@ void CS_OneShotCmd(const CS_OneShotCmd_t *CmdPtr);
  */
 void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr);
 
+/**
+ * \brief Process a calibrate CRC kernels command
+ *
+ *  \par Description
+ *       Re-times the kernels that can compute the default algorithm
+ *       and selects the fastest, see #CS_CalibrateDefaultCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       May be sent while a recompute or one shot is in progress,
+ *       all kernels give identical results.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_CALIBRATE_CRC_CC
+ */
+void CS_CalibrateCRCCmd(const CS_NoArgsCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set background cycle time budget command
+ *
+ *  \par Description
+ *       Sets the number of microseconds each background cycle may
+ *       spend checksumming.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A budget of zero returns to checksumming a single chunk of
+ *       up to the maximum bytes per cycle on each cycle.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_CYCLE_TIME_BUDGET_CC
+ */
+void CS_SetCycleTimeBudgetCmd(const CS_SetCycleTimeBudgetCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set adaptive background cycle time target command
+ *
+ *  \par Description
+ *       Sets the number of microseconds the adaptive controller aims
+ *       for each background cycle to take, and clears the overshoot
+ *       statistics.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A target of zero turns the controller off and restores
+ *       #CS_DEFAULT_BYTES_PER_CYCLE.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_CYCLE_TIME_TARGET_CC
+ */
+void CS_SetCycleTimeTargetCmd(const CS_SetCycleTimeTargetCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set byte budget command
+ *
+ *  \par Description
+ *       Sets the bytes per cycle of one checksum type, or of recompute
+ *       and one shot child tasks, in the byte budget table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A budget of zero uses the shared bytes per cycle. The change
+ *       takes effect from the next background cycle. Budgets greater
+ *       than #CS_MAX_BUDGET_BYTES_PER_CYCLE are rejected, as they are
+ *       by the byte budget table validation.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_BYTES_PER_CYCLE_CC
+ */
+void CS_SetBytesPerCycleCmd(const CS_SetBytesPerCycleCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set scheduler mode command
+ *
+ *  \par Description
+ *       Selects whether the background cycle sweeps the tables in order,
+ *       checksums the most overdue entry first, shares each cycle
+ *       between the checksum types by weight, or takes one chunk from
+ *       each checksum type in turn.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The sequential sweep keeps its place while overdue entries are
+ *       checksummed, and continues once none are overdue.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_SCHEDULER_MODE_CC
+ */
+void CS_SetSchedulerModeCmd(const CS_SetSchedulerModeCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set pacing period command
+ *
+ *  \par Description
+ *       Sets the period of the background cycles CS starts on its own,
+ *       or turns them off to follow the background cycle message.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The first paced cycle is due at once, and the jitter
+ *       statistics start again.
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_PACING_PERIOD_CC
+ */
+void CS_SetPacingPeriodCmd(const CS_SetPacingPeriodCmd_t *CmdPtr);
+
+/**
+ * \brief Process a set idle bytes command
+ *
+ *  \par Description
+ *       Sets how many bytes CS checksums each time its command pipe
+ *       is idle, or turns idle time checksumming off.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CmdPtr Command pointer, verified non-null in CS_AppMain
+ *
+ *  \sa #CS_SET_IDLE_BYTES_CC
+ */
+void CS_SetIdleBytesCmd(const CS_SetIdleBytesCmd_t *CmdPtr);
+
 #endif
@@ -32,6 +32,8 @@
 #include <string.h>
 #include "cs_events.h"
 #include "cs_compute.h"
+#include "cs_crc.h"
+#include "cs_hash.h"
 #include "cs_utils.h"
 /**************************************************************************
  **
@@ -45,14 +47,16 @@
 /* and cFE core code segments                                      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry)
+CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                                    uint32 *ComputedCSValue, bool *DoneWithEntry)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
     uint32       NumBytesThisCycle       = 0;
     int32        NumBytesRemainingCycles = 0;
     uint32       NewChecksumValue        = 0;
+    uint32       NewChecksumHigh         = 0;
+    uint64       NewHashValue            = 0;
     CFE_Status_t Status                  = CFE_SUCCESS;
     *DoneWithEntry                       = false;
 
@@ -62,25 +66,42 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
     FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
     NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-    NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                 : NumBytesRemainingCycles);
+    NumBytesThisCycle = ((*BytesRemaining < NumBytesRemainingCycles) ? *BytesRemaining : NumBytesRemainingCycles);
 
-    NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                           ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+    if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+    {
+        CS_ComputeHash((void *)(FirstAddrThisCycle), NumBytesThisCycle, OffsetIntoCurrEntry,
+                       &ResultsEntry->TempHashState, ResultsEntry->Algorithm);
+    }
+    else
+    {
+        NewChecksumValue = CS_ComputeCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
+                                         ResultsEntry->TempChecksumValue, ResultsEntry->Algorithm);
+    }
 
     NumBytesRemainingCycles -= NumBytesThisCycle;
+    *BytesRemaining -= NumBytesThisCycle;
 
     if (NumBytesRemainingCycles <= 0)
     {
         /* We are finished CS'ing all of the parts for this Entry */
         *DoneWithEntry = true;
 
+        if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+        {
+            CS_FinishHash(&ResultsEntry->TempHashState, ResultsEntry->NumBytesToChecksum, ResultsEntry->Algorithm,
+                          &NewHashValue);
+            NewChecksumValue = (uint32)NewHashValue;
+            NewChecksumHigh  = (uint32)(NewHashValue >> 32);
+        }
+
         if (ResultsEntry->ComputedYet == true)
         {
             /* This is NOT the first time through this Entry.
              We have already computed a CS value for this Entry */
 
-            if (NewChecksumValue != ResultsEntry->ComparisonValue)
+            if ((NewChecksumValue != ResultsEntry->ComparisonValue) ||
+                (NewChecksumHigh != ResultsEntry->ComparisonValueHigh))
             {
                 /* If the just-computed value differ from the saved value */
                 Status = CS_ERROR;
@@ -93,8 +114,9 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
         else
         {
             /* This is the first time through this Entry */
-            ResultsEntry->ComputedYet     = true;
-            ResultsEntry->ComparisonValue = NewChecksumValue;
+            ResultsEntry->ComputedYet         = true;
+            ResultsEntry->ComparisonValue     = NewChecksumValue;
+            ResultsEntry->ComparisonValueHigh = NewChecksumHigh;
         }
 
         *ComputedCSValue                = NewChecksumValue;
@@ -111,18 +133,211 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
     return Status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that gets the extent of a sub-range of EEPROM,      */
+/* Memory, OS and cFE core code segment entries                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_GetEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange,
+                                uint32 *SubRangeOffset, uint32 *SubRangeBytes)
+{
+    uint32 NumBytes     = ResultsEntry->NumBytesToChecksum;
+    uint32 SubRangeSize = 0;
+    uint64 Offset       = 0;
+
+    /* Round up so that only the last sub-range can be short */
+    SubRangeSize = (NumBytes / CS_NUM_SUB_RANGES) + ((NumBytes % CS_NUM_SUB_RANGES) != 0);
+    Offset       = (uint64)SubRange * SubRangeSize;
+
+    if (Offset > NumBytes)
+    {
+        Offset = NumBytes;
+    }
+
+    *SubRangeOffset = (uint32)Offset;
+    *SubRangeBytes  = ((NumBytes - *SubRangeOffset) < SubRangeSize) ? (NumBytes - *SubRangeOffset) : SubRangeSize;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that merges the sub-range checksums of an EEPROM,   */
+/* Memory, OS or cFE core code segment entry                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_MergeEepromMemorySubRanges(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
+                                           bool *DoneWithEntry)
+{
+    uint32       NewChecksumValue = 0;
+    uint32       SubRangeOffset   = 0;
+    uint32       SubRangeBytes    = 0;
+    uint16       SubRange         = 0;
+    CFE_Status_t Status           = CFE_SUCCESS;
+    *DoneWithEntry                = false;
+
+    if (ResultsEntry->SubRangeMask == CS_ALL_SUB_RANGES_MASK)
+    {
+        /* Fold each sub-range onto the end of the ones before it */
+        NewChecksumValue = ResultsEntry->SubRangeChecksum[0];
+        *DoneWithEntry   = true;
+
+        for (SubRange = 1; (SubRange < CS_NUM_SUB_RANGES) && *DoneWithEntry; SubRange++)
+        {
+            CS_GetEepromMemorySubRange(ResultsEntry, SubRange, &SubRangeOffset, &SubRangeBytes);
+
+            *DoneWithEntry = CS_CombineCRC(NewChecksumValue, ResultsEntry->SubRangeChecksum[SubRange], SubRangeBytes,
+                                           ResultsEntry->Algorithm, &NewChecksumValue);
+        }
+    }
+
+    if (*DoneWithEntry)
+    {
+        if (ResultsEntry->ComputedYet == true)
+        {
+            if (NewChecksumValue != ResultsEntry->ComparisonValue)
+            {
+                Status = CS_ERROR;
+            }
+        }
+        else
+        {
+            /* This is the first time the entry has been merged */
+            ResultsEntry->ComputedYet     = true;
+            ResultsEntry->ComparisonValue = NewChecksumValue;
+        }
+
+        *ComputedCSValue = NewChecksumValue;
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that decides whether to split a recompute of an     */
+/* EEPROM, Memory, OS or cFE core code segment entry               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_SplitEepromMemory(uint16 Table, const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    bool Split = false;
+
+    /* Only CRCs can be merged, and a single sub-range is no faster than the whole entry */
+    if (((Table == CS_OSCORE) || (Table == CS_CFECORE) || (Table == CS_MEMORY_TABLE)) && (CS_NUM_SUB_RANGES > 1) &&
+        (ResultsEntry->NumBytesToChecksum >= CS_SPLIT_RECOMPUTE_MIN_BYTES) &&
+        !CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+    {
+        Split = true;
+    }
+
+    return Split;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checksums a sub-range of an EEPROM, Memory, OS */
+/* or cFE core code segment entry at a share of the child budget   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_ChecksumEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange)
+{
+    uint32 SubRangeOffset    = 0;
+    uint32 SubRangeBytes     = 0;
+    uint32 NumBytesThisCycle = 0;
+    uint32 NewChecksumValue  = 0;
+
+    CS_GetEepromMemorySubRange(ResultsEntry, SubRange, &SubRangeOffset, &SubRangeBytes);
+
+    while (SubRangeBytes > 0)
+    {
+        /* Every sub-range task takes an equal share, so together they use no more than one recompute task */
+        NumBytesThisCycle = CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET) / CS_NUM_SUB_RANGES;
+
+        if (NumBytesThisCycle == 0)
+        {
+            NumBytesThisCycle = 1;
+        }
+
+        if (NumBytesThisCycle > SubRangeBytes)
+        {
+            NumBytesThisCycle = SubRangeBytes;
+        }
+
+        NewChecksumValue = CS_ComputeCRC((void *)(ResultsEntry->StartAddress + SubRangeOffset), NumBytesThisCycle,
+                                         NewChecksumValue, ResultsEntry->Algorithm);
+
+        SubRangeOffset += NumBytesThisCycle;
+        SubRangeBytes -= NumBytesThisCycle;
+
+        OS_TaskDelay(CS_CHILD_TASK_DELAY);
+    }
+
+    return NewChecksumValue;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes the checksum of an EEPROM, Memory, OS */
+/* or cFE core code segment entry on one child task per sub-range  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_ComputeEepromMemorySplit(uint16 WorkerID, CS_Res_EepromMemory_Table_Entry_t *ResultsEntry,
+                                         uint32 *ComputedCSValue, bool *DoneWithEntry)
+{
+    uint32       NotStartedMask = 0;
+    uint16       SubRange       = 0;
+    CFE_Status_t Status         = CFE_SUCCESS;
+
+    ResultsEntry->SubRangeMask = 0;
+
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        if (CS_StartSubRangeTask(WorkerID, SubRange, CS_SubRangeChildTask) != CFE_SUCCESS)
+        {
+            NotStartedMask |= ((uint32)1 << SubRange);
+        }
+    }
+
+    /* A sub-range that could not be handed to its task is checksummed by the worker itself */
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        if ((NotStartedMask & ((uint32)1 << SubRange)) != 0)
+        {
+            CS_FinishSubRange(WorkerID, SubRange, CS_ChecksumEepromMemorySubRange(ResultsEntry, SubRange));
+        }
+    }
+
+    while (CS_SubRangesRunning(WorkerID))
+    {
+        OS_TaskDelay(CS_CHILD_TASK_DELAY);
+    }
+
+    Status = CS_MergeEepromMemorySubRanges(ResultsEntry, ComputedCSValue, DoneWithEntry);
+
+    if (*DoneWithEntry)
+    {
+        /* A merged CRC has no upper half */
+        ResultsEntry->ComparisonValueHigh = 0;
+    }
+
+    return Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS function that computes the checksum for Tables               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                              uint32 *ComputedCSValue, bool *DoneWithEntry)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
     uint32       NumBytesThisCycle       = 0;
     int32        NumBytesRemainingCycles = 0;
     uint32       NewChecksumValue        = 0;
+    uint32       NewChecksumHigh         = 0;
+    uint64       NewHashValue            = 0;
     CFE_Status_t Status                  = CFE_SUCCESS;
     CFE_Status_t Result                  = CFE_SUCCESS;
     CFE_Status_t ResultShare             = 0;
@@ -214,13 +429,21 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
         FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
         NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-        NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                     : NumBytesRemainingCycles);
+        NumBytesThisCycle = ((*BytesRemaining < NumBytesRemainingCycles) ? *BytesRemaining : NumBytesRemainingCycles);
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                               ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+        if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+        {
+            CS_ComputeHash((void *)(FirstAddrThisCycle), NumBytesThisCycle, OffsetIntoCurrEntry,
+                           &ResultsEntry->TempHashState, ResultsEntry->Algorithm);
+        }
+        else
+        {
+            NewChecksumValue = CS_ComputeCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
+                                             ResultsEntry->TempChecksumValue, ResultsEntry->Algorithm);
+        }
 
         NumBytesRemainingCycles -= NumBytesThisCycle;
+        *BytesRemaining -= NumBytesThisCycle;
 
         /* Have we finished all of the parts for this Entry */
         if (NumBytesRemainingCycles <= 0)
@@ -241,11 +464,20 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
                 /* No last second updates, post the result for this table */
                 *DoneWithEntry = true;
 
+                if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+                {
+                    CS_FinishHash(&ResultsEntry->TempHashState, ResultsEntry->NumBytesToChecksum,
+                                  ResultsEntry->Algorithm, &NewHashValue);
+                    NewChecksumValue = (uint32)NewHashValue;
+                    NewChecksumHigh  = (uint32)(NewHashValue >> 32);
+                }
+
                 if (ResultsEntry->ComputedYet == true)
                 {
                     /* This is NOT the first time through this Entry.
                        We have already computed a CS value for this Entry */
-                    if (NewChecksumValue != ResultsEntry->ComparisonValue)
+                    if ((NewChecksumValue != ResultsEntry->ComparisonValue) ||
+                        (NewChecksumHigh != ResultsEntry->ComparisonValueHigh))
                     {
                         /* If the just-computed value differ from the saved value */
                         Status = CS_ERROR;
@@ -258,8 +490,9 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
                 else
                 {
                     /* This is the first time through this Entry */
-                    ResultsEntry->ComputedYet     = true;
-                    ResultsEntry->ComparisonValue = NewChecksumValue;
+                    ResultsEntry->ComputedYet         = true;
+                    ResultsEntry->ComparisonValue     = NewChecksumValue;
+                    ResultsEntry->ComparisonValueHigh = NewChecksumHigh;
                 }
 
                 *ComputedCSValue                = NewChecksumValue;
@@ -304,13 +537,16 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
 /* CS function that computes the checksum for Apps                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining, uint32 *ComputedCSValue,
+                           bool *DoneWithEntry)
 {
     uint32       OffsetIntoCurrEntry     = 0;
     cpuaddr      FirstAddrThisCycle      = 0;
     uint32       NumBytesThisCycle       = 0;
     int32        NumBytesRemainingCycles = 0;
     uint32       NewChecksumValue        = 0;
+    uint32       NewChecksumHigh         = 0;
+    uint64       NewHashValue            = 0;
     CFE_Status_t Status                  = CFE_SUCCESS;
     CFE_Status_t Result;
     CFE_Status_t ResultGetResourceID   = CS_ERROR;
@@ -371,24 +607,41 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
         FirstAddrThisCycle      = ResultsEntry->StartAddress + OffsetIntoCurrEntry;
         NumBytesRemainingCycles = ResultsEntry->NumBytesToChecksum - OffsetIntoCurrEntry;
 
-        NumBytesThisCycle = ((CS_AppData.MaxBytesPerCycle < NumBytesRemainingCycles) ? CS_AppData.MaxBytesPerCycle
-                                                                                     : NumBytesRemainingCycles);
+        NumBytesThisCycle = ((*BytesRemaining < NumBytesRemainingCycles) ? *BytesRemaining : NumBytesRemainingCycles);
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
-                                               ResultsEntry->TempChecksumValue, CS_DEFAULT_ALGORITHM);
+        if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+        {
+            CS_ComputeHash((void *)(FirstAddrThisCycle), NumBytesThisCycle, OffsetIntoCurrEntry,
+                           &ResultsEntry->TempHashState, ResultsEntry->Algorithm);
+        }
+        else
+        {
+            NewChecksumValue = CS_ComputeCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle,
+                                             ResultsEntry->TempChecksumValue, ResultsEntry->Algorithm);
+        }
 
         NumBytesRemainingCycles -= NumBytesThisCycle;
+        *BytesRemaining -= NumBytesThisCycle;
 
         if (NumBytesRemainingCycles <= 0)
         {
             /* We are finished CS'ing all of the parts for this Entry */
             *DoneWithEntry = true;
 
+            if (CS_IS_HASH_ALGORITHM(ResultsEntry->Algorithm))
+            {
+                CS_FinishHash(&ResultsEntry->TempHashState, ResultsEntry->NumBytesToChecksum, ResultsEntry->Algorithm,
+                              &NewHashValue);
+                NewChecksumValue = (uint32)NewHashValue;
+                NewChecksumHigh  = (uint32)(NewHashValue >> 32);
+            }
+
             if (ResultsEntry->ComputedYet == true)
             {
                 /* This is NOT the first time through this Entry.
                  We have already computed a CS value for this Entry */
-                if (NewChecksumValue != ResultsEntry->ComparisonValue)
+                if ((NewChecksumValue != ResultsEntry->ComparisonValue) ||
+                    (NewChecksumHigh != ResultsEntry->ComparisonValueHigh))
                 {
                     /* If the just-computed value differ from the saved value */
                     Status = CS_ERROR;
@@ -401,8 +654,9 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
             else
             {
                 /* This is the first time through this Entry */
-                ResultsEntry->ComputedYet     = true;
-                ResultsEntry->ComparisonValue = NewChecksumValue;
+                ResultsEntry->ComputedYet         = true;
+                ResultsEntry->ComparisonValue     = NewChecksumValue;
+                ResultsEntry->ComparisonValueHigh = NewChecksumHigh;
             }
 
             *ComputedCSValue                = NewChecksumValue;
@@ -440,15 +694,14 @@ CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *Compu
 void CS_RecomputeEepromMemoryChildTask(void)
 {
     uint32                             NewChecksumValue = 0;
+    uint32                             BytesRemaining   = 0;
     char                               TableType[CS_TABLETYPE_NAME_SIZE];
     CS_Res_EepromMemory_Table_Entry_t *ResultsEntry         = NULL;
+    uint16                             WorkerID             = 0;
     uint16                             Table                = 0;
     uint16                             EntryID              = 0;
-    uint16                             PreviousState        = CS_STATE_EMPTY;
     bool                               DoneWithEntry        = false;
-    uint16                             PreviousDefState     = CS_STATE_EMPTY;
     bool                               DefEntryFound        = false;
-    uint16                             DefEntryID           = 0;
     CS_Def_EepromMemory_Table_Entry_t *DefTblPtr            = NULL;
     uint16                             MaxDefEntries        = 0;
     CFE_TBL_Handle_t                   DefTblHandle         = CFE_TBL_BAD_TABLE_HANDLE;
@@ -456,14 +709,17 @@ void CS_RecomputeEepromMemoryChildTask(void)
 
     strncpy(TableType, "Undef Tbl", CS_TABLETYPE_NAME_SIZE); /* Initialize table type string */
 
-    Table        = CS_AppData.ChildTaskTable;
-    EntryID      = CS_AppData.ChildTaskEntryID;
-    ResultsEntry = CS_AppData.RecomputeEepromMemoryEntryPtr;
+    WorkerID = CS_FindRecomputeWorker();
 
-    /* we want to  make sure that the entry isn't being checksummed in the
-     background at the same time we are recomputing */
-    PreviousState       = ResultsEntry->State;
-    ResultsEntry->State = CS_STATE_DISABLED;
+    if (WorkerID >= CS_MAX_RECOMPUTE_WORKERS)
+    {
+        return;
+    }
+
+    /* The worker holds the entry until it finishes, so no other worker recomputes it at the same time */
+    Table        = CS_AppData.RecomputeWorkers[WorkerID].Table;
+    EntryID      = CS_AppData.RecomputeWorkers[WorkerID].EntryID;
+    ResultsEntry = CS_AppData.RecomputeWorkers[WorkerID].EntryPtr;
 
     /* Set entry as if this is the first time we are computing the checksum,
        since we want the entry to take on the new value */
@@ -471,6 +727,7 @@ void CS_RecomputeEepromMemoryChildTask(void)
     ResultsEntry->ByteOffset        = 0;
     ResultsEntry->TempChecksumValue = 0;
     ResultsEntry->ComputedYet       = false;
+    ResultsEntry->SubRangeMask      = 0;
 
     /* Update the definition table entry as well.  We need to determine which memory type is
        being updated as well as which entry in the table is being updated. */
@@ -498,19 +755,23 @@ void CS_RecomputeEepromMemoryChildTask(void)
             if ((ResultsEntry->StartAddress == DefTblPtr[EntryID].StartAddress) &&
                 (DefTblPtr[EntryID].State != CS_STATE_EMPTY))
             {
-                DefEntryFound            = true;
-                PreviousDefState         = DefTblPtr[EntryID].State;
-                DefTblPtr[EntryID].State = CS_STATE_DISABLED;
-                DefEntryID               = EntryID;
-                CS_ResetTablesTblResultEntry(TablesTblResultEntry);
-                CFE_TBL_Modified(DefTblHandle);
+                DefEntryFound = true;
+                CS_ResetRecomputeDefTableEntry(TablesTblResultEntry, DefTblHandle);
             }
         }
     }
 
+    /* Large entries are split across child tasks, and anything the split
+       could not finish is checksummed in order as before */
+    if (CS_SplitEepromMemory(Table, ResultsEntry))
+    {
+        CS_ComputeEepromMemorySplit(WorkerID, ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+    }
+
     while (!DoneWithEntry)
     {
-        CS_ComputeEepromMemory(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        BytesRemaining = CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET);
+        CS_ComputeEepromMemory(ResultsEntry, &BytesRemaining, &NewChecksumValue, &DoneWithEntry);
 
         OS_TaskDelay(CS_CHILD_TASK_DELAY);
     }
@@ -522,15 +783,10 @@ void CS_RecomputeEepromMemoryChildTask(void)
     ResultsEntry->ByteOffset        = 0;
     ResultsEntry->ComputedYet       = true;
 
-    /* restore the entry's previous state */
-    ResultsEntry->State = PreviousState;
-
-    /* Restore the definition table if we found one earlier */
+    /* Reset the definition table's entry again if we found one earlier */
     if (DefEntryFound)
     {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(TablesTblResultEntry);
-        CFE_TBL_Modified(DefTblHandle);
+        CS_ResetRecomputeDefTableEntry(TablesTblResultEntry, DefTblHandle);
     }
 
     /* send event message */
@@ -558,8 +814,25 @@ void CS_RecomputeEepromMemoryChildTask(void)
                       "%s entry %d recompute finished. New baseline is 0X%08X", TableType, EntryID,
                       (unsigned int)NewChecksumValue);
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
+    CS_ReleaseRecomputeWorker(WorkerID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS sub-range task work for checksumming one sub-range of a      */
+/* split recompute                                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_SubRangeChildTask(void)
+{
+    uint16 WorkerID = 0;
+    uint16 SubRange = 0;
+
+    if (CS_FindSubRangeTask(&WorkerID, &SubRange))
+    {
+        CS_FinishSubRange(WorkerID, SubRange,
+                          CS_ChecksumEepromMemorySubRange(CS_AppData.RecomputeWorkers[WorkerID].EntryPtr, SubRange));
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -570,25 +843,26 @@ void CS_RecomputeEepromMemoryChildTask(void)
 void CS_RecomputeAppChildTask(void)
 {
     uint32                    NewChecksumValue = 0;
+    uint32                    BytesRemaining   = 0;
     CS_Res_App_Table_Entry_t *ResultsEntry     = NULL;
-    uint16                    PreviousState    = CS_STATE_EMPTY;
+    uint16                    WorkerID         = 0;
     bool                      DoneWithEntry    = false;
     CFE_Status_t              Status           = CS_ERROR;
-    uint16                    PreviousDefState = CS_STATE_EMPTY;
     bool                      DefEntryFound    = false;
     uint16                    DefEntryID       = 0;
     CS_Def_App_Table_Entry_t *DefTblPtr        = NULL;
     uint16                    MaxDefEntries    = 0;
     CFE_TBL_Handle_t          DefTblHandle     = CFE_TBL_BAD_TABLE_HANDLE;
 
-    /* Get the variables to use from the global data */
-    ResultsEntry = CS_AppData.RecomputeAppEntryPtr;
+    WorkerID = CS_FindRecomputeWorker();
 
-    /* we want to  make sure that the entry isn't being checksummed in the
-     background at the same time we are recomputing */
+    if (WorkerID >= CS_MAX_RECOMPUTE_WORKERS)
+    {
+        return;
+    }
 
-    PreviousState       = ResultsEntry->State;
-    ResultsEntry->State = CS_STATE_DISABLED;
+    /* The worker holds the entry until it finishes, so no other worker recomputes it at the same time */
+    ResultsEntry = CS_AppData.RecomputeWorkers[WorkerID].EntryPtr;
 
     /* Set entry as if this is the first time we are computing the checksum,
        since we want the entry to take on the new value */
@@ -610,11 +884,8 @@ void CS_RecomputeAppChildTask(void)
         if ((strncmp(ResultsEntry->Name, DefTblPtr[DefEntryID].Name, OS_MAX_API_NAME) == 0) &&
             (DefTblPtr[DefEntryID].State != CS_STATE_EMPTY))
         {
-            DefEntryFound               = true;
-            PreviousDefState            = DefTblPtr[DefEntryID].State;
-            DefTblPtr[DefEntryID].State = CS_STATE_DISABLED;
-            CS_ResetTablesTblResultEntry(CS_AppData.AppResTablesTblPtr);
-            CFE_TBL_Modified(DefTblHandle);
+            DefEntryFound = true;
+            CS_ResetRecomputeDefTableEntry(CS_AppData.AppResTablesTblPtr, DefTblHandle);
         }
         else
         {
@@ -624,7 +895,8 @@ void CS_RecomputeAppChildTask(void)
 
     while (!DoneWithEntry)
     {
-        Status = CS_ComputeApp(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        BytesRemaining = CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET);
+        Status = CS_ComputeApp(ResultsEntry, &BytesRemaining, &NewChecksumValue, &DoneWithEntry);
 
         if (Status == CS_ERR_NOT_FOUND)
         {
@@ -635,15 +907,10 @@ void CS_RecomputeAppChildTask(void)
     }
     /* The new checksum value is stored in the table by the above functions */
 
-    /* restore the entry's state */
-    ResultsEntry->State = PreviousState;
-
-    /* Restore the definition table if we found one earlier */
+    /* Reset the definition table's entry again if we found one earlier */
     if (DefEntryFound)
     {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(CS_AppData.AppResTablesTblPtr);
-        CFE_TBL_Modified(DefTblHandle);
+        CS_ResetRecomputeDefTableEntry(CS_AppData.AppResTablesTblPtr, DefTblHandle);
     }
 
     if (Status == CS_ERR_NOT_FOUND)
@@ -664,8 +931,7 @@ void CS_RecomputeAppChildTask(void)
                           (unsigned int)NewChecksumValue);
     }
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
+    CS_ReleaseRecomputeWorker(WorkerID);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -676,25 +942,26 @@ void CS_RecomputeAppChildTask(void)
 void CS_RecomputeTablesChildTask(void)
 {
     uint32                       NewChecksumValue = 0;
+    uint32                       BytesRemaining   = 0;
     CS_Res_Tables_Table_Entry_t *ResultsEntry     = NULL;
-    uint16                       PreviousState    = CS_STATE_EMPTY;
+    uint16                       WorkerID         = 0;
     bool                         DoneWithEntry    = false;
     CFE_Status_t                 Status           = CS_ERROR;
-    uint16                       PreviousDefState = CS_STATE_EMPTY;
     bool                         DefEntryFound    = false;
     uint16                       DefEntryID       = 0;
     CS_Def_Tables_Table_Entry_t *DefTblPtr        = NULL;
     uint16                       MaxDefEntries    = 0;
     CFE_TBL_Handle_t             DefTblHandle     = CFE_TBL_BAD_TABLE_HANDLE;
 
-    /* Get the variables to use from the global data */
-    ResultsEntry = CS_AppData.RecomputeTablesEntryPtr;
+    WorkerID = CS_FindRecomputeWorker();
 
-    /* we want to  make sure that the entry isn't being checksummed in the
-     background at the same time we are recomputing */
+    if (WorkerID >= CS_MAX_RECOMPUTE_WORKERS)
+    {
+        return;
+    }
 
-    PreviousState       = ResultsEntry->State;
-    ResultsEntry->State = CS_STATE_DISABLED;
+    /* The worker holds the entry until it finishes, so no other worker recomputes it at the same time */
+    ResultsEntry = CS_AppData.RecomputeWorkers[WorkerID].EntryPtr;
 
     /* Set entry as if this is the first time we are computing the checksum,
      since we want the entry to take on the new value */
@@ -716,11 +983,8 @@ void CS_RecomputeTablesChildTask(void)
         if ((strncmp(ResultsEntry->Name, DefTblPtr[DefEntryID].Name, CFE_TBL_MAX_FULL_NAME_LEN) == 0) &&
             (DefTblPtr[DefEntryID].State != CS_STATE_EMPTY))
         {
-            DefEntryFound               = true;
-            PreviousDefState            = DefTblPtr[DefEntryID].State;
-            DefTblPtr[DefEntryID].State = CS_STATE_DISABLED;
-            CS_ResetTablesTblResultEntry(CS_AppData.TblResTablesTblPtr);
-            CFE_TBL_Modified(DefTblHandle);
+            DefEntryFound = true;
+            CS_ResetRecomputeDefTableEntry(CS_AppData.TblResTablesTblPtr, DefTblHandle);
         }
         else
         {
@@ -730,7 +994,8 @@ void CS_RecomputeTablesChildTask(void)
 
     while (!DoneWithEntry)
     {
-        Status = CS_ComputeTables(ResultsEntry, &NewChecksumValue, &DoneWithEntry);
+        BytesRemaining = CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET);
+        Status = CS_ComputeTables(ResultsEntry, &BytesRemaining, &NewChecksumValue, &DoneWithEntry);
 
         if (Status == CS_ERR_NOT_FOUND)
         {
@@ -759,19 +1024,13 @@ void CS_RecomputeTablesChildTask(void)
                           (unsigned int)NewChecksumValue);
     }
 
-    /* restore the entry's state */
-    ResultsEntry->State = PreviousState;
-
-    /* Restore the definition table if we found one earlier */
+    /* Reset the definition table's entry again if we found one earlier */
     if (DefEntryFound)
     {
-        DefTblPtr[DefEntryID].State = PreviousDefState;
-        CS_ResetTablesTblResultEntry(CS_AppData.TblResTablesTblPtr);
-        CFE_TBL_Modified(DefTblHandle);
+        CS_ResetRecomputeDefTableEntry(CS_AppData.TblResTablesTblPtr, DefTblHandle);
     }
 
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CFE_ES_ExitChildTask();
+    CS_ReleaseRecomputeWorker(WorkerID);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -792,12 +1051,13 @@ void CS_OneShotChildTask(void)
     FirstAddrThisCycle      = CS_AppData.HkPacket.Payload.LastOneShotAddress;
     MaxBytesPerCycle        = CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle;
 
-    while (NumBytesRemainingCycles > 0)
+    /* A cancel takes effect at the next chunk, the task itself keeps running */
+    while ((NumBytesRemainingCycles > 0) && (CS_AppData.OneShotCancelled == false))
     {
         NumBytesThisCycle = ((MaxBytesPerCycle < NumBytesRemainingCycles) ? MaxBytesPerCycle : NumBytesRemainingCycles);
 
-        NewChecksumValue = CFE_ES_CalculateCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle, NewChecksumValue,
-                                               CS_DEFAULT_ALGORITHM);
+        NewChecksumValue =
+            CS_ComputeCRC((void *)(FirstAddrThisCycle), NumBytesThisCycle, NewChecksumValue, CS_DEFAULT_ALGORITHM);
 
         /* Update the remainders for the next cycle */
         FirstAddrThisCycle += NumBytesThisCycle;
@@ -806,20 +1066,48 @@ void CS_OneShotChildTask(void)
         OS_TaskDelay(CS_CHILD_TASK_DELAY);
     }
 
-    /*Checksum Calculation is done! */
+    if (CS_AppData.OneShotCancelled == false)
+    {
+        /*Checksum Calculation is done! */
 
-    /* put the new checksum value in the baseline */
-    CS_AppData.HkPacket.Payload.LastOneShotChecksum = NewChecksumValue;
+        /* put the new checksum value in the baseline */
+        CS_AppData.HkPacket.Payload.LastOneShotChecksum = NewChecksumValue;
 
-    /* send event message */
-    CFE_EVS_SendEvent(CS_ONESHOT_FINISHED_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "OneShot checksum on Address: 0x%08X, size %d completed. Checksum =  0x%08X",
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotAddress),
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotSize),
-                      (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotChecksum));
+        /* send event message */
+        CFE_EVS_SendEvent(CS_ONESHOT_FINISHED_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "OneShot checksum on Address: 0x%08X, size %d completed. Checksum =  0x%08X",
+                          (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotAddress),
+                          (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotSize),
+                          (unsigned int)(CS_AppData.HkPacket.Payload.LastOneShotChecksum));
+    }
 
+    /* The cancel is cleared first, so it can never carry over to the next one shot */
+    CS_AppData.OneShotCancelled                   = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress = false;
-    CS_AppData.ChildTaskID                = CFE_ES_TASKID_UNDEFINED;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS worker task, created at startup, that runs the recomputes,   */
+/* sub-ranges and one shots handed to it                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_WorkerTask(void)
+{
+    osal_id_t                     QueueID  = OS_OBJECT_ID_UNDEFINED;
+    CFE_ES_ChildTaskMainFuncPtr_t WorkFunc = NULL;
+    size_t                        WorkSize = 0;
+
+    QueueID = CS_FindWorkerQueue();
+
+    /* Wait for work for as long as the app runs, the queue only fails if it is gone */
+    while (OS_QueueGet(QueueID, &WorkFunc, sizeof(WorkFunc), &WorkSize, OS_PEND) == OS_SUCCESS)
+    {
+        if ((WorkSize == sizeof(WorkFunc)) && (WorkFunc != NULL))
+        {
+            WorkFunc();
+        }
+    }
 
     CFE_ES_ExitChildTask();
 }
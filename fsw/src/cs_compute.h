@@ -32,23 +32,39 @@
 #include "cfe.h"
 #include "cs_tbldefs.h"
 
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Sub-range mask of a results entry whose sub-ranges are all computed
+ */
+#define CS_ALL_SUB_RANGES_MASK ((uint32)(((uint64)1 << CS_NUM_SUB_RANGES) - 1))
+
 /**
  * \brief Computes checksums on EEPROM or Memory types
  *
  *  \par Description
- *       Computes checksums up to MaxBytesPerCycle bytes every call. This
+ *       Computes checksums up to BytesRemaining bytes every call. This
  *       function is used to compute checksums for EEPROM, Memory, the
  *       OS code segment and the cFE core code segment
  *
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        For an entry using a 64 bit algorithm both halves of the
+ *        checksum are compared, and ComputedCSValue is the lower half.
  *
  *  \param [in]   ResultsEntry         A pointer to the entry in a table
  *                                     that we want to compute the
  *                                     checksum on.  Verified non-null by
  *                                     calling function.
  *
+ *  \param [in,out] BytesRemaining     Number of bytes that may still be
+ *                                     checksummed this cycle, reduced by
+ *                                     the number checksummed by this call
+ *
  *  \param [out]  ComputedCSValue      Value used to determine the computed
  *                                     checksum, if completed
  *
@@ -60,24 +76,169 @@
  * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
  * \retval #CS_ERROR   \copybrief CS_ERROR
  */
-CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry);
+CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                                    uint32 *ComputedCSValue, bool *DoneWithEntry);
+
+/**
+ * \brief Gets the extent of one sub-range of an EEPROM or Memory entry
+ *
+ *  \par Description
+ *       Divides the entry into #CS_NUM_SUB_RANGES sub-ranges of equal
+ *       size, the last one taking whatever remains, and returns where
+ *       the requested sub-range lies within the entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Sub-ranges past the end of a small entry are empty.
+ *
+ *  \param [in]   ResultsEntry         A pointer to the entry in a table.
+ *                                     Verified non-null by calling function.
+ *
+ *  \param [in]   SubRange             The sub-range, less than
+ *                                     #CS_NUM_SUB_RANGES
+ *
+ *  \param [out]  SubRangeOffset       Offset of the sub-range from the
+ *                                     start of the entry
+ *
+ *  \param [out]  SubRangeBytes        Number of bytes in the sub-range
+ */
+void CS_GetEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange,
+                                uint32 *SubRangeOffset, uint32 *SubRangeBytes);
+
+/**
+ * \brief Merges the sub-range checksums of an EEPROM or Memory entry
+ *
+ *  \par Description
+ *       Once every sub-range has been computed, combines their checksums
+ *       into the checksum of the whole entry. The result is checked
+ *       against, or becomes, the entry's comparison value exactly as in
+ *       #CS_ComputeEepromMemory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The sub-range checksums are kept, so after re-computing a
+ *        single sub-range the entry can be merged again without
+ *        checksumming the others. Only CRC algorithms can be merged,
+ *        an entry using a 64 bit algorithm is never done.
+ *
+ *  \param [in]   ResultsEntry         A pointer to the entry in a table
+ *                                     that we want to merge the
+ *                                     checksum of.  Verified non-null by
+ *                                     calling function.
+ *
+ *  \param [out]  ComputedCSValue      Value used to determine the computed
+ *                                     checksum, if completed
+ *
+ *  \param [out]  DoneWithEntry        Value that specifies whether or not
+ *                                     every sub-range was computed and
+ *                                     merged during this call.
+ *
+ * \return Execution status
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ * \retval #CS_ERROR   \copybrief CS_ERROR
+ */
+CFE_Status_t CS_MergeEepromMemorySubRanges(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
+                                           bool *DoneWithEntry);
+
+/**
+ * \brief Decides whether to split the recompute of an EEPROM or Memory entry
+ *
+ *  \par Description
+ *       The recompute of the OS or cFE core code segment, or of a Memory
+ *       entry, of at least #CS_SPLIT_RECOMPUTE_MIN_BYTES bytes is split
+ *       into one child task per sub-range.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Entries using a 64 bit algorithm can not be merged, so they are
+ *        never split.
+ *
+ *  \param [in]   Table                The table of the entry
+ *
+ *  \param [in]   ResultsEntry         A pointer to the entry in a table.
+ *                                     Verified non-null by calling function.
+ *
+ *  \return Boolean split response
+ *  \retval true  The recompute is split
+ *  \retval false The recompute is checksummed in order
+ */
+bool CS_SplitEepromMemory(uint16 Table, const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry);
+
+/**
+ * \brief Checksums one sub-range of an EEPROM or Memory entry in chunks
+ *
+ *  \par Description
+ *       Checksums the sub-range a chunk at a time, delaying
+ *       #CS_CHILD_TASK_DELAY milliseconds after each chunk.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Each chunk is the #CS_CHILD_TASK_BUDGET bytes of a recompute
+ *        divided by #CS_NUM_SUB_RANGES, so all the sub-range tasks of a
+ *        split recompute together never checksum more bytes per delay
+ *        than one recompute task.
+ *
+ *  \param [in]   ResultsEntry         A pointer to the entry in a table.
+ *                                     Verified non-null by calling function.
+ *
+ *  \param [in]   SubRange             The sub-range, less than
+ *                                     #CS_NUM_SUB_RANGES
+ *
+ *  \return The checksum of the sub-range
+ */
+uint32 CS_ChecksumEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange);
+
+/**
+ * \brief Computes the checksum of an EEPROM or Memory entry on one child
+ *        task per sub-range
+ *
+ *  \par Description
+ *       Hands each sub-range of the entry held by the recompute worker
+ *       to the worker's task for that sub-range, waits for them all to
+ *       finish and merges their checksums, giving the same value as
+ *       #CS_ComputeEepromMemory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        A sub-range that can not be handed to its task is checksummed
+ *        by the calling worker, so the entry is still checksummed in
+ *        full.
+ *
+ *  \param [in]   WorkerID             The recompute worker holding the entry
+ *
+ *  \param [in]   ResultsEntry         A pointer to the entry in a table
+ *                                     that we want to compute the
+ *                                     checksum on.  Verified non-null by
+ *                                     calling function.
+ *
+ *  \param [out]  ComputedCSValue      Value used to determine the computed
+ *                                     checksum, if completed
+ *
+ *  \param [out]  DoneWithEntry        Value that specifies whether or not
+ *                                     the sub-range checksums were merged
+ *
+ * \return Execution status
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ * \retval #CS_ERROR   \copybrief CS_ERROR
+ */
+CFE_Status_t CS_ComputeEepromMemorySplit(uint16 WorkerID, CS_Res_EepromMemory_Table_Entry_t *ResultsEntry,
+                                         uint32 *ComputedCSValue, bool *DoneWithEntry);
 
 /**
  * \brief Computes checksums on tables
  *
  *  \par Description
- *       Computes checksums up to MaxBytesPerCycle bytes every call. This
+ *       Computes checksums up to BytesRemaining bytes every call. This
  *       function is used to compute checksums for tables.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        For an entry using a 64 bit algorithm both halves of the
+ *        checksum are compared, and ComputedCSValue is the lower half.
  *
  *  \param [in]   ResultsEntry         A pointer to the entry in a table
  *                                     that we want to compute the
  *                                     checksum on.  Verified non-null in
  *                                     calling function.
  *
+ *  \param [in,out] BytesRemaining     Number of bytes that may still be
+ *                                     checksummed this cycle, reduced by
+ *                                     the number checksummed by this call
+ *
  *  \param [out]  ComputedCSValue      Value used to determine the computed
  *                                     checksum, if completed
  *
@@ -90,23 +251,29 @@ CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEn
  * \retval #CS_ERROR         \copybrief CS_ERROR
  * \retval #CS_ERR_NOT_FOUND \copydoc CS_ERR_NOT_FOUND
  */
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry);
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                              uint32 *ComputedCSValue, bool *DoneWithEntry);
 
 /**
  * \brief Computes checksums on applications
  *
  *  \par Description
- *       Computes checksums up to MaxBytesPerCycle bytes every call. This
+ *       Computes checksums up to BytesRemaining bytes every call. This
  *       function is used to compute checksums for applications.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        For an entry using a 64 bit algorithm both halves of the
+ *        checksum are compared, and ComputedCSValue is the lower half.
  *
  *  \param [in]   ResultsEntry         A pointer to the entry in a table
  *                                     that we want to compute the
  *                                     checksum on.  Verified non-null in
  *                                     calling function.
  *
+ *  \param [in,out] BytesRemaining     Number of bytes that may still be
+ *                                     checksummed this cycle, reduced by
+ *                                     the number checksummed by this call
+ *
  *  \param [out]  ComputedCSValue      Value used to determine the computed
  *                                     checksum, if completed
  *
@@ -119,58 +286,88 @@ CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32
  * \retval #CS_ERROR         \copybrief CS_ERROR
  * \retval #CS_ERR_NOT_FOUND \copydoc CS_ERR_NOT_FOUND
  */
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry);
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining, uint32 *ComputedCSValue,
+                           bool *DoneWithEntry);
 
 /**
- * \brief Child task main function for recomputing  baselines for
+ * \brief Child task work function for recomputing baselines for
  *        EEPROM and Memory types
  *
  *  \par Description
- *       Child task main function that is spawned when a recompute
- *       baseline command is received for EEPROM, Memory, OS code segment
- *       or cFE core code segment.
+ *       Child task work function that a recompute worker task runs
+ *       when a recompute baseline command is received for EEPROM,
+ *       Memory, OS code segment or cFE core code segment.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Returns to the worker task when the recompute finishes.
  */
 void CS_RecomputeEepromMemoryChildTask(void);
 
 /**
- * \brief Child task main function for recomputing baselines for
+ * \brief Sub-range task work for checksumming one sub-range of a
+ *        split recompute
+ *
+ *  \par Description
+ *       Work function a recompute worker hands to the sub-range task
+ *       for each sub-range of the entry it is recomputing.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The sub-range tasks of one worker run at the same time.
+ */
+void CS_SubRangeChildTask(void);
+
+/**
+ * \brief Child task work function for recomputing baselines for
  *        Tables
  *
  *  \par Description
- *       Child task main function that is spawned when a recompute
-        baseline command is received for a table.
+ *       Child task work function that a recompute worker task runs
+ *       when a recompute baseline command is received for a table.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Returns to the worker task when the recompute finishes.
  */
 void CS_RecomputeTablesChildTask(void);
 
 /**
- * \brief Child task main function for recomputing  baselines for
+ * \brief Child task work function for recomputing baselines for
  *        Applications
  *
  *  \par Description
-        Child task main function that is spawned when a recompute
- *       baseline command is received for Applications.
+ *       Child task work function that a recompute worker task runs
+ *       when a recompute baseline command is received for Applications.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Returns to the worker task when the recompute finishes.
  */
 void CS_RecomputeAppChildTask(void);
 
 /**
- * \brief Child task main function for computing a one shot calculatipn
+ * \brief Child task work function for computing a one shot calculation
  *
  *  \par Description
- *       Child task main function that is spawned when a one shot
- *       command is received.
+ *       Child task work function that the one shot child task runs
+ *       when a one shot command is received.
  *
  *  \par Assumptions, External Events, and Notes:
- *        Only one child task for CS can be running at any one time.
+ *        Only one one shot runs at a time. A cancel stops it at its
+ *        next chunk without reporting a checksum.
  */
 void CS_OneShotChildTask(void);
 
+/**
+ * \brief Main function of the worker tasks
+ *
+ *  \par Description
+ *       Main function of the recompute worker tasks, their sub-range
+ *       tasks and the one shot child task, all created at startup by
+ *       #CS_InitWorkerTasks. Each
+ *       waits on its own queue and runs the work functions handed to
+ *       it, one at a time, for as long as the app runs.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Exits if its queue can no longer be read.
+ */
+void CS_WorkerTask(void);
+
 #endif
@@ -0,0 +1,1028 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's CRC kernels
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_platform_cfg.h"
+#include "cs_mission_cfg.h"
+#include "cs_msgdefs.h"
+#include "cs_crc.h"
+#include "cs_crc_tables.h"
+#include <string.h>
+
+/*
+ * Processor CRC instructions are only used when the compiler can target
+ * them on a per-function basis and the processor can be queried for
+ * support at run time. Everything else uses the table-driven kernels.
+ */
+#if (CS_CRC_USE_HW_INSTRUCTIONS == true) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CS_CRC_HW_X86
+#define CS_CRC_HW_TARGET __attribute__((target("sse4.2")))
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#elif (CS_CRC_USE_HW_INSTRUCTIONS == true) && defined(__GNUC__) && defined(__aarch64__) && defined(__linux__)
+#define CS_CRC_HW_ARM64
+#define CS_CRC_HW_TARGET __attribute__((target("+crc")))
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#endif
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/* Reflected generator polynomials */
+#define CS_CRC16_POLY  0xA001     /* CRC-16/ARC, as used by CFE_ES_CalculateCRC */
+#define CS_CRC32_POLY  0xEDB88320 /* CRC-32 (IEEE 802.3) */
+#define CS_CRC32C_POLY 0x82F63B78 /* CRC-32C (Castagnoli) */
+
+/* The folding kernel consumes whole 16 byte blocks */
+#define CS_CRC_FOLD_BLOCK_BYTES 16
+
+/* Forces a copy of the kernel selection into each caller */
+#if defined(__GNUC__)
+#define CS_CRC_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define CS_CRC_ALWAYS_INLINE inline
+#endif
+
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+/*
+ * The slicing tables CS_Crc16Table, CS_Crc32Table and CS_Crc32cTable are
+ * constant arrays generated at build time into cs_crc_tables.h
+ */
+
+/* Set by CS_InitCRC when the processor implements the CRC instructions */
+static bool CS_CrcInstrSupported = false;
+
+/* Set by CS_InitCRC when the processor implements carry-less multiply */
+static bool CS_CrcClmulSupported = false;
+
+/*
+ * Whether the hardware kernel is currently used, kept per algorithm so
+ * calibrating one algorithm never changes the kernel of the other
+ */
+static bool CS_Crc32HwSelected  = false;
+static bool CS_Crc32cHwSelected = false;
+
+/* Whether CRC-16 is currently handed to CFE_ES_CalculateCRC */
+static bool CS_CrcCfeSelected = false;
+
+/* Scratch data timed by CS_CalibrateCRC */
+static uint8 CS_CrcCalibrationBuffer[CS_CRC_CALIBRATION_BYTES];
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that checks for processor CRC instructions          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_DetectCRCHardware(void)
+{
+#if defined(CS_CRC_HW_X86)
+    __builtin_cpu_init();
+    CS_CrcInstrSupported = (__builtin_cpu_supports("sse4.2") != 0);
+    CS_CrcClmulSupported = (__builtin_cpu_supports("pclmul") != 0 && __builtin_cpu_supports("sse4.1") != 0);
+#elif defined(CS_CRC_HW_ARM64)
+    CS_CrcInstrSupported = ((getauxval(AT_HWCAP) & HWCAP_CRC32) != 0);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that initializes the CRC kernels                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_InitCRC(void)
+{
+    CS_DetectCRCHardware();
+    CS_SelectCRCHardware(true);
+    CS_CrcCfeSelected = false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports whether CRC-32 has a hardware kernel   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_CRC32HardwareSupported(void)
+{
+#if defined(CS_CRC_HW_X86)
+    /* The x86 CRC instruction only implements CRC-32C, CRC-32 is folded */
+    return CS_CrcClmulSupported;
+#else
+    return CS_CrcInstrSupported;
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports whether CRC instructions are present   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_CRCHardwareSupported(void)
+{
+    return (CS_CrcInstrSupported || CS_CrcClmulSupported);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that selects or deselects the CRC instructions      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_SelectCRCHardware(bool UseHardware)
+{
+    CS_Crc32HwSelected  = (UseHardware && CS_CRC32HardwareSupported());
+    CS_Crc32cHwSelected = (UseHardware && CS_CrcInstrSupported);
+
+    return (CS_Crc32HwSelected || CS_Crc32cHwSelected);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that multiplies two polynomials modulo a reflected  */
+/* CRC polynomial whose x^0 term is held in TopBit                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_MultiplyModCRC(uint32 A, uint32 B, uint32 Poly, uint32 TopBit)
+{
+    uint32 Product = 0;
+    uint32 Mask;
+
+    for (Mask = TopBit; Mask != 0; Mask >>= 1)
+    {
+        if ((A & Mask) != 0)
+        {
+            Product ^= B;
+        }
+
+        /* Multiply B by x for the next, higher power term of A */
+        B = (B & 1) ? ((B >> 1) ^ Poly) : (B >> 1);
+    }
+
+    return Product;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that advances a CRC over a number of zero bytes     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_ShiftCRC(uint32 Crc, size_t NumZeroBytes, uint32 Poly, uint32 TopBit)
+{
+    uint32 Power = TopBit >> 8; /* x^8, one zero byte */
+    uint32 Shift = TopBit;      /* x^0 */
+
+    /* Build x^(8 * NumZeroBytes) mod Poly by repeated squaring */
+    while (NumZeroBytes != 0)
+    {
+        if ((NumZeroBytes & 1) != 0)
+        {
+            Shift = CS_MultiplyModCRC(Power, Shift, Poly, TopBit);
+        }
+
+        Power = CS_MultiplyModCRC(Power, Power, Poly, TopBit);
+        NumZeroBytes >>= 1;
+    }
+
+    return CS_MultiplyModCRC(Shift, Crc, Poly, TopBit);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that combines the CRC registers of adjacent, equal  */
+/* length sub-blocks into the register of the whole block          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_CombineCRCLanes(const uint32 Lane[CS_CRC_LANES], size_t LaneLength, uint32 Poly, uint32 TopBit)
+{
+    uint32 Shift = CS_ShiftCRC(TopBit, LaneLength, Poly, TopBit); /* x^(8 * LaneLength) */
+    uint32 Crc   = Lane[0];
+    uint32 i;
+
+    /*
+     * Only the first lane starts from the input CRC, the others start
+     * from zero, so each is the CRC of its sub-block added on to the
+     * lanes before it advanced over the sub-block
+     */
+    for (i = 1; i < CS_CRC_LANES; i++)
+    {
+        Crc = CS_MultiplyModCRC(Shift, Crc, Poly, TopBit) ^ Lane[i];
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-16 eight bytes at a time        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 CS_StepCRC16(uint32 Crc, const uint8 *BufPtr)
+{
+    /*
+     * Bytes are loaded one at a time so the kernel gives the same
+     * answer regardless of the alignment and endianness of the data
+     */
+    Crc ^= (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8);
+
+    return CS_Crc16Table[7][Crc & 0xFF] ^ CS_Crc16Table[6][Crc >> 8] ^ CS_Crc16Table[5][BufPtr[2]] ^
+           CS_Crc16Table[4][BufPtr[3]] ^ CS_Crc16Table[3][BufPtr[4]] ^ CS_Crc16Table[2][BufPtr[5]] ^
+           CS_Crc16Table[1][BufPtr[6]] ^ CS_Crc16Table[0][BufPtr[7]];
+}
+
+static uint32 CS_ComputeCRC16(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    while (DataLength >= CS_CRC_SLICE_BYTES)
+    {
+        Crc = CS_StepCRC16(Crc, BufPtr);
+
+        BufPtr += CS_CRC_SLICE_BYTES;
+        DataLength -= CS_CRC_SLICE_BYTES;
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = (Crc >> 8) ^ CS_Crc16Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a 32 bit CRC eight bytes at a time    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 CS_StepCRC32(const uint32 Table[CS_CRC_SLICE_BYTES][256], uint32 Crc, const uint8 *BufPtr)
+{
+    Crc ^= (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+
+    return Table[7][Crc & 0xFF] ^ Table[6][(Crc >> 8) & 0xFF] ^ Table[5][(Crc >> 16) & 0xFF] ^ Table[4][Crc >> 24] ^
+           Table[3][BufPtr[4]] ^ Table[2][BufPtr[5]] ^ Table[1][BufPtr[6]] ^ Table[0][BufPtr[7]];
+}
+
+static uint32 CS_ComputeCRC32(const uint32 Table[CS_CRC_SLICE_BYTES][256], const uint8 *BufPtr, size_t DataLength,
+                              uint32 Crc)
+{
+    while (DataLength >= CS_CRC_SLICE_BYTES)
+    {
+        Crc = CS_StepCRC32(Table, Crc, BufPtr);
+
+        BufPtr += CS_CRC_SLICE_BYTES;
+        DataLength -= CS_CRC_SLICE_BYTES;
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *BufPtr) & 0xFF];
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-16 over four interleaved        */
+/* sub-blocks                                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_ComputeCRC16Lanes(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    size_t LaneLength = (DataLength / (CS_CRC_LANES * CS_CRC_SLICE_BYTES)) * CS_CRC_SLICE_BYTES;
+    uint32 Lane[CS_CRC_LANES];
+    size_t Offset;
+
+    Lane[0] = Crc;
+    Lane[1] = 0;
+    Lane[2] = 0;
+    Lane[3] = 0;
+
+    /* The four steps of each pass do not depend on one another */
+    for (Offset = 0; Offset < LaneLength; Offset += CS_CRC_SLICE_BYTES)
+    {
+        Lane[0] = CS_StepCRC16(Lane[0], &BufPtr[Offset]);
+        Lane[1] = CS_StepCRC16(Lane[1], &BufPtr[Offset + LaneLength]);
+        Lane[2] = CS_StepCRC16(Lane[2], &BufPtr[Offset + (2 * LaneLength)]);
+        Lane[3] = CS_StepCRC16(Lane[3], &BufPtr[Offset + (3 * LaneLength)]);
+    }
+
+    Crc = CS_CombineCRCLanes(Lane, LaneLength, CS_CRC16_POLY, 0x8000);
+
+    return CS_ComputeCRC16(&BufPtr[CS_CRC_LANES * LaneLength], DataLength - (CS_CRC_LANES * LaneLength), Crc);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a 32 bit CRC over four interleaved    */
+/* sub-blocks                                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_ComputeCRC32Lanes(const uint32 Table[CS_CRC_SLICE_BYTES][256], uint32 Poly, const uint8 *BufPtr,
+                                   size_t DataLength, uint32 Crc)
+{
+    size_t LaneLength = (DataLength / (CS_CRC_LANES * CS_CRC_SLICE_BYTES)) * CS_CRC_SLICE_BYTES;
+    uint32 Lane[CS_CRC_LANES];
+    size_t Offset;
+
+    Lane[0] = Crc;
+    Lane[1] = 0;
+    Lane[2] = 0;
+    Lane[3] = 0;
+
+    /* The four steps of each pass do not depend on one another */
+    for (Offset = 0; Offset < LaneLength; Offset += CS_CRC_SLICE_BYTES)
+    {
+        Lane[0] = CS_StepCRC32(Table, Lane[0], &BufPtr[Offset]);
+        Lane[1] = CS_StepCRC32(Table, Lane[1], &BufPtr[Offset + LaneLength]);
+        Lane[2] = CS_StepCRC32(Table, Lane[2], &BufPtr[Offset + (2 * LaneLength)]);
+        Lane[3] = CS_StepCRC32(Table, Lane[3], &BufPtr[Offset + (3 * LaneLength)]);
+    }
+
+    Crc = CS_CombineCRCLanes(Lane, LaneLength, Poly, 0x80000000);
+
+    return CS_ComputeCRC32(Table, &BufPtr[CS_CRC_LANES * LaneLength], DataLength - (CS_CRC_LANES * LaneLength), Crc);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a table-driven 32 bit CRC with the    */
+/* fastest kernel for the length of the data                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_ComputeCRC32Table(const uint32 Table[CS_CRC_SLICE_BYTES][256], uint32 Poly, const uint8 *BufPtr,
+                                   size_t DataLength, uint32 Crc)
+{
+    if (DataLength >= CS_CRC_INTERLEAVE_MIN_BYTES)
+    {
+        return CS_ComputeCRC32Lanes(Table, Poly, BufPtr, DataLength, Crc);
+    }
+
+    return CS_ComputeCRC32(Table, BufPtr, DataLength, Crc);
+}
+
+#if defined(CS_CRC_HW_X86)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32C with the SSE4.2 instruction */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("sse4.2"))) static uint32 CS_ComputeCRC32CHw(const uint8 *BufPtr, size_t DataLength,
+                                                                    uint32 Crc)
+{
+#if defined(__x86_64__)
+    uint64 Crc64 = Crc;
+    uint64 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc64 = _mm_crc32_u64(Crc64, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    Crc = (uint32)Crc64;
+#else
+    uint32 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = _mm_crc32_u32(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+#endif
+
+    while (DataLength > 0)
+    {
+        Crc = _mm_crc32_u8(Crc, *BufPtr);
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that advances a CRC-32C over eight bytes with the   */
+/* SSE4.2 instruction                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("sse4.2"))) static inline uint32 CS_StepCRC32CHw(uint32 Crc, const uint8 *BufPtr)
+{
+#if defined(__x86_64__)
+    uint64 Word;
+
+    memcpy(&Word, BufPtr, sizeof(Word));
+    return (uint32)_mm_crc32_u64(Crc, Word);
+#else
+    uint32 Word[2];
+
+    memcpy(Word, BufPtr, sizeof(Word));
+    return _mm_crc32_u32(_mm_crc32_u32(Crc, Word[0]), Word[1]);
+#endif
+}
+
+/*
+ * Folding constants for the reflected CRC-32 polynomial, from "Fast CRC
+ * Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ * (Intel, 2009): x^(4*128+32), x^(4*128-32), x^(128+32), x^(128-32) and
+ * x^64 mod P, then the Barrett constant mu and P itself.
+ */
+static const uint64 CS_Crc32FoldK1K2[2] __attribute__((aligned(16))) = {0x0154442bd4, 0x01c6e41596};
+static const uint64 CS_Crc32FoldK3K4[2] __attribute__((aligned(16))) = {0x01751997d0, 0x00ccaa009e};
+static const uint64 CS_Crc32FoldK5K0[2] __attribute__((aligned(16))) = {0x0163cd6124, 0x0000000000};
+static const uint64 CS_Crc32FoldPoly[2] __attribute__((aligned(16))) = {0x01db710641, 0x01f7011641};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32 by carry-less multiply       */
+/* folding, 64 bytes per step                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("pclmul,sse4.1"))) static uint32 CS_ComputeCRC32Fold(const uint8 *BufPtr, size_t DataLength,
+                                                                             uint32 Crc)
+{
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    /* The caller guarantees at least one 64 byte block and a multiple of 16 bytes */
+    x1 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)Crc));
+
+    x0 = _mm_load_si128((const __m128i *)CS_Crc32FoldK1K2);
+
+    BufPtr += 64;
+    DataLength -= 64;
+
+    /* Fold four 128 bit lanes in parallel while 64 byte blocks remain */
+    while (DataLength >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(BufPtr + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        BufPtr += 64;
+        DataLength -= 64;
+    }
+
+    /* Fold the four lanes into one */
+    x0 = _mm_load_si128((const __m128i *)CS_Crc32FoldK3K4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* Fold in any remaining 16 byte blocks */
+    while (DataLength >= 16)
+    {
+        x2 = _mm_loadu_si128((const __m128i *)BufPtr);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        BufPtr += 16;
+        DataLength -= 16;
+    }
+
+    /* Reduce 128 bits to 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((const __m128i *)CS_Crc32FoldK5K0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction to 32 bits */
+    x0 = _mm_load_si128((const __m128i *)CS_Crc32FoldPoly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32)_mm_extract_epi32(x1, 1);
+}
+
+#elif defined(CS_CRC_HW_ARM64)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32C with the ARMv8 instructions */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("+crc"))) static uint32 CS_ComputeCRC32CHw(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    uint64 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = __crc32cd(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = __crc32cb(Crc, *BufPtr);
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that advances a CRC-32C over eight bytes with the   */
+/* ARMv8 instructions                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("+crc"))) static inline uint32 CS_StepCRC32CHw(uint32 Crc, const uint8 *BufPtr)
+{
+    uint64 Word;
+
+    memcpy(&Word, BufPtr, sizeof(Word));
+    return __crc32cd(Crc, Word);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32 with the ARMv8 instructions  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+__attribute__((target("+crc"))) static uint32 CS_ComputeCRC32Hw(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    uint64 Word;
+
+    while (DataLength >= sizeof(Word))
+    {
+        memcpy(&Word, BufPtr, sizeof(Word));
+        Crc = __crc32d(Crc, Word);
+
+        BufPtr += sizeof(Word);
+        DataLength -= sizeof(Word);
+    }
+
+    while (DataLength > 0)
+    {
+        Crc = __crc32b(Crc, *BufPtr);
+
+        BufPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+#endif
+
+#if defined(CS_CRC_HW_X86) || defined(CS_CRC_HW_ARM64)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32C with the processor          */
+/* instructions over four interleaved sub-blocks                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CS_CRC_HW_TARGET static uint32 CS_ComputeCRC32CHwLanes(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+    size_t LaneLength = (DataLength / (CS_CRC_LANES * CS_CRC_SLICE_BYTES)) * CS_CRC_SLICE_BYTES;
+    uint32 Lane[CS_CRC_LANES];
+    size_t Offset;
+
+    Lane[0] = Crc;
+    Lane[1] = 0;
+    Lane[2] = 0;
+    Lane[3] = 0;
+
+    /* Keeps several instructions in flight to cover their latency */
+    for (Offset = 0; Offset < LaneLength; Offset += CS_CRC_SLICE_BYTES)
+    {
+        Lane[0] = CS_StepCRC32CHw(Lane[0], &BufPtr[Offset]);
+        Lane[1] = CS_StepCRC32CHw(Lane[1], &BufPtr[Offset + LaneLength]);
+        Lane[2] = CS_StepCRC32CHw(Lane[2], &BufPtr[Offset + (2 * LaneLength)]);
+        Lane[3] = CS_StepCRC32CHw(Lane[3], &BufPtr[Offset + (3 * LaneLength)]);
+    }
+
+    Crc = CS_CombineCRCLanes(Lane, LaneLength, CS_CRC32C_POLY, 0x80000000);
+
+    return CS_ComputeCRC32CHw(&BufPtr[CS_CRC_LANES * LaneLength], DataLength - (CS_CRC_LANES * LaneLength), Crc);
+}
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC-32 with the fastest kernel      */
+/* selected for the length of the data                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CS_ComputeCRC32Selected(const uint8 *BufPtr, size_t DataLength, uint32 Crc)
+{
+#if defined(CS_CRC_HW_X86)
+    size_t FoldLength;
+
+    /*
+     * Large chunks are folded 16 bytes at a time; whatever is left over
+     * is finished by the table-driven kernel
+     */
+    if (CS_Crc32HwSelected && DataLength >= CS_CRC_FOLD_MIN_BYTES)
+    {
+        FoldLength = DataLength & ~(size_t)(CS_CRC_FOLD_BLOCK_BYTES - 1);
+        Crc        = CS_ComputeCRC32Fold(BufPtr, FoldLength, Crc);
+
+        BufPtr += FoldLength;
+        DataLength -= FoldLength;
+    }
+#elif defined(CS_CRC_HW_ARM64)
+    if (CS_Crc32HwSelected)
+    {
+        return CS_ComputeCRC32Hw(BufPtr, DataLength, Crc);
+    }
+#endif
+
+    return CS_ComputeCRC32Table(CS_Crc32Table, CS_CRC32_POLY, BufPtr, DataLength, Crc);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that combines the CRCs of two adjacent blocks       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_CombineCRC(uint32 FirstCRC, uint32 SecondCRC, size_t SecondLength, uint32 TypeCRC, uint32 *CombinedCRC)
+{
+    bool Combined = true;
+
+    /*
+     * CRCs are linear, so the CRC of the first block continued over the
+     * second equals the first CRC advanced over as many zero bytes as
+     * the second block holds, plus the CRC of the second block. The pre
+     * and post inversions of the 32 bit CRCs cancel out of the sum.
+     */
+    switch (TypeCRC)
+    {
+        case CFE_ES_CrcType_CRC_16:
+            *CombinedCRC = CS_ShiftCRC(FirstCRC & 0xFFFF, SecondLength, CS_CRC16_POLY, 0x8000) ^ (SecondCRC & 0xFFFF);
+            *CombinedCRC = (uint32)(int32)(int16)*CombinedCRC;
+            break;
+
+        case CFE_ES_CrcType_CRC_32:
+            *CombinedCRC = CS_ShiftCRC(FirstCRC, SecondLength, CS_CRC32_POLY, 0x80000000) ^ SecondCRC;
+            break;
+
+        case CS_ALGORITHM_CRC_32C:
+            *CombinedCRC = CS_ShiftCRC(FirstCRC, SecondLength, CS_CRC32C_POLY, 0x80000000) ^ SecondCRC;
+            break;
+
+        default:
+            Combined = false;
+            break;
+    }
+
+    return Combined;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that selects and runs the kernel for an algorithm   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CS_CRC_ALWAYS_INLINE uint32 CS_ComputeCRCByType(const void *DataPtr, size_t DataLength, uint32 InputCRC,
+                                                       uint32 TypeCRC)
+{
+    const uint8 *BufPtr = (const uint8 *)DataPtr;
+    uint32       Crc;
+
+    switch (TypeCRC)
+    {
+        case CFE_ES_CrcType_CRC_16:
+            if (CS_CrcCfeSelected)
+            {
+                Crc = CFE_ES_CalculateCRC(DataPtr, DataLength, InputCRC, CFE_ES_CrcType_CRC_16);
+                break;
+            }
+
+            if (DataLength >= CS_CRC_INTERLEAVE_MIN_BYTES)
+            {
+                Crc = CS_ComputeCRC16Lanes(BufPtr, DataLength, InputCRC & 0xFFFF);
+            }
+            else
+            {
+                Crc = CS_ComputeCRC16(BufPtr, DataLength, InputCRC & 0xFFFF);
+            }
+
+            /*
+             * CFE_ES_CalculateCRC carries its CRC-16 in a signed 16 bit
+             * value, so the upper half of the result is sign extended.
+             * Do the same so existing baselines remain valid.
+             */
+            Crc = (uint32)(int32)(int16)Crc;
+            break;
+
+        case CFE_ES_CrcType_CRC_32:
+            /* Pre and post inversion lets partial results be chained */
+            Crc = ~CS_ComputeCRC32Selected(BufPtr, DataLength, ~InputCRC);
+            break;
+
+        case CS_ALGORITHM_CRC_32C:
+#if defined(CS_CRC_HW_X86) || defined(CS_CRC_HW_ARM64)
+            if (CS_Crc32cHwSelected)
+            {
+                if (DataLength >= CS_CRC_INTERLEAVE_MIN_BYTES)
+                {
+                    Crc = ~CS_ComputeCRC32CHwLanes(BufPtr, DataLength, ~InputCRC);
+                }
+                else
+                {
+                    Crc = ~CS_ComputeCRC32CHw(BufPtr, DataLength, ~InputCRC);
+                }
+                break;
+            }
+#endif
+            Crc = ~CS_ComputeCRC32Table(CS_Crc32cTable, CS_CRC32C_POLY, BufPtr, DataLength, ~InputCRC);
+            break;
+
+        default:
+            Crc = CFE_ES_CalculateCRC(DataPtr, DataLength, InputCRC, (CFE_ES_CrcType_Enum_t)TypeCRC);
+            break;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that computes a CRC over a block of memory          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 CS_ComputeCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    uint32 Crc;
+
+    /*
+     * Most entries use the default algorithm, so it gets its own copy of
+     * the kernel selection with the algorithm fixed at compile time
+     */
+    if (TypeCRC == CS_DEFAULT_ALGORITHM)
+    {
+        Crc = CS_ComputeCRCByType(DataPtr, DataLength, InputCRC, CS_DEFAULT_ALGORITHM);
+    }
+    else
+    {
+        Crc = CS_ComputeCRCByType(DataPtr, DataLength, InputCRC, TypeCRC);
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that selects the kernel for one algorithm           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CS_SelectCRCKernel(uint32 TypeCRC, uint8 Kernel)
+{
+    bool IsLocal  = (TypeCRC == CFE_ES_CrcType_CRC_16) || (TypeCRC == CFE_ES_CrcType_CRC_32) ||
+                   (TypeCRC == CS_ALGORITHM_CRC_32C);
+    bool Selected = false;
+
+    switch (Kernel)
+    {
+        case CS_CRC_KERNEL_TABLE:
+            if (IsLocal)
+            {
+                if (TypeCRC == CFE_ES_CrcType_CRC_16)
+                {
+                    CS_CrcCfeSelected = false;
+                }
+                else if (TypeCRC == CFE_ES_CrcType_CRC_32)
+                {
+                    CS_Crc32HwSelected = false;
+                }
+                else
+                {
+                    CS_Crc32cHwSelected = false;
+                }
+                Selected = true;
+            }
+            break;
+
+        case CS_CRC_KERNEL_HARDWARE:
+            if ((TypeCRC == CFE_ES_CrcType_CRC_32) && CS_CRC32HardwareSupported())
+            {
+                CS_Crc32HwSelected = true;
+                Selected           = true;
+            }
+            else if ((TypeCRC == CS_ALGORITHM_CRC_32C) && CS_CrcInstrSupported)
+            {
+                CS_Crc32cHwSelected = true;
+                Selected            = true;
+            }
+            break;
+
+        case CS_CRC_KERNEL_CFE:
+            /* Algorithms that are not computed locally always go to cFE */
+            if (TypeCRC == CFE_ES_CrcType_CRC_16)
+            {
+                CS_CrcCfeSelected = true;
+            }
+            Selected = (TypeCRC == CFE_ES_CrcType_CRC_16) || !IsLocal;
+            break;
+
+        default:
+            break;
+    }
+
+    return Selected;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that reports the kernel selected for an algorithm   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 CS_GetCRCKernel(uint32 TypeCRC)
+{
+    uint8 Kernel = CS_CRC_KERNEL_CFE;
+
+    if (TypeCRC == CFE_ES_CrcType_CRC_16)
+    {
+        Kernel = CS_CrcCfeSelected ? CS_CRC_KERNEL_CFE : CS_CRC_KERNEL_TABLE;
+    }
+    else if (TypeCRC == CFE_ES_CrcType_CRC_32)
+    {
+        Kernel = CS_Crc32HwSelected ? CS_CRC_KERNEL_HARDWARE : CS_CRC_KERNEL_TABLE;
+    }
+    else if (TypeCRC == CS_ALGORITHM_CRC_32C)
+    {
+        Kernel = CS_Crc32cHwSelected ? CS_CRC_KERNEL_HARDWARE : CS_CRC_KERNEL_TABLE;
+    }
+
+    return Kernel;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that times the kernels for an algorithm and selects */
+/* the fastest                                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 CS_CalibrateCRC(uint32 TypeCRC, uint32 *KBytesPerSec)
+{
+    static const uint8 Kernels[] = {CS_CRC_KERNEL_TABLE, CS_CRC_KERNEL_HARDWARE, CS_CRC_KERNEL_CFE};
+
+    uint8     BestKernel  = CS_CRC_KERNEL_CFE;
+    uint64    BestElapsed = 0;
+    bool      Found       = false;
+    uint64    Throughput;
+    uint32    Expected;
+    uint32    Crc = 0;
+    OS_time_t StartTime;
+    OS_time_t StopTime;
+    int64     Elapsed;
+    uint32    i;
+    uint32    Pass;
+
+    for (i = 0; i < CS_CRC_CALIBRATION_BYTES; i++)
+    {
+        CS_CrcCalibrationBuffer[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+
+    /* Every kernel must reproduce the table-driven result exactly */
+    CS_SelectCRCKernel(TypeCRC, CS_CRC_KERNEL_TABLE);
+    Expected = CS_ComputeCRC(CS_CrcCalibrationBuffer, sizeof(CS_CrcCalibrationBuffer), 0, TypeCRC);
+
+    for (i = 0; i < sizeof(Kernels) / sizeof(Kernels[0]); i++)
+    {
+        if (!CS_SelectCRCKernel(TypeCRC, Kernels[i]))
+        {
+            continue;
+        }
+
+        OS_GetLocalTime(&StartTime);
+
+        for (Pass = 0; Pass < CS_CRC_CALIBRATION_PASSES; Pass++)
+        {
+            Crc = CS_ComputeCRC(CS_CrcCalibrationBuffer, sizeof(CS_CrcCalibrationBuffer), 0, TypeCRC);
+        }
+
+        OS_GetLocalTime(&StopTime);
+
+        /* Faster than the clock can resolve counts as one microsecond */
+        Elapsed = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(StopTime, StartTime));
+        if (Elapsed < 1)
+        {
+            Elapsed = 1;
+        }
+
+        if ((Crc == Expected) && (!Found || ((uint64)Elapsed < BestElapsed)))
+        {
+            BestKernel  = Kernels[i];
+            BestElapsed = (uint64)Elapsed;
+            Found       = true;
+        }
+    }
+
+    CS_SelectCRCKernel(TypeCRC, BestKernel);
+
+    /* A byte per microsecond is a thousand kilobytes per second */
+    *KBytesPerSec = 0;
+    if (Found)
+    {
+        Throughput    = ((uint64)CS_CRC_CALIBRATION_BYTES * CS_CRC_CALIBRATION_PASSES * 1000) / BestElapsed;
+        *KBytesPerSec = (Throughput > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Throughput;
+    }
+
+    return BestKernel;
+}
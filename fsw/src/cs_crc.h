@@ -0,0 +1,210 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Checksum (CS) Application's CRC kernels
+ */
+#ifndef CS_CRC_H
+#define CS_CRC_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Number of bytes consumed per step of the sliced CRC kernels
+ */
+#define CS_CRC_SLICE_BYTES 8
+
+/**
+ * \brief Number of sub-blocks checksummed side by side by the interleaved kernels
+ */
+#define CS_CRC_LANES 4
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Initializes the CRC kernels
+ *
+ *  \par Description
+ *       Checks whether the processor implements CRC or carry-less
+ *       multiply instructions. When it does, and
+ *       #CS_CRC_USE_HW_INSTRUCTIONS is true, those instructions are
+ *       selected for the algorithms they support.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called once before any child task that computes
+ *       checksums is created. The slicing-by-8 lookup tables are
+ *       generated at build time, so #CS_ComputeCRC may be called
+ *       before this, using the table-driven kernels.
+ */
+void CS_InitCRC(void);
+
+/**
+ * \brief Reports whether the processor implements CRC instructions
+ *
+ *  \par Description
+ *       Returns the result of the processor check made by #CS_InitCRC.
+ *       Either CRC instructions or carry-less multiply instructions
+ *       count as support.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Always false when #CS_CRC_USE_HW_INSTRUCTIONS is false or the
+ *       target has no supported CRC instructions.
+ *
+ *  \return Boolean hardware support response
+ *  \retval true  CRC instructions are available
+ *  \retval false CRC instructions are not available
+ */
+bool CS_CRCHardwareSupported(void);
+
+/**
+ * \brief Selects whether the processor CRC instructions are used
+ *
+ *  \par Description
+ *       Switches the algorithms that have a hardware kernel between
+ *       the CRC instructions and the table-driven kernel.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Selecting the hardware has no effect when it is not supported.
+ *       Both kernels give identical results, so this may be changed
+ *       while a checksum is partially computed.
+ *
+ *  \param [in] UseHardware  true to use the CRC instructions
+ *
+ *  \return Boolean hardware in use response
+ *  \retval true  CRC instructions are now in use for CRC-32, CRC-32C or both
+ *  \retval false The table-driven kernel is now in use for both
+ */
+bool CS_SelectCRCHardware(bool UseHardware);
+
+/**
+ * \brief Reports the kernel currently selected for an algorithm
+ *
+ *  \par Description
+ *       Returns the kernel #CS_ComputeCRC uses for TypeCRC, as last
+ *       selected by #CS_InitCRC, #CS_SelectCRCHardware or
+ *       #CS_CalibrateCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Algorithms that are not computed locally always report
+ *       #CS_CRC_KERNEL_CFE.
+ *
+ *  \param [in] TypeCRC  CRC algorithm
+ *
+ *  \return The selected kernel, such as #CS_CRC_KERNEL_TABLE
+ */
+uint8 CS_GetCRCKernel(uint32 TypeCRC);
+
+/**
+ * \brief Selects the fastest kernel for an algorithm
+ *
+ *  \par Description
+ *       Times each kernel that can compute TypeCRC over
+ *       #CS_CRC_CALIBRATION_PASSES passes of a
+ *       #CS_CRC_CALIBRATION_BYTES scratch buffer, and selects the
+ *       fastest one whose result matches the table-driven kernel
+ *       exactly. CRC-16 may be computed by the table-driven kernel or
+ *       #CFE_ES_CalculateCRC, CRC-32 and CRC-32C by the table-driven
+ *       kernel or the processor instructions.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only the kernel for TypeCRC is changed, CRC-32 and CRC-32C
+ *       each keep their own hardware selection. Algorithms that are
+ *       not computed locally are always computed by
+ *       #CFE_ES_CalculateCRC. All kernels give identical results, so
+ *       this may be called while a checksum is partially computed.
+ *
+ *  \param [in]  TypeCRC       CRC algorithm to calibrate
+ *  \param [out] KBytesPerSec  Measured throughput of the selected kernel
+ *
+ *  \return The selected kernel, such as #CS_CRC_KERNEL_TABLE
+ */
+uint8 CS_CalibrateCRC(uint32 TypeCRC, uint32 *KBytesPerSec);
+
+/**
+ * \brief Computes a CRC over a block of memory
+ *
+ *  \par Description
+ *       Computes the CRC of the specified block of memory using the
+ *       selected kernel for the algorithm. CRC-16 results are identical
+ *       to the value that #CFE_ES_CalculateCRC returns for the same
+ *       arguments. Partial results may be chained across calls by
+ *       passing the previous result as InputCRC. Blocks of at least
+ *       #CS_CRC_INTERLEAVE_MIN_BYTES are split into #CS_CRC_LANES
+ *       sub-blocks that are computed side by side and then combined.
+ *       The kernel selection is specialized at compile time for
+ *       #CS_DEFAULT_ALGORITHM.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CFE_ES_CrcType_CRC_16, #CFE_ES_CrcType_CRC_32 and
+ *       #CS_ALGORITHM_CRC_32C are computed locally. Any other
+ *       algorithm is passed through to #CFE_ES_CalculateCRC.
+ *
+ *  \param [in] DataPtr     Pointer to the start of the data
+ *  \param [in] DataLength  Number of bytes to checksum
+ *  \param [in] InputCRC    Starting value, or the result of a previous call
+ *  \param [in] TypeCRC     CRC algorithm to use
+ *
+ *  \return The computed CRC value
+ */
+uint32 CS_ComputeCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC);
+
+/**
+ * \brief Combines the CRCs of two adjacent blocks of memory
+ *
+ *  \par Description
+ *       Given the CRC of a first block and the CRC of the block that
+ *       immediately follows it, each computed by #CS_ComputeCRC with an
+ *       InputCRC of 0, returns the CRC of both blocks together. Only the
+ *       length of the second block is needed, so the blocks may be
+ *       computed in any order, or in parallel.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cost grows with the logarithm of SecondLength, not with the
+ *       length itself. Only the algorithms computed locally by
+ *       #CS_ComputeCRC can be combined.
+ *
+ *  \param [in]  FirstCRC      CRC of the first block
+ *  \param [in]  SecondCRC     CRC of the second block
+ *  \param [in]  SecondLength  Number of bytes in the second block
+ *  \param [in]  TypeCRC       CRC algorithm of both CRCs
+ *  \param [out] CombinedCRC   CRC of the first block followed by the second
+ *
+ *  \return Boolean combined response
+ *  \retval true  CombinedCRC holds the CRC of both blocks
+ *  \retval false The algorithm cannot be combined, CombinedCRC is unchanged
+ */
+bool CS_CombineCRC(uint32 FirstCRC, uint32 SecondCRC, size_t SecondLength, uint32 TypeCRC, uint32 *CombinedCRC);
+
+#endif
@@ -0,0 +1,104 @@
+##################################################################
+#
+# CRC lookup table generator
+#
+# Builds the slicing-by-8 lookup tables used by the table-driven
+# CRC kernels in cs_crc.c and writes them out as constant arrays,
+# so the tables are placed in read-only storage instead of being
+# built in RAM when the application starts.
+#
+##################################################################
+
+# Appends the reflected slicing tables for one polynomial to HEADER_TEXT.
+# Entry [k][n] is the CRC of byte n followed by k zero bytes.
+function(cs_append_crc_table TABLE_NAME TYPE_NAME WIDTH POLY)
+  math(EXPR HEX_DIGITS "${WIDTH} / 4")
+  set(ROW0)
+
+  foreach(n RANGE 255)
+    set(Crc ${n})
+    foreach(Bit RANGE 7)
+      math(EXPR LowBit "${Crc} & 1")
+      if(LowBit)
+        math(EXPR Crc "(${Crc} >> 1) ^ ${POLY}")
+      else()
+        math(EXPR Crc "${Crc} >> 1")
+      endif()
+    endforeach()
+    list(APPEND ROW0 ${Crc})
+  endforeach()
+
+  set(TEXT "static const ${TYPE_NAME} ${TABLE_NAME}[CS_CRC_SLICE_BYTES][256] = {\n")
+  set(PREV_ROW ${ROW0})
+
+  foreach(k RANGE 7)
+    if(k EQUAL 0)
+      set(ROW ${ROW0})
+    else()
+      set(ROW)
+      foreach(Crc IN LISTS PREV_ROW)
+        math(EXPR Index "${Crc} & 0xFF")
+        list(GET ROW0 ${Index} Low)
+        math(EXPR Entry "(${Crc} >> 8) ^ ${Low}")
+        list(APPEND ROW ${Entry})
+      endforeach()
+    endif()
+
+    string(APPEND TEXT "    {")
+    set(Column 0)
+    foreach(Entry IN LISTS ROW)
+      math(EXPR Hex "${Entry}" OUTPUT_FORMAT HEXADECIMAL)
+      string(SUBSTRING "${Hex}" 2 -1 Hex)
+      string(TOUPPER "${Hex}" Hex)
+      string(LENGTH "${Hex}" Length)
+      while(Length LESS HEX_DIGITS)
+        string(PREPEND Hex "0")
+        math(EXPR Length "${Length} + 1")
+      endwhile()
+
+      # Eight entries to a line
+      math(EXPR LineColumn "${Column} % 8")
+      if(Column EQUAL 0)
+        string(APPEND TEXT "0x${Hex}")
+      elseif(LineColumn EQUAL 0)
+        string(APPEND TEXT ",\n     0x${Hex}")
+      else()
+        string(APPEND TEXT ", 0x${Hex}")
+      endif()
+      math(EXPR Column "${Column} + 1")
+    endforeach()
+    string(APPEND TEXT "},\n")
+
+    set(PREV_ROW ${ROW})
+  endforeach()
+
+  string(APPEND TEXT "};\n\n")
+  set(HEADER_TEXT "${HEADER_TEXT}${TEXT}" PARENT_SCOPE)
+endfunction()
+
+# Writes the CRC table header to OUTPUT_FILE. The file is only
+# rewritten when its contents change, so regenerating the tables
+# does not force cs_crc.c to be recompiled.
+function(cs_generate_crc_tables OUTPUT_FILE)
+  set(HEADER_TEXT "/*\n * Generated by cs_crc_tables.cmake, do not edit.\n *\n")
+  string(APPEND HEADER_TEXT " * Slicing-by-8 lookup tables for the reflected CRC-16/ARC, CRC-32 and\n")
+  string(APPEND HEADER_TEXT " * CRC-32C polynomials. Entry [k][n] is the CRC of byte n followed by k\n")
+  string(APPEND HEADER_TEXT " * zero bytes.\n */\n")
+  string(APPEND HEADER_TEXT "#ifndef CS_CRC_TABLES_H\n#define CS_CRC_TABLES_H\n\n")
+
+  cs_append_crc_table(CS_Crc16Table uint16 16 0xA001)
+  cs_append_crc_table(CS_Crc32Table uint32 32 0xEDB88320)
+  cs_append_crc_table(CS_Crc32cTable uint32 32 0x82F63B78)
+
+  string(APPEND HEADER_TEXT "#endif\n")
+
+  file(WRITE "${OUTPUT_FILE}.tmp" "${HEADER_TEXT}")
+  configure_file("${OUTPUT_FILE}.tmp" "${OUTPUT_FILE}" COPYONLY)
+  file(REMOVE "${OUTPUT_FILE}.tmp")
+endfunction()
+
+# Allows the tables to be generated on their own with
+#   cmake -DCS_CRC_TABLES_FILE=<path> -P cs_crc_tables.cmake
+if(CMAKE_SCRIPT_MODE_FILE AND DEFINED CS_CRC_TABLES_FILE)
+  cs_generate_crc_tables("${CS_CRC_TABLES_FILE}")
+endif()
@@ -111,7 +111,8 @@ void CS_ReportBaselineEntryIDEepromCmd(const CS_EntryCmd_t *CmdPtr)
                 Baseline = ResultsEntry.ComparisonValue;
 
                 CFE_EVS_SendEvent(CS_BASELINE_EEPROM_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Report baseline of EEPROM Entry %d is 0x%08X", EntryID, (unsigned int)Baseline);
+                                  "Report baseline of EEPROM Entry %d is 0x%08X, algorithm %d", EntryID,
+                                  (unsigned int)Baseline, (int)ResultsEntry.Algorithm);
             }
             else
             {
@@ -146,45 +147,38 @@ void CS_ReportBaselineEntryIDEepromCmd(const CS_EntryCmd_t *CmdPtr)
 void CS_RecomputeBaselineEepromCmd(const CS_EntryCmd_t *CmdPtr)
 {
     /* command verification variables */
-    CFE_ES_TaskId_t ChildTaskID = CFE_ES_TASKID_UNDEFINED;
-    CFE_Status_t    Status      = CS_ERROR;
-    uint16          EntryID     = 0;
-    uint16          State       = CS_STATE_EMPTY;
+    CFE_Status_t Status  = CS_ERROR;
+    uint16       EntryID = 0;
+    uint16       State   = CS_STATE_EMPTY;
 
         EntryID = CmdPtr->Payload.EntryID;
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (CS_ChildTaskIsFree() == true)
         {
             /* make sure the entry is a valid number and is defined in the table */
             if ((EntryID < CS_MAX_NUM_EEPROM_TABLE_ENTRIES) &&
                 (CS_AppData.ResEepromTblPtr[EntryID].State != CS_STATE_EMPTY))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable   = CS_EEPROM_TABLE;
-                CS_AppData.ChildTaskEntryID = EntryID;
-
-                CS_AppData.RecomputeEepromMemoryEntryPtr = &CS_AppData.ResEepromTblPtr[EntryID];
-
-                Status =
-                    CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_EEPROM_TASK_NAME, CS_RecomputeEepromMemoryChildTask,
-                                           NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+                Status = CS_StartRecomputeWorker(CS_EEPROM_TABLE, EntryID, &CS_AppData.ResEepromTblPtr[EntryID],
+                                                 CS_RecomputeEepromMemoryChildTask);
                 if (Status == CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_EEPROM_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of EEPROM Entry ID %d started", EntryID);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else if (Status == CS_ENTRY_LOCKED)
+                {
+                    /* the event was sent when the entry was found in use */
+                    CS_AppData.HkPacket.Payload.CmdErrCounter++;
+                }
+                else /* handing the work to the worker task failed */
                 {
                     CFE_EVS_SendEvent(
-                        CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "Recompute baseline of EEPROM Entry ID %d failed, CFE_ES_CreateChildTask returned:  0x%08X",
+                        CS_RECOMPUTE_EEPROM_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "Recompute baseline of EEPROM Entry ID %d failed, posting to worker queue failed:  0x%08X",
                         EntryID, (unsigned int)Status);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -206,9 +200,9 @@ void CS_RecomputeBaselineEepromCmd(const CS_EntryCmd_t *CmdPtr)
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
         }
-        else
+        else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
         {
-            /*send event that we can't start another task right now */
+            /* the request queue is full too, send event that we can't start another task right now */
             CFE_EVS_SendEvent(CS_RECOMPUTE_EEPROM_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Recompute baseline of EEPROM Entry ID %d failed: child task in use", EntryID);
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -237,6 +231,7 @@ void CS_EnableEntryIDEepromCmd(const CS_EntryCmd_t *CmdPtr)
                 ResultsEntry = &CS_AppData.ResEepromTblPtr[EntryID];
 
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEntryEnabled(CS_EEPROM_TABLE, EntryID, true);
 
                 CFE_EVS_SendEvent(CS_ENABLE_EEPROM_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of EEPROM Entry ID %d is Enabled", EntryID);
@@ -299,6 +294,7 @@ void CS_DisableEntryIDEepromCmd(const CS_EntryCmd_t *CmdPtr)
                 ResultsEntry->State             = CS_STATE_DISABLED;
                 ResultsEntry->TempChecksumValue = 0;
                 ResultsEntry->ByteOffset        = 0;
+                CS_SetEntryEnabled(CS_EEPROM_TABLE, EntryID, false);
 
                 CFE_EVS_SendEvent(CS_DISABLE_EEPROM_ENTRY_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of EEPROM Entry ID %d is Disabled", EntryID);
@@ -0,0 +1,386 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Checksum (CS) Application's 64 bit checksum kernels
+ */
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_hash.h"
+#include <string.h>
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/* XXH64 primes */
+#define CS_XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define CS_XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define CS_XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define CS_XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define CS_XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+/* Fletcher-64 sums are kept modulo 2^32 - 1 */
+#define CS_FLETCHER_MODULUS 0xFFFFFFFFULL
+
+/*
+ * Number of words summed before the Fletcher-64 sums are reduced. The
+ * second sum grows with the square of this, and stays below 2^56.
+ */
+#define CS_FLETCHER_BLOCK_WORDS 4096
+
+/* Lanes of the Fletcher-64 state */
+#define CS_FLETCHER_SUM_A 0
+#define CS_FLETCHER_SUM_B 1
+
+/**************************************************************************
+ **
+ ** Functions
+ **
+ **************************************************************************/
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Little endian loads, which compile to single loads on little    */
+/* endian targets                                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 CS_ReadLE32(const uint8 *BufPtr)
+{
+    return (uint32)BufPtr[0] | ((uint32)BufPtr[1] << 8) | ((uint32)BufPtr[2] << 16) | ((uint32)BufPtr[3] << 24);
+}
+
+static inline uint64 CS_ReadLE64(const uint8 *BufPtr)
+{
+    return (uint64)CS_ReadLE32(BufPtr) | ((uint64)CS_ReadLE32(BufPtr + 4) << 32);
+}
+
+static inline uint64 CS_RotateLeft64(uint64 Value, uint32 Bits)
+{
+    return (Value << Bits) | (Value >> (64 - Bits));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* XXH64 accumulator round                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint64 CS_XXHash64Round(uint64 Acc, uint64 Input)
+{
+    Acc += Input * CS_XXH_PRIME64_2;
+    Acc = CS_RotateLeft64(Acc, 31);
+    return Acc * CS_XXH_PRIME64_1;
+}
+
+static inline uint64 CS_XXHash64MergeRound(uint64 Acc, uint64 Lane)
+{
+    Acc ^= CS_XXHash64Round(0, Lane);
+    return (Acc * CS_XXH_PRIME64_1) + CS_XXH_PRIME64_4;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* XXH64 over whole stripes, one independent lane per 8 bytes      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_XXHash64Stripes(uint64 Lane[CS_HASH_LANES], const uint8 *BufPtr, size_t NumStripes)
+{
+    uint64 Lane0 = Lane[0];
+    uint64 Lane1 = Lane[1];
+    uint64 Lane2 = Lane[2];
+    uint64 Lane3 = Lane[3];
+
+    while (NumStripes > 0)
+    {
+        Lane0 = CS_XXHash64Round(Lane0, CS_ReadLE64(BufPtr));
+        Lane1 = CS_XXHash64Round(Lane1, CS_ReadLE64(BufPtr + 8));
+        Lane2 = CS_XXHash64Round(Lane2, CS_ReadLE64(BufPtr + 16));
+        Lane3 = CS_XXHash64Round(Lane3, CS_ReadLE64(BufPtr + 24));
+        BufPtr += CS_HASH_STRIPE_BYTES;
+        NumStripes--;
+    }
+
+    Lane[0] = Lane0;
+    Lane[1] = Lane1;
+    Lane[2] = Lane2;
+    Lane[3] = Lane3;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Adds a block to an unfinished XXH64                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_ComputeXXHash64(const uint8 *BufPtr, size_t DataLength, size_t ByteOffset, CS_Hash_State_t *State)
+{
+    size_t NumPending = ByteOffset % CS_HASH_STRIPE_BYTES;
+    size_t NumFill    = 0;
+
+    if (ByteOffset == 0)
+    {
+        /* Seed 0 */
+        State->Lane[0] = CS_XXH_PRIME64_1 + CS_XXH_PRIME64_2;
+        State->Lane[1] = CS_XXH_PRIME64_2;
+        State->Lane[2] = 0;
+        State->Lane[3] = 0 - CS_XXH_PRIME64_1;
+    }
+
+    /* Complete the stripe that the previous call left unfinished */
+    if (NumPending != 0)
+    {
+        NumFill = CS_HASH_STRIPE_BYTES - NumPending;
+        if (NumFill > DataLength)
+        {
+            NumFill = DataLength;
+        }
+
+        memcpy(&State->Pending[NumPending], BufPtr, NumFill);
+        NumPending += NumFill;
+        BufPtr += NumFill;
+        DataLength -= NumFill;
+
+        if (NumPending < CS_HASH_STRIPE_BYTES)
+        {
+            return;
+        }
+
+        CS_XXHash64Stripes(State->Lane, State->Pending, 1);
+    }
+
+    CS_XXHash64Stripes(State->Lane, BufPtr, DataLength / CS_HASH_STRIPE_BYTES);
+
+    /* Keep the start of the next stripe for the next call, or for the finish */
+    NumFill = DataLength % CS_HASH_STRIPE_BYTES;
+    memcpy(State->Pending, BufPtr + (DataLength - NumFill), NumFill);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finishes an XXH64                                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 CS_FinishXXHash64(const CS_Hash_State_t *State, size_t TotalLength)
+{
+    const uint8 *BufPtr  = State->Pending;
+    size_t       NumTail = TotalLength % CS_HASH_STRIPE_BYTES;
+    uint64       Hash    = 0;
+
+    if (TotalLength >= CS_HASH_STRIPE_BYTES)
+    {
+        Hash = CS_RotateLeft64(State->Lane[0], 1) + CS_RotateLeft64(State->Lane[1], 7) +
+               CS_RotateLeft64(State->Lane[2], 12) + CS_RotateLeft64(State->Lane[3], 18);
+        Hash = CS_XXHash64MergeRound(Hash, State->Lane[0]);
+        Hash = CS_XXHash64MergeRound(Hash, State->Lane[1]);
+        Hash = CS_XXHash64MergeRound(Hash, State->Lane[2]);
+        Hash = CS_XXHash64MergeRound(Hash, State->Lane[3]);
+    }
+    else
+    {
+        /* Seed 0 */
+        Hash = CS_XXH_PRIME64_5;
+    }
+
+    Hash += (uint64)TotalLength;
+
+    while (NumTail >= 8)
+    {
+        Hash ^= CS_XXHash64Round(0, CS_ReadLE64(BufPtr));
+        Hash = (CS_RotateLeft64(Hash, 27) * CS_XXH_PRIME64_1) + CS_XXH_PRIME64_4;
+        BufPtr += 8;
+        NumTail -= 8;
+    }
+
+    if (NumTail >= 4)
+    {
+        Hash ^= (uint64)CS_ReadLE32(BufPtr) * CS_XXH_PRIME64_1;
+        Hash = (CS_RotateLeft64(Hash, 23) * CS_XXH_PRIME64_2) + CS_XXH_PRIME64_3;
+        BufPtr += 4;
+        NumTail -= 4;
+    }
+
+    while (NumTail > 0)
+    {
+        Hash ^= (uint64)(*BufPtr) * CS_XXH_PRIME64_5;
+        Hash = CS_RotateLeft64(Hash, 11) * CS_XXH_PRIME64_1;
+        BufPtr++;
+        NumTail--;
+    }
+
+    /* Avalanche */
+    Hash ^= Hash >> 33;
+    Hash *= CS_XXH_PRIME64_2;
+    Hash ^= Hash >> 29;
+    Hash *= CS_XXH_PRIME64_3;
+    Hash ^= Hash >> 32;
+
+    return Hash;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Partially reduces a Fletcher-64 sum, the result is below 2^32   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint64 CS_ReduceFletcher64(uint64 Sum)
+{
+    Sum = (Sum & CS_FLETCHER_MODULUS) + (Sum >> 32);
+    return (Sum & CS_FLETCHER_MODULUS) + (Sum >> 32);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Adds a block to an unfinished Fletcher-64                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CS_ComputeFletcher64(const uint8 *BufPtr, size_t DataLength, size_t ByteOffset, CS_Hash_State_t *State)
+{
+    uint64 SumA     = 0;
+    uint64 SumB     = 0;
+    uint32 BytePos  = ByteOffset % 4;
+    size_t NumWords = 0;
+
+    if (ByteOffset != 0)
+    {
+        SumA = State->Lane[CS_FLETCHER_SUM_A];
+        SumB = State->Lane[CS_FLETCHER_SUM_B];
+    }
+
+    /*
+     * A word split across calls is added to the first sum a byte at a
+     * time, and only added to the second sum once it is complete
+     */
+    while ((BytePos != 0) && (DataLength > 0))
+    {
+        SumA += (uint64)(*BufPtr) << (8 * BytePos);
+        BytePos = (BytePos + 1) % 4;
+        if (BytePos == 0)
+        {
+            SumB += SumA;
+        }
+        BufPtr++;
+        DataLength--;
+    }
+
+    while (DataLength >= 4)
+    {
+        NumWords = DataLength / 4;
+        if (NumWords > CS_FLETCHER_BLOCK_WORDS)
+        {
+            NumWords = CS_FLETCHER_BLOCK_WORDS;
+        }
+        DataLength -= NumWords * 4;
+
+        while (NumWords > 0)
+        {
+            SumA += CS_ReadLE32(BufPtr);
+            SumB += SumA;
+            BufPtr += 4;
+            NumWords--;
+        }
+
+        SumA = CS_ReduceFletcher64(SumA);
+        SumB = CS_ReduceFletcher64(SumB);
+    }
+
+    /* Start of a word that the next call, or the finish, completes */
+    while (DataLength > 0)
+    {
+        SumA += (uint64)(*BufPtr) << (8 * BytePos);
+        BytePos++;
+        BufPtr++;
+        DataLength--;
+    }
+
+    State->Lane[CS_FLETCHER_SUM_A] = CS_ReduceFletcher64(SumA);
+    State->Lane[CS_FLETCHER_SUM_B] = CS_ReduceFletcher64(SumB);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finishes a Fletcher-64                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 CS_FinishFletcher64(const CS_Hash_State_t *State, size_t TotalLength)
+{
+    uint64 SumA = 0;
+    uint64 SumB = 0;
+
+    if (TotalLength != 0)
+    {
+        SumA = State->Lane[CS_FLETCHER_SUM_A];
+        SumB = State->Lane[CS_FLETCHER_SUM_B];
+
+        /* The last word is padded with zeros */
+        if ((TotalLength % 4) != 0)
+        {
+            SumB = CS_ReduceFletcher64(SumB + SumA);
+        }
+    }
+
+    return ((SumB % CS_FLETCHER_MODULUS) << 32) | (SumA % CS_FLETCHER_MODULUS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that adds a block to a 64 bit checksum              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_ComputeHash(const void *DataPtr, size_t DataLength, size_t ByteOffset, CS_Hash_State_t *State,
+                    uint32 Algorithm)
+{
+    const uint8 *BufPtr = (const uint8 *)DataPtr;
+
+    if (Algorithm == CS_ALGORITHM_XXHASH_64)
+    {
+        CS_ComputeXXHash64(BufPtr, DataLength, ByteOffset, State);
+    }
+    else if (Algorithm == CS_ALGORITHM_FLETCHER_64)
+    {
+        CS_ComputeFletcher64(BufPtr, DataLength, ByteOffset, State);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS function that finishes a 64 bit checksum                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_FinishHash(const CS_Hash_State_t *State, size_t TotalLength, uint32 Algorithm, uint64 *HashValue)
+{
+    if (Algorithm == CS_ALGORITHM_XXHASH_64)
+    {
+        *HashValue = CS_FinishXXHash64(State, TotalLength);
+    }
+    else if (Algorithm == CS_ALGORITHM_FLETCHER_64)
+    {
+        *HashValue = CS_FinishFletcher64(State, TotalLength);
+    }
+    else
+    {
+        *HashValue = 0;
+    }
+}
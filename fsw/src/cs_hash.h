@@ -0,0 +1,96 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Checksum (CS) Application's 64 bit
+ *   checksum kernels
+ */
+#ifndef CS_HASH_H
+#define CS_HASH_H
+
+/**************************************************************************
+ **
+ ** Include section
+ **
+ **************************************************************************/
+#include "cfe.h"
+#include "cs_msgdefs.h"
+#include "cs_tbldefs.h"
+
+/**************************************************************************
+ **
+ ** Macro definitions
+ **
+ **************************************************************************/
+
+/**
+ * \brief Is the algorithm computed by the 64 bit kernels
+ */
+#define CS_IS_HASH_ALGORITHM(Algorithm) \
+    (((Algorithm) == CS_ALGORITHM_XXHASH_64) || ((Algorithm) == CS_ALGORITHM_FLETCHER_64))
+
+/**************************************************************************
+ **
+ ** Function prototypes
+ **
+ **************************************************************************/
+
+/**
+ * \brief Adds a block of memory to an unfinished 64 bit checksum
+ *
+ *  \par Description
+ *       Feeds the next DataLength bytes of an entry into the 64 bit
+ *       checksum held in State. An entry may be split across any number
+ *       of calls, of any length, as long as ByteOffset is the number of
+ *       bytes of the entry already fed in. A ByteOffset of 0 starts a
+ *       new checksum.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is computed for an algorithm that is not a 64 bit
+ *       algorithm, see #CS_IS_HASH_ALGORITHM.
+ *
+ *  \param [in]     DataPtr     Pointer to the start of the data
+ *  \param [in]     DataLength  Number of bytes to checksum
+ *  \param [in]     ByteOffset  Number of bytes of the entry already fed in
+ *  \param [in,out] State       The unfinished checksum
+ *  \param [in]     Algorithm   64 bit algorithm to use
+ */
+void CS_ComputeHash(const void *DataPtr, size_t DataLength, size_t ByteOffset, CS_Hash_State_t *State,
+                    uint32 Algorithm);
+
+/**
+ * \brief Finishes a 64 bit checksum
+ *
+ *  \par Description
+ *       Returns the 64 bit checksum of an entry whose TotalLength bytes
+ *       have all been fed into State by #CS_ComputeHash. State is not
+ *       changed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The value is 0 for an algorithm that is not a 64 bit algorithm.
+ *
+ *  \param [in]  State        The checksum of the whole entry
+ *  \param [in]  TotalLength  Number of bytes in the entry
+ *  \param [in]  Algorithm    64 bit algorithm of the checksum
+ *  \param [out] HashValue    The finished checksum
+ */
+void CS_FinishHash(const CS_Hash_State_t *State, size_t TotalLength, uint32 Algorithm, uint64 *HashValue);
+
+#endif
@@ -18,6 +18,7 @@
  ************************************************************************/
 
 #include <string.h>
+#include <stdio.h>
 #include "cfe.h"
 #include "cs_app.h"
 
@@ -99,7 +100,8 @@ CFE_Status_t CS_SbInit(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t CS_InitAllTables(void)
 {
-    CFE_Status_t ResultInit = CFE_SUCCESS;
+    CFE_Status_t ResultInit   = CFE_SUCCESS;
+    CFE_Status_t ResultBudget = CFE_SUCCESS;
 
     ResultInit = CS_TableInit(&CS_AppData.DefEepromTableHandle, &CS_AppData.ResEepromTableHandle,
                               (void *)&CS_AppData.DefEepromTblPtr, (void *)&CS_AppData.ResEepromTblPtr, CS_EEPROM_TABLE,
@@ -164,6 +166,18 @@ CFE_Status_t CS_InitAllTables(void)
         }
     }
 
+    if (ResultInit == CFE_SUCCESS)
+    {
+        /* Without the byte budget table every checksum type uses the shared bytes per cycle */
+        ResultBudget = CS_BudgetTableInit();
+
+        if (ResultBudget != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CS_INIT_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Table initialization failed for byte budgets: 0x%08X", (unsigned int)ResultBudget);
+        }
+    }
+
     return ResultInit;
 }
 
@@ -191,6 +205,8 @@ void CS_InitSegments(void)
         CS_AppData.CfeCoreCodeSeg.ComparisonValue    = 0;
         CS_AppData.CfeCoreCodeSeg.ByteOffset         = 0;
         CS_AppData.CfeCoreCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.CfeCoreCodeSeg.SubRangeMask       = 0;
+        CS_AppData.CfeCoreCodeSeg.Algorithm          = CS_DEFAULT_ALGORITHM;
         CS_AppData.CfeCoreCodeSeg.State              = CS_STATE_DISABLED;
 
         CFE_EVS_SendEvent(CS_CFE_TEXT_SEG_INF_EID, CFE_EVS_EventType_INFORMATION, "CFE Text Segment disabled");
@@ -203,6 +219,8 @@ void CS_InitSegments(void)
         CS_AppData.CfeCoreCodeSeg.ComparisonValue    = 0;
         CS_AppData.CfeCoreCodeSeg.ByteOffset         = 0;
         CS_AppData.CfeCoreCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.CfeCoreCodeSeg.SubRangeMask       = 0;
+        CS_AppData.CfeCoreCodeSeg.Algorithm          = CS_DEFAULT_ALGORITHM;
         CS_AppData.CfeCoreCodeSeg.State              = CS_STATE_ENABLED;
     }
 
@@ -218,6 +236,8 @@ void CS_InitSegments(void)
         CS_AppData.OSCodeSeg.ComparisonValue    = 0;
         CS_AppData.OSCodeSeg.ByteOffset         = 0;
         CS_AppData.OSCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.OSCodeSeg.SubRangeMask       = 0;
+        CS_AppData.OSCodeSeg.Algorithm          = CS_DEFAULT_ALGORITHM;
         CS_AppData.OSCodeSeg.State              = CS_STATE_DISABLED;
 
         CFE_EVS_SendEvent(CS_OS_TEXT_SEG_INF_EID, CFE_EVS_EventType_INFORMATION,
@@ -231,6 +251,132 @@ void CS_InitSegments(void)
         CS_AppData.OSCodeSeg.ComparisonValue    = 0;
         CS_AppData.OSCodeSeg.ByteOffset         = 0;
         CS_AppData.OSCodeSeg.TempChecksumValue  = 0;
+        CS_AppData.OSCodeSeg.SubRangeMask       = 0;
+        CS_AppData.OSCodeSeg.Algorithm          = CS_DEFAULT_ALGORITHM;
         CS_AppData.OSCodeSeg.State              = CS_STATE_ENABLED;
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Recompute Worker Initialization                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_InitRecomputeWorkers(void)
+{
+    CFE_Status_t Result = CFE_SUCCESS;
+    uint16       WorkerID;
+    uint16       SubRange;
+
+    for (WorkerID = 0; WorkerID < CS_MAX_RECOMPUTE_WORKERS; WorkerID++)
+    {
+        CS_AppData.RecomputeWorkers[WorkerID].TaskID           = CFE_ES_TASKID_UNDEFINED;
+        CS_AppData.RecomputeWorkers[WorkerID].EntryPtr         = NULL;
+        CS_AppData.RecomputeWorkers[WorkerID].SubRangeBusyMask = 0;
+
+        for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+        {
+            CS_AppData.RecomputeWorkers[WorkerID].SubRangeTaskID[SubRange]  = CFE_ES_TASKID_UNDEFINED;
+            CS_AppData.RecomputeWorkers[WorkerID].SubRangeQueueID[SubRange] = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+
+    Result = OS_MutSemCreate(&CS_AppData.WorkerMutex, CS_WORKER_MUTEX_NAME, 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_INIT_WORKER_MUTEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Recompute worker mutex create returned: 0x%08X", (unsigned int)Result);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Worker Task and Queue Creation                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t CS_CreateWorkerTask(osal_id_t *QueueID, const char *QueueName, CFE_ES_TaskId_t *TaskID,
+                                        const char *TaskName)
+{
+    CFE_Status_t Result = CFE_SUCCESS;
+
+    Result = OS_QueueCreate(QueueID, QueueName, CS_WORKER_QUEUE_DEPTH, sizeof(CFE_ES_ChildTaskMainFuncPtr_t), 0);
+
+    if (Result != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_INIT_WORKER_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Worker queue %s create returned: 0x%08X", QueueName, (unsigned int)Result);
+
+        *QueueID = OS_OBJECT_ID_UNDEFINED;
+    }
+    else
+    {
+        Result = CFE_ES_CreateChildTask(TaskID, TaskName, CS_WorkerTask, NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE,
+                                        CS_CHILD_TASK_PRIORITY, 0);
+
+        if (Result != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CS_INIT_WORKER_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Worker task %s create returned: 0x%08X", TaskName, (unsigned int)Result);
+
+            /* Nothing would ever read work posted to the queue, so it goes too */
+            OS_QueueDelete(*QueueID);
+            *QueueID = OS_OBJECT_ID_UNDEFINED;
+            *TaskID  = CFE_ES_TASKID_UNDEFINED;
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Worker Task Initialization                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_InitWorkerTasks(void)
+{
+    CFE_Status_t          Result = CFE_SUCCESS;
+    CS_RecomputeWorker_t *Worker = NULL;
+    uint16                WorkerID;
+    uint16                SubRange;
+    char                  QueueName[OS_MAX_API_NAME];
+    char                  TaskName[OS_MAX_API_NAME];
+
+    /* A new task looks its queue up under the mutex, so it is held until every task ID is recorded */
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    for (WorkerID = 0; (WorkerID < CS_MAX_RECOMPUTE_WORKERS) && (Result == CFE_SUCCESS); WorkerID++)
+    {
+        Worker = &CS_AppData.RecomputeWorkers[WorkerID];
+
+        snprintf(QueueName, sizeof(QueueName), "%s%d", CS_RECOMP_WORKER_QUEUE_NAME, (int)WorkerID);
+        snprintf(TaskName, sizeof(TaskName), "%s%d", CS_RECOMP_WORKER_TASK_NAME, (int)WorkerID);
+
+        Result = CS_CreateWorkerTask(&Worker->QueueID, QueueName, &Worker->TaskID, TaskName);
+
+        /* A single sub-range is never split off, so it needs no task of its own. A sub-range task
+           that can not be created only costs speed, as the worker checksums that sub-range itself */
+        for (SubRange = 0; (CS_NUM_SUB_RANGES > 1) && (SubRange < CS_NUM_SUB_RANGES) && (Result == CFE_SUCCESS);
+             SubRange++)
+        {
+            snprintf(QueueName, sizeof(QueueName), "%s%d_%d", CS_SUB_RANGE_QUEUE_NAME, (int)WorkerID, (int)SubRange);
+            snprintf(TaskName, sizeof(TaskName), "%s%d_%d", CS_SUB_RANGE_TASK_NAME, (int)WorkerID, (int)SubRange);
+
+            CS_CreateWorkerTask(&Worker->SubRangeQueueID[SubRange], QueueName, &Worker->SubRangeTaskID[SubRange],
+                                TaskName);
+        }
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CS_CreateWorkerTask(&CS_AppData.OneShotQueueID, CS_ONESHOT_QUEUE_NAME, &CS_AppData.ChildTaskID,
+                                     CS_ONESHOT_TASK_NAME);
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return Result;
+}
@@ -71,4 +71,39 @@ CFE_Status_t CS_InitAllTables(void);
  */
 void CS_InitSegments(void);
 
+/**
+ * \brief Initializes the recompute workers for the Checksum Application
+ *
+ *  \par Description
+ *       Marks every recompute worker free and creates the mutex the
+ *       main task and the workers take to claim and release them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t CS_InitRecomputeWorkers(void);
+
+/**
+ * \brief Creates the worker tasks for the Checksum Application
+ *
+ *  \par Description
+ *       Creates a queue and a child task for every recompute worker,
+ *       for each sub-range of every worker's split recompute and for
+ *       the one shot. The tasks wait on their queues for the work that
+ *       recompute and one shot commands hand them, so starting a
+ *       command or splitting a recompute never has to create a task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once #CS_InitRecomputeWorkers has created the worker
+ *       mutex. A sub-range task that can not be created is left out
+ *       without failing, and its worker checksums that sub-range itself.
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t CS_InitWorkerTasks(void);
+
 #endif
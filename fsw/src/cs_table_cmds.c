@@ -102,7 +102,8 @@ void CS_ReportBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
             {
                 Baseline = ResultsEntry->ComparisonValue;
                 CFE_EVS_SendEvent(CS_BASELINE_TABLES_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Report baseline of table %s is 0x%08X", Name, (unsigned int)Baseline);
+                                  "Report baseline of table %s is 0x%08X, algorithm %d", Name, (unsigned int)Baseline,
+                                  (int)ResultsEntry->Algorithm);
             }
             else
             {
@@ -126,12 +127,12 @@ void CS_ReportBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CS_RecomputeBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
 {
-    CFE_ES_TaskId_t              ChildTaskID;
     CFE_Status_t                 Status;
+    uint16                       EntryID;
     CS_Res_Tables_Table_Entry_t *ResultsEntry;
     char                         Name[CFE_TBL_MAX_FULL_NAME_LEN];
 
-        if (CS_AppData.HkPacket.Payload.RecomputeInProgress == false && CS_AppData.HkPacket.Payload.OneShotInProgress == false)
+        if (CS_ChildTaskIsFree() == true)
         {
             strncpy(Name, CmdPtr->Payload.Name, sizeof(Name) - 1);
             Name[sizeof(Name) - 1] = '\0';
@@ -139,29 +140,25 @@ void CS_RecomputeBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
             /* make sure the entry is a valid number and is defined in the table */
             if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
             {
-                /* There is no child task running right now, we can use it*/
-                CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
-
-                /* fill in child task variables */
-                CS_AppData.ChildTaskTable = CS_TABLES_TABLE;
-
-                CS_AppData.RecomputeTablesEntryPtr = ResultsEntry;
-
-                Status = CFE_ES_CreateChildTask(&ChildTaskID, CS_RECOMP_TABLES_TASK_NAME, CS_RecomputeTablesChildTask,
-                                                NULL, CFE_PLATFORM_ES_DEFAULT_STACK_SIZE, CS_CHILD_TASK_PRIORITY, 0);
+                EntryID = (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr);
+                Status  = CS_StartRecomputeWorker(CS_TABLES_TABLE, EntryID, ResultsEntry, CS_RecomputeTablesChildTask);
                 if (Status == CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
                                       "Recompute baseline of table %s started", Name);
                     CS_AppData.HkPacket.Payload.CmdCounter++;
                 }
-                else /* child task creation failed */
+                else if (Status == CS_ENTRY_LOCKED)
                 {
-                    CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Recompute baseline of table %s failed, CFE_ES_CreateChildTask returned: 0x%08X",
+                    /* the event was sent when the entry was found in use */
+                    CS_AppData.HkPacket.Payload.CmdErrCounter++;
+                }
+                else /* handing the work to the worker task failed */
+                {
+                    CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_POST_WORK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Recompute baseline of table %s failed, posting to worker queue failed: 0x%08X",
                                       Name, (unsigned int)Status);
                     CS_AppData.HkPacket.Payload.CmdErrCounter++;
-                    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
                 }
             }
             else
@@ -171,9 +168,9 @@ void CS_RecomputeBaselineTablesCmd(const CS_TableNameCmd_t *CmdPtr)
                 CS_AppData.HkPacket.Payload.CmdErrCounter++;
             }
         }
-        else
+        else if (CS_QueueChildTaskRequest(&CmdPtr->CmdHeader.Msg, sizeof(*CmdPtr)) == false)
         {
-            /*send event that we can't start another task right now */
+            /* the request queue is full too, send event that we can't start another task right now */
             CFE_EVS_SendEvent(CS_RECOMPUTE_TABLES_CHDTASK_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Tables recompute baseline for table %s failed: child task in use", Name);
             CS_AppData.HkPacket.Payload.CmdErrCounter++;
@@ -201,6 +198,7 @@ void CS_DisableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
                 ResultsEntry->State             = CS_STATE_DISABLED;
                 ResultsEntry->TempChecksumValue = 0;
                 ResultsEntry->ByteOffset        = 0;
+                CS_SetEntryEnabled(CS_TABLES_TABLE, (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr), false);
 
                 CFE_EVS_SendEvent(CS_DISABLE_TABLES_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of table %s is Disabled", Name);
@@ -247,6 +245,7 @@ void CS_EnableNameTablesCmd(const CS_TableNameCmd_t *CmdPtr)
             if (CS_GetTableResTblEntryByName(&ResultsEntry, Name))
             {
                 ResultsEntry->State = CS_STATE_ENABLED;
+                CS_SetEntryEnabled(CS_TABLES_TABLE, (uint16)(ResultsEntry - CS_AppData.ResTablesTblPtr), true);
 
                 CFE_EVS_SendEvent(CS_ENABLE_TABLES_NAME_INF_EID, CFE_EVS_EventType_INFORMATION,
                                   "Checksumming of table %s is Enabled", Name);
@@ -40,6 +40,28 @@
  **
  **************************************************************************/
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Check that a definition entry's algorithm can be computed    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool CS_ValidateAlgorithm(uint16 Algorithm)
+{
+    return ((Algorithm == CS_ALGORITHM_DEFAULT) || (Algorithm == CFE_ES_CrcType_CRC_16) ||
+            (Algorithm == CFE_ES_CrcType_CRC_32) || (Algorithm == CS_ALGORITHM_CRC_32C) ||
+            (Algorithm == CS_ALGORITHM_XXHASH_64) || (Algorithm == CS_ALGORITHM_FLETCHER_64));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Get the algorithm a definition entry asks for                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 CS_GetEntryAlgorithm(uint16 Algorithm)
+{
+    return ((Algorithm == CS_ALGORITHM_DEFAULT) ? CS_DEFAULT_ALGORITHM : Algorithm);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS Validation Callback function for EEPROM Table                */
@@ -87,9 +109,20 @@ CFE_Status_t CS_ValidateEepromChecksumDefinitionTable(void *TblPtr)
                         Result = CS_TABLE_ERROR;
                     }
                 }
+                else if (CS_ValidateAlgorithm(OuterEntry->Algorithm) != true)
+                {
+                    BadCount++;
+                    if (Result != CS_TABLE_ERROR)
+                    {
+                        CFE_EVS_SendEvent(CS_VAL_EEPROM_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "EEPROM Table Validate: Illegal Algorithm (%d) found in Entry ID %d",
+                                          (int)OuterEntry->Algorithm, (int)OuterLoop);
+                        Result = CS_TABLE_ERROR;
+                    }
+                }
                 else
                 {
-                    /* Valid range for non-empty entry */
+                    /* Valid range and algorithm for non-empty entry */
                     GoodCount++;
                 }
             }
@@ -169,9 +202,20 @@ CFE_Status_t CS_ValidateMemoryChecksumDefinitionTable(void *TblPtr)
                         Result = CS_TABLE_ERROR;
                     }
                 }
+                else if (CS_ValidateAlgorithm(OuterEntry->Algorithm) != true)
+                {
+                    BadCount++;
+                    if (Result != CS_TABLE_ERROR)
+                    {
+                        CFE_EVS_SendEvent(CS_VAL_MEMORY_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Memory Table Validate: Illegal Algorithm (%d) found in Entry ID %d",
+                                          (int)OuterEntry->Algorithm, (int)OuterLoop);
+                        Result = CS_TABLE_ERROR;
+                    }
+                }
                 else
                 {
-                    /* Valid range for non-empty entry */
+                    /* Valid range and algorithm for non-empty entry */
                     GoodCount++;
                 }
             }
@@ -268,7 +312,21 @@ CFE_Status_t CS_ValidateTablesChecksumDefinitionTable(void *TblPtr)
                 {
                     if (StateField != CS_STATE_EMPTY)
                     {
-                        GoodCount++;
+                        if (CS_ValidateAlgorithm(OuterEntry->Algorithm) == true)
+                        {
+                            GoodCount++;
+                        }
+                        else
+                        {
+                            BadCount++;
+                            if (Result != CS_TABLE_ERROR)
+                            {
+                                CFE_EVS_SendEvent(CS_VAL_TABLES_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                                  "CS Tables Table Validate: Illegal Algorithm (%d) found with name %s",
+                                                  (int)OuterEntry->Algorithm, OuterEntry->Name);
+                                Result = CS_TABLE_ERROR;
+                            }
+                        }
                     }
                     else
                     {
@@ -393,7 +451,21 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
                 {
                     if (StateField != CS_STATE_EMPTY)
                     {
-                        GoodCount++;
+                        if (CS_ValidateAlgorithm(OuterEntry->Algorithm) == true)
+                        {
+                            GoodCount++;
+                        }
+                        else
+                        {
+                            BadCount++;
+                            if (Result != CS_TABLE_ERROR)
+                            {
+                                CFE_EVS_SendEvent(CS_VAL_APP_ALG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                                  "CS Apps Table Validate: Illegal Algorithm (%d) found with name %s",
+                                                  (int)OuterEntry->Algorithm, OuterEntry->Name);
+                                Result = CS_TABLE_ERROR;
+                            }
+                        }
                     }
                     else
                     {
@@ -445,6 +517,48 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Validation Callback function for Byte Budget Table           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_ValidateBudgetTable(void *TblPtr)
+{
+    CFE_Status_t           Result = CFE_SUCCESS;
+    CS_Def_Budget_Table_t *BudgetTbl;
+    int32                  Budget;
+    int32                  GoodCount = 0;
+    int32                  BadCount  = 0;
+
+    BudgetTbl = (CS_Def_Budget_Table_t *)TblPtr;
+
+    for (Budget = 0; Budget < CS_NUM_BUDGETS; Budget++)
+    {
+        /* The same limit as the set bytes per cycle command */
+        if (BudgetTbl->BytesPerCycle[Budget] > CS_MAX_BUDGET_BYTES_PER_CYCLE)
+        {
+            if (Result != CS_TABLE_ERROR)
+            {
+                CFE_EVS_SendEvent(CS_VAL_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CS Byte Budget Table Validate: Illegal Bytes Per Cycle (%lu) found for budget %d",
+                                  (unsigned long)BudgetTbl->BytesPerCycle[Budget], (int)Budget);
+                Result = CS_TABLE_ERROR;
+            }
+            BadCount++;
+        }
+        else
+        {
+            GoodCount++;
+        }
+    }
+
+    CFE_EVS_SendEvent(CS_VAL_BUDGET_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "CS Byte Budget Table verification results: good = %d, bad = %d", (int)GoodCount,
+                      (int)BadCount);
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CS  processing new definition tables for EEPROM or Memory       */
@@ -461,6 +575,7 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
     uint16                             Loop                = 0;
     uint16                             NumRegionsInTable   = 0;
     uint16                             PreviousState       = CS_STATE_EMPTY;
+    uint32                             NowSeconds          = CS_GetCurrentSeconds();
     char                               TableType[CS_TABLETYPE_NAME_SIZE];
 
     memcpy(&StartOfResultsTable, ResultsTblPtr, sizeof(StartOfResultsTable));
@@ -498,6 +613,10 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
             ResultsEntry->ByteOffset         = 0;
             ResultsEntry->TempChecksumValue  = 0;
             ResultsEntry->StartAddress       = DefEntry->StartAddress;
+            ResultsEntry->SubRangeMask       = 0;
+            ResultsEntry->Algorithm          = CS_GetEntryAlgorithm(DefEntry->Algorithm);
+            ResultsEntry->MaxStaleness       = DefEntry->MaxStaleness;
+            ResultsEntry->VerifiedTime       = NowSeconds;
         }
         else
         {
@@ -508,7 +627,13 @@ void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_En
             ResultsEntry->ByteOffset         = 0;
             ResultsEntry->TempChecksumValue  = 0;
             ResultsEntry->StartAddress       = 0;
+            ResultsEntry->SubRangeMask       = 0;
+            ResultsEntry->Algorithm          = CS_DEFAULT_ALGORITHM;
+            ResultsEntry->MaxStaleness       = 0;
+            ResultsEntry->VerifiedTime       = 0;
         }
+
+        CS_SetEntryEnabled(Table, Loop, (ResultsEntry->State == CS_STATE_ENABLED));
     }
 
     /* Reset the table back to the original checksumming state */
@@ -561,6 +686,7 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
     uint16                       DefNameIndex        = 0;
     uint16                       AppNameIndex        = 0;
     uint16                       TableNameIndex      = 0;
+    uint32                       NowSeconds          = CS_GetCurrentSeconds();
     char                         AppName[OS_MAX_API_NAME];
     char                         TableAppName[OS_MAX_API_NAME];
     char                         TableTableName[CFE_MISSION_TBL_MAX_NAME_LENGTH];
@@ -704,6 +830,9 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
             ResultsEntry->StartAddress       = 0; /* this is unknown at this time */
             ResultsEntry->TblHandle          = TableHandle;
             ResultsEntry->IsCSOwner          = Owned;
+            ResultsEntry->Algorithm          = CS_GetEntryAlgorithm(DefEntry->Algorithm);
+            ResultsEntry->MaxStaleness       = DefEntry->MaxStaleness;
+            ResultsEntry->VerifiedTime       = NowSeconds;
             CFE_SB_MessageStringGet(ResultsEntry->Name, DefEntry->Name, NULL, sizeof(ResultsEntry->Name),
                                     sizeof(DefEntry->Name));
         }
@@ -718,8 +847,13 @@ void CS_ProcessNewTablesDefinitionTable(const CS_Def_Tables_Table_Entry_t *Defin
             ResultsEntry->StartAddress       = 0;
             ResultsEntry->TblHandle          = CFE_TBL_BAD_TABLE_HANDLE;
             ResultsEntry->IsCSOwner          = false;
+            ResultsEntry->Algorithm          = CS_DEFAULT_ALGORITHM;
+            ResultsEntry->MaxStaleness       = 0;
+            ResultsEntry->VerifiedTime       = 0;
             ResultsEntry->Name[0]            = '\0';
         }
+
+        CS_SetEntryEnabled(CS_TABLES_TABLE, Loop, (ResultsEntry->State == CS_STATE_ENABLED));
     }
 
     /* Reset the table back to the original checksumming state */
@@ -748,6 +882,7 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
     uint16                    Loop                = 0;
     uint16                    NumRegionsInTable   = 0;
     uint16                    PreviousState       = CS_STATE_EMPTY;
+    uint32                    NowSeconds          = CS_GetCurrentSeconds();
 
     memcpy(&StartOfResultsTable, ResultsTblPtr, sizeof(StartOfResultsTable));
     memcpy(&StartOfDefTable, DefinitionTblPtr, sizeof(StartOfDefTable));
@@ -776,6 +911,9 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
             ResultsEntry->ByteOffset         = 0;
             ResultsEntry->TempChecksumValue  = 0;
             ResultsEntry->StartAddress       = 0; /* this is unknown at this time */
+            ResultsEntry->Algorithm          = CS_GetEntryAlgorithm(DefEntry->Algorithm);
+            ResultsEntry->MaxStaleness       = DefEntry->MaxStaleness;
+            ResultsEntry->VerifiedTime       = NowSeconds;
             CFE_SB_MessageStringGet(ResultsEntry->Name, DefEntry->Name, NULL, sizeof(ResultsEntry->Name),
                                     sizeof(DefEntry->Name));
         }
@@ -788,9 +926,14 @@ void CS_ProcessNewAppDefinitionTable(const CS_Def_App_Table_Entry_t *DefinitionT
             ResultsEntry->ByteOffset         = 0;
             ResultsEntry->TempChecksumValue  = 0;
             ResultsEntry->StartAddress       = 0;
+            ResultsEntry->Algorithm          = CS_DEFAULT_ALGORITHM;
+            ResultsEntry->MaxStaleness       = 0;
+            ResultsEntry->VerifiedTime       = 0;
 
             ResultsEntry->Name[0] = '\0';
         }
+
+        CS_SetEntryEnabled(CS_APP_TABLE, Loop, (ResultsEntry->State == CS_STATE_ENABLED));
     }
 
     /* Reset the table back to the original checksumming state */
@@ -1056,3 +1199,119 @@ CFE_Status_t CS_HandleTableUpdate(void *DefinitionTblPtr, void *ResultsTblPtr, C
     }
     return Result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Byte Budget Table Initialization                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_BudgetTableInit(void)
+{
+    CFE_Status_t Result         = CFE_SUCCESS;
+    CFE_Status_t ResultFromLoad = OS_ERROR;
+    int32        OS_Status      = -1;
+    osal_id_t    Fd             = OS_OBJECT_ID_UNDEFINED;
+
+    CS_AppData.DefBudgetTblPtr = NULL;
+
+    Result = CFE_TBL_Register(&CS_AppData.DefBudgetTableHandle, CS_DEF_BUDGET_TABLE_NAME,
+                              sizeof(CS_Def_Budget_Table_t), CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP,
+                              CS_ValidateBudgetTable);
+
+    if (Result == CFE_SUCCESS)
+    {
+        OS_Status = OS_OpenCreate(&Fd, CS_DEF_BUDGET_TABLE_FILENAME, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+
+        if (OS_Status == OS_SUCCESS)
+        {
+            OS_close(Fd);
+            ResultFromLoad = CFE_TBL_Load(CS_AppData.DefBudgetTableHandle, CFE_TBL_SRC_FILE,
+                                          CS_DEF_BUDGET_TABLE_FILENAME);
+        }
+
+        /* if the load from the file fails, load from the default table in CS */
+        if (ResultFromLoad != CFE_SUCCESS)
+        {
+            ResultFromLoad = CFE_TBL_Load(CS_AppData.DefBudgetTableHandle, CFE_TBL_SRC_ADDRESS,
+                                          &CS_AppData.DefaultBudgetDefTable);
+        }
+
+        Result = ResultFromLoad;
+    }
+    else
+    {
+        CS_AppData.DefBudgetTableHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    }
+
+    if (Result == CFE_SUCCESS)
+    {
+        Result = CFE_TBL_GetAddress((void *)&CS_AppData.DefBudgetTblPtr, CS_AppData.DefBudgetTableHandle);
+    }
+
+    if (Result >= CFE_SUCCESS)
+    {
+        Result = CFE_SUCCESS;
+    }
+    else
+    {
+        CS_AppData.DefBudgetTblPtr = NULL;
+    }
+
+    CS_RefreshBudgets();
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Handles byte budget table updates                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t CS_HandleBudgetTableUpdate(void)
+{
+    CFE_Status_t Result = CFE_SUCCESS;
+
+    if (CS_AppData.DefBudgetTableHandle != CFE_TBL_BAD_TABLE_HANDLE)
+    {
+        CFE_TBL_ReleaseAddress(CS_AppData.DefBudgetTableHandle);
+
+        CFE_TBL_Manage(CS_AppData.DefBudgetTableHandle);
+
+        Result = CFE_TBL_GetAddress((void *)&CS_AppData.DefBudgetTblPtr, CS_AppData.DefBudgetTableHandle);
+
+        if (Result >= CFE_SUCCESS)
+        {
+            Result = CFE_SUCCESS;
+        }
+        else
+        {
+            CS_AppData.DefBudgetTblPtr = NULL;
+        }
+    }
+
+    CS_RefreshBudgets();
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CS Refreshes the copy of the byte budgets                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CS_RefreshBudgets(void)
+{
+    uint16 Budget;
+
+    for (Budget = 0; Budget < CS_NUM_BUDGETS; Budget++)
+    {
+        if (CS_AppData.DefBudgetTblPtr != NULL)
+        {
+            CS_AppData.BytesPerCycleBudget[Budget] = CS_AppData.DefBudgetTblPtr->BytesPerCycle[Budget];
+        }
+        else
+        {
+            CS_AppData.BytesPerCycleBudget[Budget] = 0;
+        }
+    }
+}
@@ -31,8 +31,10 @@
 #include "cs_app.h"
 #include "cs_events.h"
 #include "cs_compute.h"
+#include "cs_crc.h"
 #include "cs_utils.h"
 #include <string.h>
+#include <stdio.h>
 
 /**************************************************************************
  **
@@ -139,6 +141,7 @@ void CS_InitializeDefaultTables(void)
         CS_AppData.DefaultEepromDefTable[Loop].State              = CS_STATE_EMPTY;
         CS_AppData.DefaultEepromDefTable[Loop].NumBytesToChecksum = 0;
         CS_AppData.DefaultEepromDefTable[Loop].StartAddress       = 0;
+        CS_AppData.DefaultEepromDefTable[Loop].Algorithm          = CS_ALGORITHM_DEFAULT;
     }
 
     for (Loop = 0; Loop < CS_MAX_NUM_MEMORY_TABLE_ENTRIES; Loop++)
@@ -146,18 +149,21 @@ void CS_InitializeDefaultTables(void)
         CS_AppData.DefaultMemoryDefTable[Loop].State              = CS_STATE_EMPTY;
         CS_AppData.DefaultMemoryDefTable[Loop].NumBytesToChecksum = 0;
         CS_AppData.DefaultMemoryDefTable[Loop].StartAddress       = 0;
+        CS_AppData.DefaultMemoryDefTable[Loop].Algorithm          = CS_ALGORITHM_DEFAULT;
     }
 
     for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.DefaultAppDefTable[Loop].State   = CS_STATE_EMPTY;
-        CS_AppData.DefaultAppDefTable[Loop].Name[0] = '\0';
+        CS_AppData.DefaultAppDefTable[Loop].State     = CS_STATE_EMPTY;
+        CS_AppData.DefaultAppDefTable[Loop].Algorithm = CS_ALGORITHM_DEFAULT;
+        CS_AppData.DefaultAppDefTable[Loop].Name[0]   = '\0';
     }
 
     for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
     {
-        CS_AppData.DefaultTablesDefTable[Loop].State   = CS_STATE_EMPTY;
-        CS_AppData.DefaultTablesDefTable[Loop].Name[0] = '\0';
+        CS_AppData.DefaultTablesDefTable[Loop].State     = CS_STATE_EMPTY;
+        CS_AppData.DefaultTablesDefTable[Loop].Algorithm = CS_ALGORITHM_DEFAULT;
+        CS_AppData.DefaultTablesDefTable[Loop].Name[0]   = '\0';
     }
 }
 
@@ -311,27 +317,9 @@ bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
 {
-    CS_Res_EepromMemory_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry        = NULL;
-    bool                               EnabledEntries      = true;
+    bool EnabledEntries = false;
 
-    StartOfResultsTable = CS_AppData.ResEepromTblPtr;
-
-    ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    while (ResultsEntry->State != CS_STATE_ENABLED)
-    {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
-
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_EEPROM_TABLE_ENTRIES)
-        {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
-        }
-
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-    } /* end while */
+    EnabledEntries = CS_FindNextEnabledEntry(CS_EEPROM_TABLE, &CS_AppData.HkPacket.Payload.CurrentEntryInTable);
 
     *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
 
@@ -345,26 +333,9 @@ bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry)
 {
-    CS_Res_EepromMemory_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry        = NULL;
-    bool                               EnabledEntries      = true;
-
-    StartOfResultsTable = CS_AppData.ResMemoryTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    while (ResultsEntry->State != CS_STATE_ENABLED)
-    {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
-
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_MEMORY_TABLE_ENTRIES)
-        {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
-        }
+    bool EnabledEntries = false;
 
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-    } /* end while */
+    EnabledEntries = CS_FindNextEnabledEntry(CS_MEMORY_TABLE, &CS_AppData.HkPacket.Payload.CurrentEntryInTable);
 
     *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
 
@@ -378,28 +349,9 @@ bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry)
 {
-    CS_Res_Tables_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_Tables_Table_Entry_t *ResultsEntry        = NULL;
-    bool                         EnabledEntries      = true;
-
-    StartOfResultsTable = CS_AppData.ResTablesTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    while (ResultsEntry->State != CS_STATE_ENABLED)
-    {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
-
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_TABLES_TABLE_ENTRIES)
-        {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
+    bool EnabledEntries = false;
 
-            break;
-        }
-
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    } /* end while */
+    EnabledEntries = CS_FindNextEnabledEntry(CS_TABLES_TABLE, &CS_AppData.HkPacket.Payload.CurrentEntryInTable);
 
     *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
 
@@ -412,27 +364,9 @@ bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool CS_FindEnabledAppEntry(uint16 *EnabledEntry)
 {
-    CS_Res_App_Table_Entry_t *StartOfResultsTable = NULL;
-    CS_Res_App_Table_Entry_t *ResultsEntry        = NULL;
-    bool                      EnabledEntries      = true;
-
-    StartOfResultsTable = CS_AppData.ResAppTblPtr;
-    ResultsEntry        = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
+    bool EnabledEntries = false;
 
-    while (ResultsEntry->State != CS_STATE_ENABLED)
-    {
-        CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
-
-        if (CS_AppData.HkPacket.Payload.CurrentEntryInTable >= CS_MAX_NUM_APP_TABLE_ENTRIES)
-        {
-            /* we reached the end no more enabled entries */
-            EnabledEntries = false;
-            break;
-        }
-
-        ResultsEntry = &StartOfResultsTable[CS_AppData.HkPacket.Payload.CurrentEntryInTable];
-
-    } /* end while */
+    EnabledEntries = CS_FindNextEnabledEntry(CS_APP_TABLE, &CS_AppData.HkPacket.Payload.CurrentEntryInTable);
 
     *EnabledEntry = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
 
@@ -480,23 +414,23 @@ bool CS_BackgroundCfeCore(void)
     bool                               DoneWithCycle   = false;
     bool                               DoneWithEntry   = false;
     uint32                             ComputedCSValue = 0;
+    uint32                             BytesRemaining  = 0;
     CFE_Status_t                       Status;
 
     if (CS_AppData.HkPacket.Payload.CfeCoreCSState == CS_STATE_ENABLED)
     {
         ResultsEntry = &CS_AppData.CfeCoreCodeSeg;
 
-        /* Check if the code segment state is enabled (could be disabled for
-           a ground-commanded recompute) */
-        if (ResultsEntry->State == CS_STATE_ENABLED)
+        /* Check if the code segment state is enabled, and skip it while a
+           recompute worker holds it */
+        if ((ResultsEntry->State == CS_STATE_ENABLED) && (CS_RecomputingEntry(CS_CFECORE, 0) == false))
         {
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_CFECORE);
+            Status         = CS_ComputeEepromMemory(ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_CFECORE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -524,7 +458,7 @@ bool CS_BackgroundCfeCore(void)
         }
         else
         {
-            /* Currently disabled, so skip it */
+            /* Currently disabled or being recomputed, so skip it */
             CS_GoToNextTable();
         }
     }
@@ -547,23 +481,23 @@ bool CS_BackgroundOS(void)
     bool                               DoneWithCycle   = false;
     bool                               DoneWithEntry   = false;
     uint32                             ComputedCSValue = 0;
+    uint32                             BytesRemaining  = 0;
     CFE_Status_t                       Status;
 
     if (CS_AppData.HkPacket.Payload.OSCSState == CS_STATE_ENABLED)
     {
         ResultsEntry = &CS_AppData.OSCodeSeg;
 
-        /* Check if the code segment state is enabled (could be disabled for
-         a ground-commanded recompute) */
-        if (ResultsEntry->State == CS_STATE_ENABLED)
+        /* Check if the code segment state is enabled, and skip it while a
+           recompute worker holds it */
+        if ((ResultsEntry->State == CS_STATE_ENABLED) && (CS_RecomputingEntry(CS_OSCORE, 0) == false))
         {
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_OSCORE);
+            Status         = CS_ComputeEepromMemory(ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_OSCORE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -590,7 +524,7 @@ bool CS_BackgroundOS(void)
         }
         else
         {
-            /* Currently disabled, so skip it */
+            /* Currently disabled or being recomputed, so skip it */
             CS_GoToNextTable();
         }
     }
@@ -613,6 +547,7 @@ bool CS_BackgroundEeprom(void)
     bool                               DoneWithCycle   = false;
     bool                               DoneWithEntry   = false;
     uint32                             ComputedCSValue = 0;
+    uint32                             BytesRemaining  = 0;
     int32                              Loop;
     uint32                             EntireEepromCS;
     uint16                             CurrEntry;
@@ -627,12 +562,11 @@ bool CS_BackgroundEeprom(void)
             ResultsEntry        = &StartOfResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_EEPROM_TABLE);
+            Status         = CS_ComputeEepromMemory(ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_EEPROM_TABLE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -648,6 +582,7 @@ bool CS_BackgroundEeprom(void)
 
             if (DoneWithEntry == true)
             {
+                CS_RecordVerification(&ResultsEntry->VerifiedTime, ResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
         }
@@ -688,6 +623,7 @@ bool CS_BackgroundMemory(void)
     bool                               DoneWithCycle   = false;
     bool                               DoneWithEntry   = false;
     uint32                             ComputedCSValue = 0;
+    uint32                             BytesRemaining  = 0;
     uint16                             CurrEntry;
     CFE_Status_t                       Status;
 
@@ -702,12 +638,11 @@ bool CS_BackgroundMemory(void)
             ResultsEntry        = &StartOfResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeEepromMemory(ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_MEMORY_TABLE);
+            Status         = CS_ComputeEepromMemory(ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_MEMORY_TABLE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -723,6 +658,7 @@ bool CS_BackgroundMemory(void)
 
             if (DoneWithEntry == true)
             {
+                CS_RecordVerification(&ResultsEntry->VerifiedTime, ResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
@@ -757,6 +693,7 @@ bool CS_BackgroundTables(void)
     bool                         DoneWithCycle   = false;
     bool                         DoneWithEntry   = false;
     uint32                       ComputedCSValue = 0;
+    uint32                       BytesRemaining  = 0;
     uint16                       CurrEntry;
     CFE_Status_t                 Status;
 
@@ -771,12 +708,11 @@ bool CS_BackgroundTables(void)
             StartOfTablesResultsTable = CS_AppData.ResTablesTblPtr;
             TablesResultsEntry        = &StartOfTablesResultsTable[CurrEntry];
 
-            Status = CS_ComputeTables(TablesResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_TABLES_TABLE);
+            Status         = CS_ComputeTables(TablesResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since  it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_TABLES_TABLE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -795,11 +731,14 @@ bool CS_BackgroundTables(void)
                                   "Tables table computing: Table %s could not be found, skipping",
                                   TablesResultsEntry->Name);
 
+                /* A missing table is not waited on again until it is next due */
+                CS_RecordVerification(&TablesResultsEntry->VerifiedTime, TablesResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
             if (DoneWithEntry == true)
             {
+                CS_RecordVerification(&TablesResultsEntry->VerifiedTime, TablesResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
@@ -834,6 +773,7 @@ bool CS_BackgroundApp(void)
     bool                      DoneWithCycle   = false;
     bool                      DoneWithEntry   = false;
     uint32                    ComputedCSValue = 0;
+    uint32                    BytesRemaining  = 0;
     uint16                    CurrEntry;
     CFE_Status_t              Status;
 
@@ -847,12 +787,11 @@ bool CS_BackgroundApp(void)
             AppResultsEntry        = &StartOfAppResultsTable[CurrEntry];
 
             /* If we complete an entry's checksum, this function will update it for us */
-            Status = CS_ComputeApp(AppResultsEntry, &ComputedCSValue, &DoneWithEntry);
+            BytesRemaining = CS_GetCycleBytes(CS_APP_TABLE);
+            Status         = CS_ComputeApp(AppResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry);
 
-            /* We need to avoid the case of finishing a table, moving on to the next one
-             and computing an entry in that table, since it could put us above the
-             maximum bytes per cycle */
-            DoneWithCycle = true;
+            /* Any bytes left in the cycle's and this type's budgets go on to the next entry or table */
+            DoneWithCycle = CS_UseCycleBytes(CS_APP_TABLE, BytesRemaining);
 
             if (Status == CS_ERROR)
             {
@@ -870,11 +809,14 @@ bool CS_BackgroundApp(void)
                 CFE_EVS_SendEvent(CS_COMPUTE_APP_NOT_FOUND_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "App table computing: App %s could not be found, skipping", AppResultsEntry->Name);
 
+                /* A missing app is not waited on again until it is next due */
+                CS_RecordVerification(&AppResultsEntry->VerifiedTime, AppResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
             if (DoneWithEntry == true)
             {
+                CS_RecordVerification(&AppResultsEntry->VerifiedTime, AppResultsEntry->MaxStaleness);
                 CS_AppData.HkPacket.Payload.CurrentEntryInTable++;
             }
 
@@ -922,8 +864,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
     CFE_Status_t Result    = CFE_SUCCESS;
     CFE_Status_t ErrorCode = CFE_SUCCESS;
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_EEPROM_TABLE)))
+    if (CS_RecomputingTable(CS_EEPROM_TABLE) == false)
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefEepromTblPtr, (void *)&CS_AppData.ResEepromTblPtr,
                                       CS_AppData.DefEepromTableHandle, CS_AppData.ResEepromTableHandle, CS_EEPROM_TABLE,
@@ -939,8 +880,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_MEMORY_TABLE)))
+    if (CS_RecomputingTable(CS_MEMORY_TABLE) == false)
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefMemoryTblPtr, (void *)&CS_AppData.ResMemoryTblPtr,
                                       CS_AppData.DefMemoryTableHandle, CS_AppData.ResMemoryTableHandle, CS_MEMORY_TABLE,
@@ -959,8 +899,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_APP_TABLE)))
+    if (CS_RecomputingTable(CS_APP_TABLE) == false)
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefAppTblPtr, (void *)&CS_AppData.ResAppTblPtr,
                                       CS_AppData.DefAppTableHandle, CS_AppData.ResAppTableHandle, CS_APP_TABLE,
@@ -978,8 +917,7 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
-    if (!((CS_AppData.HkPacket.Payload.RecomputeInProgress == true) && (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
-          (CS_AppData.ChildTaskTable == CS_TABLES_TABLE)))
+    if (CS_RecomputingTable(CS_TABLES_TABLE) == false)
     {
         Result = CS_HandleTableUpdate((void *)&CS_AppData.DefTablesTblPtr, (void *)&CS_AppData.ResTablesTblPtr,
                                       CS_AppData.DefTablesTableHandle, CS_AppData.ResTablesTableHandle, CS_TABLES_TABLE,
@@ -998,6 +936,19 @@ CFE_Status_t CS_HandleRoutineTableUpdates(void)
         }
     }
 
+    Result = CS_HandleBudgetTableUpdate();
+
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CS_UPDATE_BUDGET_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Table update failed for byte budgets: 0x%08X, using the shared bytes per cycle",
+                          (unsigned int)Result);
+        if (ErrorCode == CFE_SUCCESS)
+        {
+            ErrorCode = Result;
+        }
+    }
+
     return ErrorCode;
 }
 
@@ -1044,3 +995,981 @@ bool CS_CheckRecomputeOneshot(void)
     }
     return Result;
 }
+
+void CS_CalibrateDefaultCRC(void)
+{
+    static const char *const KernelNames[] = {"table", "hardware", "cFE"};
+
+    uint32 KBytesPerSec = 0;
+    uint8  Kernel;
+
+    Kernel = CS_CalibrateCRC(CS_DEFAULT_ALGORITHM, &KBytesPerSec);
+
+    CS_AppData.HkPacket.Payload.CrcKernel           = Kernel;
+    CS_AppData.HkPacket.Payload.CrcKernelThroughput = KBytesPerSec;
+
+    CFE_EVS_SendEvent(CS_CALIBRATE_CRC_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "CRC calibration selected the %s kernel for algorithm %d at %lu KB/s",
+                      (Kernel < sizeof(KernelNames) / sizeof(KernelNames[0])) ? KernelNames[Kernel] : "unknown",
+                      (int)CS_DEFAULT_ALGORITHM, (unsigned long)KBytesPerSec);
+}
+
+void CS_UpdateBytesPerCycle(uint32 CycleTime, uint32 CycleBytes)
+{
+    uint32 Target = CS_AppData.HkPacket.Payload.CycleTimeTarget;
+    uint64 NewBytesPerCycle;
+
+    if (CycleTime > Target)
+    {
+        CS_AppData.HkPacket.Payload.CycleOvershootCount++;
+
+        if ((CycleTime - Target) > CS_AppData.HkPacket.Payload.MaxCycleOvershoot)
+        {
+            CS_AppData.HkPacket.Payload.MaxCycleOvershoot = CycleTime - Target;
+        }
+    }
+
+    /* A cycle that checksummed nothing says nothing about throughput */
+    if (CycleBytes != 0)
+    {
+        /* Scale the measured throughput to the target, but grow by no more
+           than double each cycle so a single fast cycle cannot cause a long
+           overshoot. A cycle too short to measure just doubles */
+        if (CycleTime == 0)
+        {
+            NewBytesPerCycle = (uint64)CycleBytes * 2;
+        }
+        else
+        {
+            NewBytesPerCycle = ((uint64)CycleBytes * Target) / CycleTime;
+
+            if (NewBytesPerCycle > ((uint64)CycleBytes * 2))
+            {
+                NewBytesPerCycle = (uint64)CycleBytes * 2;
+            }
+        }
+
+        if (NewBytesPerCycle < CS_MIN_ADAPTIVE_BYTES_PER_CYCLE)
+        {
+            NewBytesPerCycle = CS_MIN_ADAPTIVE_BYTES_PER_CYCLE;
+        }
+        else if (NewBytesPerCycle > CS_MAX_ADAPTIVE_BYTES_PER_CYCLE)
+        {
+            NewBytesPerCycle = CS_MAX_ADAPTIVE_BYTES_PER_CYCLE;
+        }
+
+        CS_AppData.MaxBytesPerCycle = (uint32)NewBytesPerCycle;
+    }
+}
+
+uint32 CS_GetBytesPerCycle(uint16 Budget)
+{
+    uint32 BytesPerCycle = CS_AppData.MaxBytesPerCycle;
+
+    /* Child tasks call this too, so the budgets are read from the copy the main task keeps */
+    if ((Budget < CS_NUM_BUDGETS) && (CS_AppData.BytesPerCycleBudget[Budget] != 0))
+    {
+        BytesPerCycle = CS_AppData.BytesPerCycleBudget[Budget];
+    }
+
+    return BytesPerCycle;
+}
+
+void CS_ResetCycleBytes(void)
+{
+    uint16 Table;
+
+    CS_AppData.CycleBytesBudget    = CS_ShareCycleBytes(CS_AppData.MaxBytesPerCycle);
+    CS_AppData.CycleBytesRemaining = CS_AppData.CycleBytesBudget;
+
+    for (Table = 0; Table < CS_NUM_TABLES; Table++)
+    {
+        CS_AppData.TableBytesRemaining[Table] = CS_GetBytesPerCycle(Table);
+    }
+}
+
+uint32 CS_GetCycleBytes(uint16 Table)
+{
+    uint32 Bytes = CS_AppData.CycleBytesRemaining;
+
+    if (CS_AppData.TableBytesRemaining[Table] < Bytes)
+    {
+        Bytes = CS_AppData.TableBytesRemaining[Table];
+    }
+
+    return Bytes;
+}
+
+bool CS_UseCycleBytes(uint16 Table, uint32 BytesLeft)
+{
+    uint32 Available = CS_GetCycleBytes(Table);
+    uint32 Used      = Available - BytesLeft;
+
+    CS_AppData.CycleBytesRemaining -= Used;
+    CS_AppData.TableBytesRemaining[Table] -= Used;
+
+    CS_AppData.HkPacket.Payload.BytesChecked[Table] += Used;
+
+    return (BytesLeft == 0);
+}
+
+uint32 CS_GetCurrentSeconds(void)
+{
+    OS_time_t Now;
+
+    OS_GetLocalTime(&Now);
+
+    return (uint32)OS_TimeGetTotalSeconds(Now);
+}
+
+void CS_RecordVerification(uint32 *VerifiedTime, uint32 MaxStaleness)
+{
+    uint32 Now = CS_GetCurrentSeconds();
+
+    if (CS_GetLateness(CS_STATE_ENABLED, MaxStaleness, *VerifiedTime, Now) != 0)
+    {
+        CS_AppData.HkPacket.Payload.DeadlineMissCount++;
+    }
+
+    *VerifiedTime = Now;
+}
+
+uint32 CS_GetLateness(uint16 State, uint32 MaxStaleness, uint32 VerifiedTime, uint32 Now)
+{
+    uint32 Age      = Now - VerifiedTime;
+    uint32 Lateness = 0;
+
+    if ((State == CS_STATE_ENABLED) && (MaxStaleness != 0) && (Age > MaxStaleness))
+    {
+        Lateness = Age - MaxStaleness;
+    }
+
+    return Lateness;
+}
+
+bool CS_FindOverdueEntry(uint16 *Table, uint16 *Entry)
+{
+    uint32 Now      = CS_GetCurrentSeconds();
+    uint32 MostLate = 0;
+    uint32 Lateness;
+    uint16 Loop;
+
+    /* Ties go to the entry found first, in background table order. Entries
+       held by a recompute worker wait until the worker is done */
+    if (CS_AppData.HkPacket.Payload.EepromCSState == CS_STATE_ENABLED)
+    {
+        for (Loop = 0; Loop < CS_MAX_NUM_EEPROM_TABLE_ENTRIES; Loop++)
+        {
+            Lateness = CS_GetLateness(CS_AppData.ResEepromTblPtr[Loop].State,
+                                      CS_AppData.ResEepromTblPtr[Loop].MaxStaleness,
+                                      CS_AppData.ResEepromTblPtr[Loop].VerifiedTime, Now);
+            if ((Lateness > MostLate) && (CS_RecomputingEntry(CS_EEPROM_TABLE, Loop) == false))
+            {
+                MostLate = Lateness;
+                *Table   = CS_EEPROM_TABLE;
+                *Entry   = Loop;
+            }
+        }
+    }
+
+    if (CS_AppData.HkPacket.Payload.MemoryCSState == CS_STATE_ENABLED)
+    {
+        for (Loop = 0; Loop < CS_MAX_NUM_MEMORY_TABLE_ENTRIES; Loop++)
+        {
+            Lateness = CS_GetLateness(CS_AppData.ResMemoryTblPtr[Loop].State,
+                                      CS_AppData.ResMemoryTblPtr[Loop].MaxStaleness,
+                                      CS_AppData.ResMemoryTblPtr[Loop].VerifiedTime, Now);
+            if ((Lateness > MostLate) && (CS_RecomputingEntry(CS_MEMORY_TABLE, Loop) == false))
+            {
+                MostLate = Lateness;
+                *Table   = CS_MEMORY_TABLE;
+                *Entry   = Loop;
+            }
+        }
+    }
+
+    if (CS_AppData.HkPacket.Payload.TablesCSState == CS_STATE_ENABLED)
+    {
+        for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
+        {
+            Lateness = CS_GetLateness(CS_AppData.ResTablesTblPtr[Loop].State,
+                                      CS_AppData.ResTablesTblPtr[Loop].MaxStaleness,
+                                      CS_AppData.ResTablesTblPtr[Loop].VerifiedTime, Now);
+            if ((Lateness > MostLate) && (CS_RecomputingEntry(CS_TABLES_TABLE, Loop) == false))
+            {
+                MostLate = Lateness;
+                *Table   = CS_TABLES_TABLE;
+                *Entry   = Loop;
+            }
+        }
+    }
+
+    if (CS_AppData.HkPacket.Payload.AppCSState == CS_STATE_ENABLED)
+    {
+        for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
+        {
+            Lateness = CS_GetLateness(CS_AppData.ResAppTblPtr[Loop].State, CS_AppData.ResAppTblPtr[Loop].MaxStaleness,
+                                      CS_AppData.ResAppTblPtr[Loop].VerifiedTime, Now);
+            if ((Lateness > MostLate) && (CS_RecomputingEntry(CS_APP_TABLE, Loop) == false))
+            {
+                MostLate = Lateness;
+                *Table   = CS_APP_TABLE;
+                *Entry   = Loop;
+            }
+        }
+    }
+
+    return (MostLate != 0);
+}
+
+bool CS_BackgroundEntry(uint16 Table, uint16 *Entry, bool *TableDone)
+{
+    bool   DoneWithCycle = false;
+    uint16 SavedTable    = CS_AppData.HkPacket.Payload.CurrentCSTable;
+    uint16 SavedEntry    = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+    uint32 SavedPass     = CS_AppData.HkPacket.Payload.PassCounter;
+
+    /* Checksum the entry through the usual background function, then put
+       the sequential sweep back where it was */
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = Table;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = *Entry;
+
+    switch (Table)
+    {
+        case (CS_CFECORE):
+            DoneWithCycle = CS_BackgroundCfeCore();
+            break;
+
+        case (CS_OSCORE):
+            DoneWithCycle = CS_BackgroundOS();
+            break;
+
+        case (CS_EEPROM_TABLE):
+            DoneWithCycle = CS_BackgroundEeprom();
+            break;
+
+        case (CS_MEMORY_TABLE):
+            DoneWithCycle = CS_BackgroundMemory();
+            break;
+
+        case (CS_TABLES_TABLE):
+            DoneWithCycle = CS_BackgroundTables();
+            break;
+
+        case (CS_APP_TABLE):
+            DoneWithCycle = CS_BackgroundApp();
+            break;
+
+        default:
+            DoneWithCycle = true;
+            break;
+    }
+
+    /* A table that is done has moved the cursor on to the next one */
+    if (CS_AppData.HkPacket.Payload.CurrentCSTable == Table)
+    {
+        *Entry     = CS_AppData.HkPacket.Payload.CurrentEntryInTable;
+        *TableDone = false;
+    }
+    else
+    {
+        *Entry     = 0;
+        *TableDone = true;
+    }
+
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = SavedTable;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = SavedEntry;
+    CS_AppData.HkPacket.Payload.PassCounter         = SavedPass;
+
+    return DoneWithCycle;
+}
+
+uint32 CS_GetWeightedQuantum(uint16 Table)
+{
+    uint64 TotalWeight = 0;
+    uint64 Weight      = 1;
+    uint64 Quantum     = 0;
+    uint16 Loop;
+
+    if (CS_AppData.DefBudgetTblPtr != NULL)
+    {
+        for (Loop = 0; Loop < CS_NUM_TABLES; Loop++)
+        {
+            TotalWeight += CS_AppData.DefBudgetTblPtr->Weight[Loop];
+        }
+    }
+
+    /* Without weights every checksum type gets an equal share */
+    if (TotalWeight == 0)
+    {
+        TotalWeight = CS_NUM_TABLES;
+    }
+    else
+    {
+        Weight = CS_AppData.DefBudgetTblPtr->Weight[Table];
+    }
+
+    /* One turn of every checksum type takes about one background cycle */
+    if (Weight != 0)
+    {
+        Quantum = (CS_AppData.MaxBytesPerCycle * Weight) / TotalWeight;
+
+        if (Quantum == 0)
+        {
+            Quantum = 1;
+        }
+    }
+
+    return (uint32)Quantum;
+}
+
+uint32 CS_BackgroundChunk(uint16 Table, uint32 ChunkBytes)
+{
+    uint32 TableBytes = CS_AppData.TableBytesRemaining[Table];
+    uint32 Limit      = (ChunkBytes < TableBytes) ? ChunkBytes : TableBytes;
+    uint32 Used       = 0;
+    bool   TableDone  = false;
+
+    if (Limit != 0)
+    {
+        /* The type's budget is narrowed to the chunk for the one call */
+        CS_AppData.TableBytesRemaining[Table] = Limit;
+        CS_BackgroundEntry(Table, &CS_AppData.HkPacket.Payload.EntryCursor[Table], &TableDone);
+
+        Used                                  = Limit - CS_AppData.TableBytesRemaining[Table];
+        CS_AppData.TableBytesRemaining[Table] = TableBytes - Used;
+
+        if (TableDone == true)
+        {
+            CS_CategoryPassDone(Table);
+        }
+    }
+
+    return Used;
+}
+
+void CS_CategoryPassDone(uint16 Table)
+{
+    CS_AppData.CategoriesDone |= (uint16)(1U << Table);
+
+    /* The pass is done once every checksum type has been through its table */
+    if (CS_AppData.CategoriesDone == (uint16)((1U << CS_NUM_TABLES) - 1))
+    {
+        CS_AppData.HkPacket.Payload.PassCounter++;
+        CS_AppData.CategoriesDone = 0;
+    }
+}
+
+bool CS_BackgroundWeighted(void)
+{
+    bool   Served    = false;
+    uint16 IdleCount = 0;
+    uint16 Table;
+    uint32 Used;
+
+    while ((Served == false) && (IdleCount < CS_NUM_TABLES))
+    {
+        Table = CS_AppData.HkPacket.Payload.CurrentCategory;
+        Used  = 0;
+
+        /* A checksum type starting its turn gets its quantum */
+        if (CS_AppData.Deficit[Table] == 0)
+        {
+            CS_AppData.Deficit[Table] = CS_GetWeightedQuantum(Table);
+        }
+
+        if (CS_AppData.Deficit[Table] != 0)
+        {
+            Used = CS_BackgroundChunk(Table, CS_AppData.Deficit[Table]);
+            CS_AppData.Deficit[Table] -= Used;
+        }
+        else
+        {
+            /* A type with no weight is never checksummed, so it does not hold up the pass */
+            CS_CategoryPassDone(Table);
+        }
+
+        if (Used == 0)
+        {
+            /* Nothing to checksum, so the unused turn is not saved up. A type
+               that used its own budget keeps its turn for the next cycle */
+            if (CS_AppData.TableBytesRemaining[Table] != 0)
+            {
+                CS_AppData.Deficit[Table] = 0;
+            }
+
+            IdleCount++;
+        }
+        else
+        {
+            Served = true;
+        }
+
+        if ((CS_AppData.Deficit[Table] == 0) || (Used == 0))
+        {
+            CS_AppData.HkPacket.Payload.CurrentCategory = (Table + 1) % CS_NUM_TABLES;
+        }
+    }
+
+    return (CS_AppData.CycleBytesRemaining == 0);
+}
+
+bool CS_BackgroundInterleaved(void)
+{
+    bool   Served    = false;
+    uint16 IdleCount = 0;
+    uint16 Table;
+    uint32 ChunkBytes;
+
+    /* Every checksum type gets an equal chunk, whatever its weight */
+    ChunkBytes = CS_AppData.MaxBytesPerCycle / CS_NUM_TABLES;
+
+    if (ChunkBytes == 0)
+    {
+        ChunkBytes = 1;
+    }
+
+    while ((Served == false) && (IdleCount < CS_NUM_TABLES))
+    {
+        Table = CS_AppData.HkPacket.Payload.CurrentCategory;
+
+        if (CS_BackgroundChunk(Table, ChunkBytes) == 0)
+        {
+            IdleCount++;
+        }
+        else
+        {
+            Served = true;
+        }
+
+        /* One chunk is a whole turn, checksummed or not */
+        CS_AppData.HkPacket.Payload.CurrentCategory = (Table + 1) % CS_NUM_TABLES;
+    }
+
+    return (CS_AppData.CycleBytesRemaining == 0);
+}
+
+uint32 *CS_GetEnabledMap(uint16 Table, uint16 *NumEntries)
+{
+    uint32 *Map = NULL;
+
+    switch (Table)
+    {
+        case (CS_EEPROM_TABLE):
+            Map         = CS_AppData.EepromEnabledMap;
+            *NumEntries = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
+            break;
+
+        case (CS_MEMORY_TABLE):
+            Map         = CS_AppData.MemoryEnabledMap;
+            *NumEntries = CS_MAX_NUM_MEMORY_TABLE_ENTRIES;
+            break;
+
+        case (CS_TABLES_TABLE):
+            Map         = CS_AppData.TablesEnabledMap;
+            *NumEntries = CS_MAX_NUM_TABLES_TABLE_ENTRIES;
+            break;
+
+        case (CS_APP_TABLE):
+            Map         = CS_AppData.AppEnabledMap;
+            *NumEntries = CS_MAX_NUM_APP_TABLE_ENTRIES;
+            break;
+
+        default:
+            /* The cFE core and OS have no table of entries */
+            *NumEntries = 0;
+            break;
+    }
+
+    return Map;
+}
+
+void CS_SetEntryEnabled(uint16 Table, uint16 Entry, bool Enabled)
+{
+    uint16  NumEntries = 0;
+    uint32 *Map        = CS_GetEnabledMap(Table, &NumEntries);
+
+    if (Entry < NumEntries)
+    {
+        if (Enabled == true)
+        {
+            Map[Entry / 32] |= ((uint32)1 << (Entry % 32));
+        }
+        else
+        {
+            Map[Entry / 32] &= ~((uint32)1 << (Entry % 32));
+        }
+    }
+}
+
+uint16 CS_FirstSetBit(uint32 Word)
+{
+#if defined(__GNUC__)
+    return (uint16)__builtin_ctz(Word);
+#else
+    uint16 Bit = 0;
+
+    while ((Word & 1) == 0)
+    {
+        Word >>= 1;
+        Bit++;
+    }
+
+    return Bit;
+#endif
+}
+
+bool CS_FindNextEnabledEntry(uint16 Table, uint16 *Entry)
+{
+    bool    Found      = false;
+    uint16  NumEntries = 0;
+    uint32 *Map        = CS_GetEnabledMap(Table, &NumEntries);
+    uint16  Index;
+    uint32  Word;
+
+    while ((Found == false) && (*Entry < NumEntries))
+    {
+        /* The entries before the starting one are masked out of its word */
+        Index = *Entry / 32;
+        Word  = Map[Index] & (0xFFFFFFFF << (*Entry % 32));
+
+        while ((Word == 0) && (++Index < CS_ENABLED_MAP_WORDS(NumEntries)))
+        {
+            Word = Map[Index];
+        }
+
+        if (Word == 0)
+        {
+            *Entry = NumEntries;
+        }
+        else
+        {
+            *Entry = (Index * 32) + CS_FirstSetBit(Word);
+
+            /* The background leaves an entry alone while a recompute worker holds it */
+            if (CS_RecomputingEntry(Table, *Entry) == true)
+            {
+                (*Entry)++;
+            }
+            else
+            {
+                Found = true;
+            }
+        }
+    }
+
+    /* Like the end of a sweep, no enabled entry leaves the index past the table */
+    if (Found == false)
+    {
+        *Entry = NumEntries;
+    }
+
+    return Found;
+}
+
+bool CS_ChildTaskIsFree(void)
+{
+    /* Queued requests start first, so a new request waits its turn
+       behind them unless it is the queued request being started */
+    return ((CS_AppData.HkPacket.Payload.RecomputeWorkersBusy < CS_MAX_RECOMPUTE_WORKERS) &&
+            (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
+            ((CS_AppData.HkPacket.Payload.RequestQueueDepth == 0) || (CS_AppData.StartingQueuedRequest == true)));
+}
+
+bool CS_QueueChildTaskRequest(const CFE_MSG_Message_t *MsgPtr, size_t MsgSize)
+{
+    bool              Queued      = false;
+    uint16            Tail        = 0;
+    CFE_MSG_FcnCode_t CommandCode = 0;
+
+    if ((CS_AppData.StartingQueuedRequest == true) && (MsgSize <= sizeof(CS_ChildTaskRequest_t)))
+    {
+        /* A queued request that has to wait for the running ones goes back to the head of the queue */
+        CS_AppData.RequestQueueHead =
+            (CS_AppData.RequestQueueHead + CS_MAX_QUEUED_REQUESTS - 1) % CS_MAX_QUEUED_REQUESTS;
+
+        memcpy(&CS_AppData.RequestQueue[CS_AppData.RequestQueueHead], MsgPtr, MsgSize);
+
+        CS_AppData.HkPacket.Payload.RequestQueueDepth++;
+
+        Queued = true;
+    }
+    else if ((CS_AppData.HkPacket.Payload.RequestQueueDepth < CS_MAX_QUEUED_REQUESTS) &&
+             (MsgSize <= sizeof(CS_ChildTaskRequest_t)))
+    {
+        Tail = (CS_AppData.RequestQueueHead + CS_AppData.HkPacket.Payload.RequestQueueDepth) % CS_MAX_QUEUED_REQUESTS;
+
+        memcpy(&CS_AppData.RequestQueue[Tail], MsgPtr, MsgSize);
+
+        CS_AppData.HkPacket.Payload.RequestQueueDepth++;
+        CS_AppData.HkPacket.Payload.QueuedRequestCount++;
+
+        CFE_MSG_GetFcnCode(MsgPtr, &CommandCode);
+
+        CFE_EVS_SendEvent(CS_REQUEST_QUEUED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Child task in use, command code %d queued behind %d request(s)", (int)CommandCode,
+                          (int)(CS_AppData.HkPacket.Payload.RequestQueueDepth - 1));
+
+        Queued = true;
+    }
+    else
+    {
+        CS_AppData.HkPacket.Payload.DroppedRequestCount++;
+    }
+
+    return Queued;
+}
+
+void CS_StartQueuedRequests(void)
+{
+    CS_ChildTaskRequest_t Request;
+    uint16                DepthLeft = 0;
+    bool                  PutBack   = false;
+
+    /* A request that fails to start leaves its worker free for the next one */
+    while ((CS_AppData.HkPacket.Payload.RecomputeWorkersBusy < CS_MAX_RECOMPUTE_WORKERS) &&
+           (CS_AppData.HkPacket.Payload.OneShotInProgress == false) &&
+           (CS_AppData.HkPacket.Payload.RequestQueueDepth != 0) && (PutBack == false))
+    {
+        Request = CS_AppData.RequestQueue[CS_AppData.RequestQueueHead];
+
+        CS_AppData.RequestQueueHead = (CS_AppData.RequestQueueHead + 1) % CS_MAX_QUEUED_REQUESTS;
+        CS_AppData.HkPacket.Payload.RequestQueueDepth--;
+        DepthLeft = CS_AppData.HkPacket.Payload.RequestQueueDepth;
+
+        CS_AppData.StartingQueuedRequest = true;
+        CS_ProcessCmd(&Request.Buf);
+        CS_AppData.StartingQueuedRequest = false;
+
+        /* A one shot goes back to the head of the queue until the recomputes ahead of it have finished */
+        PutBack = (CS_AppData.HkPacket.Payload.RequestQueueDepth > DepthLeft);
+    }
+}
+
+CFE_Status_t CS_StartRecomputeWorker(uint16 Table, uint16 EntryID, void *EntryPtr,
+                                     CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    CFE_Status_t          Status   = CFE_SUCCESS;
+    uint16                WorkerID = CS_MAX_RECOMPUTE_WORKERS;
+    uint16                i;
+    CS_RecomputeWorker_t *Worker;
+
+    /* The worker looks itself up under the mutex, so it is held until the entry is recorded */
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        if (CS_AppData.RecomputeWorkers[i].EntryPtr == EntryPtr)
+        {
+            Status = CS_ENTRY_LOCKED;
+        }
+        else if ((CS_AppData.RecomputeWorkers[i].EntryPtr == NULL) && (WorkerID == CS_MAX_RECOMPUTE_WORKERS))
+        {
+            WorkerID = i;
+        }
+    }
+
+    if (Status == CS_ENTRY_LOCKED)
+    {
+        CFE_EVS_SendEvent(CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Recompute baseline of table %d entry %d failed: entry is already being recomputed",
+                          (int)Table, (int)EntryID);
+    }
+    else if (WorkerID == CS_MAX_RECOMPUTE_WORKERS)
+    {
+        Status = CS_ERROR;
+    }
+    else
+    {
+        Worker = &CS_AppData.RecomputeWorkers[WorkerID];
+
+        Worker->Table    = Table;
+        Worker->EntryID  = EntryID;
+        Worker->EntryPtr = EntryPtr;
+
+        /* The worker task was created at startup and is waiting for work */
+        Status = CS_PostWork(Worker->QueueID, WorkFunc);
+
+        if (Status == CFE_SUCCESS)
+        {
+            CS_AppData.HkPacket.Payload.RecomputeWorkersBusy++;
+            CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+        }
+        else
+        {
+            Worker->EntryPtr = NULL;
+        }
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return Status;
+}
+
+CFE_Status_t CS_PostWork(osal_id_t QueueID, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    CFE_Status_t Status = CFE_SUCCESS;
+    int32        OsStatus;
+
+    OsStatus = OS_QueuePut(QueueID, &WorkFunc, sizeof(WorkFunc), 0);
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        Status = (CFE_Status_t)OsStatus;
+    }
+
+    return Status;
+}
+
+osal_id_t CS_FindWorkerQueue(void)
+{
+    CFE_ES_TaskId_t TaskID  = CFE_ES_TASKID_UNDEFINED;
+    osal_id_t       QueueID = OS_OBJECT_ID_UNDEFINED;
+    uint16          i;
+    uint16          j;
+
+    CFE_ES_GetTaskID(&TaskID);
+
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    if (CFE_RESOURCEID_TEST_EQUAL(CS_AppData.ChildTaskID, TaskID))
+    {
+        QueueID = CS_AppData.OneShotQueueID;
+    }
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(CS_AppData.RecomputeWorkers[i].TaskID, TaskID))
+        {
+            QueueID = CS_AppData.RecomputeWorkers[i].QueueID;
+        }
+
+        for (j = 0; j < CS_NUM_SUB_RANGES; j++)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(CS_AppData.RecomputeWorkers[i].SubRangeTaskID[j], TaskID))
+            {
+                QueueID = CS_AppData.RecomputeWorkers[i].SubRangeQueueID[j];
+            }
+        }
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return QueueID;
+}
+
+uint16 CS_FindRecomputeWorker(void)
+{
+    CFE_ES_TaskId_t TaskID   = CFE_ES_TASKID_UNDEFINED;
+    uint16          WorkerID = CS_MAX_RECOMPUTE_WORKERS;
+    uint16          i;
+
+    CFE_ES_GetTaskID(&TaskID);
+
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        if ((CS_AppData.RecomputeWorkers[i].EntryPtr != NULL) &&
+            CFE_RESOURCEID_TEST_EQUAL(CS_AppData.RecomputeWorkers[i].TaskID, TaskID))
+        {
+            WorkerID = i;
+        }
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return WorkerID;
+}
+
+void CS_ReleaseRecomputeWorker(uint16 WorkerID)
+{
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    if ((WorkerID < CS_MAX_RECOMPUTE_WORKERS) && (CS_AppData.RecomputeWorkers[WorkerID].EntryPtr != NULL))
+    {
+        /* The worker task stays, waiting for its next recompute */
+        CS_AppData.RecomputeWorkers[WorkerID].EntryPtr = NULL;
+
+        CS_AppData.HkPacket.Payload.RecomputeWorkersBusy--;
+        CS_AppData.HkPacket.Payload.RecomputeInProgress = (CS_AppData.HkPacket.Payload.RecomputeWorkersBusy != 0);
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+}
+
+void CS_ResetRecomputeDefTableEntry(CS_Res_Tables_Table_Entry_t *TablesTblResultEntry, CFE_TBL_Handle_t DefTblHandle)
+{
+    /* Workers recomputing entries of the same type share the Tables entry of their definition table */
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    CS_ResetTablesTblResultEntry(TablesTblResultEntry);
+    CFE_TBL_Modified(DefTblHandle);
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+}
+
+CFE_Status_t CS_StartSubRangeTask(uint16 WorkerID, uint16 SubRange, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    CFE_Status_t          Status = CFE_SUCCESS;
+    CS_RecomputeWorker_t *Worker = &CS_AppData.RecomputeWorkers[WorkerID];
+
+    /* The sub-range task looks its work up under the mutex, so it is held until the work is posted */
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    /* A sub-range task that could not be created at startup has no queue */
+    if (OS_ObjectIdDefined(Worker->SubRangeQueueID[SubRange]) == false)
+    {
+        Status = CS_ERROR;
+    }
+    else
+    {
+        Worker->SubRangeBusyMask |= ((uint32)1 << SubRange);
+
+        Status = CS_PostWork(Worker->SubRangeQueueID[SubRange], WorkFunc);
+
+        if (Status != CFE_SUCCESS)
+        {
+            Worker->SubRangeBusyMask &= ~((uint32)1 << SubRange);
+        }
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return Status;
+}
+
+bool CS_FindSubRangeTask(uint16 *WorkerID, uint16 *SubRange)
+{
+    CFE_ES_TaskId_t TaskID = CFE_ES_TASKID_UNDEFINED;
+    bool            Found  = false;
+    uint16          i;
+    uint16          j;
+
+    CFE_ES_GetTaskID(&TaskID);
+
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        for (j = 0; j < CS_NUM_SUB_RANGES; j++)
+        {
+            if ((CS_AppData.RecomputeWorkers[i].EntryPtr != NULL) &&
+                ((CS_AppData.RecomputeWorkers[i].SubRangeBusyMask & ((uint32)1 << j)) != 0) &&
+                CFE_RESOURCEID_TEST_EQUAL(CS_AppData.RecomputeWorkers[i].SubRangeTaskID[j], TaskID))
+            {
+                *WorkerID = i;
+                *SubRange = j;
+                Found     = true;
+            }
+        }
+    }
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return Found;
+}
+
+void CS_FinishSubRange(uint16 WorkerID, uint16 SubRange, uint32 SubRangeChecksum)
+{
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = NULL;
+
+    /* Sub-range tasks finish at the same time, so the mask is only changed under the mutex */
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    ResultsEntry = CS_AppData.RecomputeWorkers[WorkerID].EntryPtr;
+
+    ResultsEntry->SubRangeChecksum[SubRange] = SubRangeChecksum;
+    ResultsEntry->SubRangeMask |= ((uint32)1 << SubRange);
+
+    CS_AppData.RecomputeWorkers[WorkerID].SubRangeBusyMask &= ~((uint32)1 << SubRange);
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+}
+
+bool CS_SubRangesRunning(uint16 WorkerID)
+{
+    bool Running = false;
+
+    OS_MutSemTake(CS_AppData.WorkerMutex);
+
+    Running = (CS_AppData.RecomputeWorkers[WorkerID].SubRangeBusyMask != 0);
+
+    OS_MutSemGive(CS_AppData.WorkerMutex);
+
+    return Running;
+}
+
+bool CS_RecomputingTable(uint16 Table)
+{
+    bool   Recomputing = false;
+    uint16 i;
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        if ((CS_AppData.RecomputeWorkers[i].EntryPtr != NULL) && (CS_AppData.RecomputeWorkers[i].Table == Table))
+        {
+            Recomputing = true;
+        }
+    }
+
+    return Recomputing;
+}
+
+bool CS_RecomputingEntry(uint16 Table, uint16 EntryID)
+{
+    bool                         Recomputing = false;
+    CS_Res_Tables_Table_Entry_t *TablesEntry = NULL;
+    uint16                       i;
+
+    /* Only the command handlers claim entries, so a claim seen here can not
+       be made while the background is using the entry */
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        if ((CS_AppData.RecomputeWorkers[i].EntryPtr != NULL) && (CS_AppData.RecomputeWorkers[i].Table == Table) &&
+            (CS_AppData.RecomputeWorkers[i].EntryID == EntryID))
+        {
+            Recomputing = true;
+        }
+    }
+
+    /* A worker resets the Tables entry of the CS definition table it recomputes from,
+       so that entry is left alone until the worker is done with it too */
+    if ((Recomputing == false) && (Table == CS_TABLES_TABLE) && (CS_AppData.ResTablesTblPtr != NULL) &&
+        (EntryID < CS_MAX_NUM_TABLES_TABLE_ENTRIES))
+    {
+        TablesEntry = &CS_AppData.ResTablesTblPtr[EntryID];
+
+        if (((TablesEntry == CS_AppData.EepResTablesTblPtr) && CS_RecomputingTable(CS_EEPROM_TABLE)) ||
+            ((TablesEntry == CS_AppData.MemResTablesTblPtr) && CS_RecomputingTable(CS_MEMORY_TABLE)) ||
+            ((TablesEntry == CS_AppData.AppResTablesTblPtr) && CS_RecomputingTable(CS_APP_TABLE)) ||
+            ((TablesEntry == CS_AppData.TblResTablesTblPtr) && CS_RecomputingTable(CS_TABLES_TABLE)))
+        {
+            Recomputing = true;
+        }
+    }
+
+    return Recomputing;
+}
+
+uint32 CS_ShareCycleBytes(uint32 Bytes)
+{
+    uint32 Sharers = 1 + CS_AppData.HkPacket.Payload.RecomputeWorkersBusy;
+    uint32 Share;
+
+    if (CS_AppData.HkPacket.Payload.OneShotInProgress == true)
+    {
+        Sharers++;
+    }
+
+    /* The background keeps checksumming with an equal share of the bytes
+       alongside each running child task, but never less than a byte */
+    Share = Bytes / Sharers;
+
+    if ((Share == 0) && (Bytes != 0))
+    {
+        Share = 1;
+    }
+
+    return Share;
+}
@@ -244,7 +244,7 @@ bool CS_GetAppDefTblEntryByName(CS_Def_App_Table_Entry_t **EntryPtr, const char
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Goes by the table's enabled map, see #CS_SetEntryEnabled.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -268,7 +268,7 @@ bool CS_FindEnabledEepromEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Goes by the table's enabled map, see #CS_SetEntryEnabled.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -292,7 +292,7 @@ bool CS_FindEnabledMemoryEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Goes by the table's enabled map, see #CS_SetEntryEnabled.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -316,7 +316,7 @@ bool CS_FindEnabledTablesEntry(uint16 *EnabledEntry);
  *       the table to find an enabled entry.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       Goes by the table's enabled map, see #CS_SetEntryEnabled.
  *
  *  \param [in]      EnabledEntry   A pointer to a uint16 that will be
  *                                  assigned an enabled entry ID, if
@@ -368,9 +368,9 @@ bool CS_VerifyCmdLength(const CFE_MSG_Message_t *msg, size_t ExpectedLength);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundOS(void);
 
@@ -383,9 +383,9 @@ bool CS_BackgroundOS(void);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundCfeCore(void);
 
@@ -398,9 +398,9 @@ bool CS_BackgroundCfeCore(void);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundEeprom(void);
 
@@ -413,9 +413,9 @@ bool CS_BackgroundEeprom(void);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundMemory(void);
 
@@ -428,9 +428,9 @@ bool CS_BackgroundMemory(void);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundTables(void);
 
@@ -443,9 +443,9 @@ bool CS_BackgroundTables(void);
  *  \par Assumptions, External Events, and Notes:
  *       None
  *
- *  \return Boolean checksum performed response
- *  \retval true  Checksum was done
- *  \retval false Checksum was not done
+ *  \return Boolean cycle finished response
+ *  \retval true  The cycle's byte budget has been used
+ *  \retval false Bytes are left for the next entry or table
  */
 bool CS_BackgroundApp(void);
 
@@ -502,4 +502,668 @@ CFE_Status_t CS_AttemptTableReshare(CS_Res_Tables_Table_Entry_t *ResultsEntry, C
 
 bool CS_CheckRecomputeOneshot(void);
 
+/**
+ * \brief Selects the fastest kernel for the default algorithm
+ *
+ *  \par Description
+ *       Times the kernels that can compute #CS_DEFAULT_ALGORITHM,
+ *       selects the fastest that gives the exact result, and reports
+ *       the choice in housekeeping and in an event message.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called at startup and by #CS_CALIBRATE_CRC_CC.
+ */
+void CS_CalibrateDefaultCRC(void);
+
+/**
+ * \brief Adapts the bytes per cycle to the cycle time target
+ *
+ *  \par Description
+ *       Records whether the last background cycle overshot
+ *       #CS_HkPacket_Payload_t.CycleTimeTarget, then sets the bytes per
+ *       cycle from the throughput it measured so that the next cycle
+ *       takes about the target time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called while the target is nonzero and no cycle time
+ *       budget is set. The result is kept between
+ *       #CS_MIN_ADAPTIVE_BYTES_PER_CYCLE and #CS_MAX_ADAPTIVE_BYTES_PER_CYCLE.
+ *
+ *  \param [in] CycleTime  Microseconds the last background cycle ran
+ *  \param [in] CycleBytes Bytes checksummed by the last background cycle
+ */
+void CS_UpdateBytesPerCycle(uint32 CycleTime, uint32 CycleBytes);
+
+/**
+ * \brief Gets the bytes per cycle of a byte budget
+ *
+ *  \par Description
+ *       Returns the budget from the byte budget table, or the shared
+ *       bytes per cycle when the budget is zero or the table is not
+ *       loaded.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Safe to call from the child tasks, as it reads the copy of the
+ *       budgets kept by #CS_RefreshBudgets rather than the table.
+ *
+ *  \param [in] Budget  A checksum type number or #CS_CHILD_TASK_BUDGET
+ *
+ *  \return The number of bytes to checksum per cycle
+ */
+uint32 CS_GetBytesPerCycle(uint16 Budget);
+
+/**
+ * \brief Refills the byte budgets of a background cycle
+ *
+ *  \par Description
+ *       Sets the bytes the background cycle may checksum to its share of
+ *       the bytes per cycle, and the bytes each checksum type may
+ *       checksum to its byte budget.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The share is smaller while recomputes or a one shot are running,
+ *       see #CS_ShareCycleBytes.
+ */
+void CS_ResetCycleBytes(void);
+
+/**
+ * \brief Gets the bytes a checksum type may still checksum this cycle
+ *
+ *  \par Description
+ *       Returns the smaller of the bytes left in the background cycle
+ *       and the bytes left in the budget of the checksum type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Table  The checksum type number
+ *
+ *  \return The number of bytes the checksum type may still checksum
+ */
+uint32 CS_GetCycleBytes(uint16 Table);
+
+/**
+ * \brief Charges a checksum type for the bytes it checksummed
+ *
+ *  \par Description
+ *       Takes the bytes used since #CS_GetCycleBytes from both the
+ *       background cycle and the budget of the checksum type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A checksum type that used all of its budget ends the background
+ *       cycle, so it carries on from the same entry in the next cycle.
+ *
+ *  \param [in] Table      The checksum type number
+ *  \param [in] BytesLeft  Bytes left of those returned by #CS_GetCycleBytes
+ *
+ *  \return Boolean cycle done response
+ *  \retval true  The background cycle is done
+ *  \retval false Bytes are left for the next entry or table
+ */
+bool CS_UseCycleBytes(uint16 Table, uint32 BytesLeft);
+
+/**
+ * \brief Gets the current time in seconds
+ *
+ *  \par Description
+ *       Returns the local time in whole seconds, which is what the
+ *       verification times of the results table entries are kept in.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The value wraps, so only differences between times are used.
+ *
+ *  \return The current time in seconds
+ */
+uint32 CS_GetCurrentSeconds(void);
+
+/**
+ * \brief Records that an entry has been verified
+ *
+ *  \par Description
+ *       Counts a deadline miss when the entry was verified more than
+ *       its maximum staleness after its last verification, then sets
+ *       its verification time to now.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in,out] VerifiedTime  The verification time of the entry
+ *  \param [in]     MaxStaleness  The maximum staleness of the entry, 0 for no limit
+ */
+void CS_RecordVerification(uint32 *VerifiedTime, uint32 MaxStaleness);
+
+/**
+ * \brief Gets how overdue an entry is
+ *
+ *  \par Description
+ *       Returns the number of seconds by which the time since an entry
+ *       was last verified exceeds its maximum staleness.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries that are not enabled, or have no maximum staleness,
+ *       are never overdue.
+ *
+ *  \param [in] State         The state of the entry
+ *  \param [in] MaxStaleness  The maximum staleness of the entry, 0 for no limit
+ *  \param [in] VerifiedTime  The verification time of the entry
+ *  \param [in] Now           The current time from #CS_GetCurrentSeconds
+ *
+ *  \return Seconds overdue, 0 when the entry is not overdue
+ */
+uint32 CS_GetLateness(uint16 State, uint32 MaxStaleness, uint32 VerifiedTime, uint32 Now);
+
+/**
+ * \brief Finds the most overdue entry
+ *
+ *  \par Description
+ *       Searches the enabled EEPROM, Memory, Tables and App tables for
+ *       the entry that is most overdue for verification.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cFE core and OS code segments have no maximum staleness
+ *       and are never overdue.
+ *
+ *  \param [out] Table  The checksum type number of the entry found
+ *  \param [out] Entry  The index of the entry found
+ *
+ *  \return Boolean entry found response
+ *  \retval true  An overdue entry was found
+ *  \retval false No entry is overdue
+ */
+bool CS_FindOverdueEntry(uint16 *Table, uint16 *Entry);
+
+/**
+ * \brief Checksums an entry out of the sequential sweep's turn
+ *
+ *  \par Description
+ *       Checksums the next chunk of an entry through the background
+ *       function of its table, starting from the given entry the way
+ *       the sweep would.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The current table, current entry and pass counter of the
+ *       sequential sweep are left as they were.
+ *
+ *  \param [in]     Table      The checksum type number of the entry
+ *  \param [in,out] Entry      The index of the entry, updated to the entry
+ *                             to carry on from, or 0 once the table is done
+ *  \param [out]    TableDone  Set true once the table is done and the
+ *                             entry is back at its start
+ *
+ *  \return Boolean cycle done response
+ *  \retval true  The background cycle is done
+ *  \retval false Bytes are left for the next entry or table
+ */
+bool CS_BackgroundEntry(uint16 Table, uint16 *Entry, bool *TableDone);
+
+/**
+ * \brief Gets the bytes a checksum type may checksum in a weighted turn
+ *
+ *  \par Description
+ *       Shares the bytes per cycle between the checksum types in
+ *       proportion to their weights in the byte budget table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every checksum type gets an equal share when no weights are
+ *       set or the table is not loaded. A type with weight zero gets
+ *       nothing, and any other type at least one byte.
+ *
+ *  \param [in] Table  The checksum type number
+ *
+ *  \return The number of bytes in a turn
+ */
+uint32 CS_GetWeightedQuantum(uint16 Table);
+
+/**
+ * \brief Checksums one chunk of a checksum type from its own cursor
+ *
+ *  \par Description
+ *       Checksums up to the given number of bytes from the entry in
+ *       #CS_HkPacket_Payload_t.EntryCursor for the checksum type, and
+ *       moves the cursor on. The bytes are taken from the cycle and
+ *       the type's byte budgets as usual.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is checksummed once the type's budget for the cycle
+ *       is used up. A chunk that finishes the type's table counts the
+ *       type as done for the pass with #CS_CategoryPassDone.
+ *
+ *  \param [in] Table       The checksum type number
+ *  \param [in] ChunkBytes  The most bytes to checksum
+ *
+ *  \return The number of bytes checksummed
+ */
+uint32 CS_BackgroundChunk(uint16 Table, uint32 ChunkBytes);
+
+/**
+ * \brief Counts a checksum type as done for the pass
+ *
+ *  \par Description
+ *       In weighted and interleaved mode a pass is done once every
+ *       checksum type's cursor has been through its table. Marks the
+ *       type as through its table, and once every type is, increments
+ *       the pass counter and starts the next pass.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A disabled type is through its table on each of its turns.
+ *
+ *  \param [in] Table  The checksum type number
+ */
+void CS_CategoryPassDone(uint16 Table);
+
+/**
+ * \brief Background check in weighted mode
+ *
+ *  \par Description
+ *       Takes the checksum types in turn, each checksumming up to its
+ *       quantum of bytes from its own place in its table. Bytes a type
+ *       could not use in a chunk stay with its turn, so over time each
+ *       type gets its weighted share of the background cycles.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Checksums at most one chunk per call. A type with nothing to
+ *       checksum loses the rest of its turn. A type with weight zero
+ *       does not hold up the pass.
+ *
+ *  \return Boolean cycle done response
+ *  \retval true  The background cycle is done
+ *  \retval false Bytes are left in the cycle, or nothing was checksummed
+ */
+bool CS_BackgroundWeighted(void);
+
+/**
+ * \brief Background check in interleaved mode
+ *
+ *  \par Description
+ *       Takes the checksum types in turn, each checksumming one chunk
+ *       of an equal share of the bytes per cycle from its own place in
+ *       its table. An entry waits at most for one chunk of every other
+ *       type rather than for a pass through the other tables.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Checksums at most one chunk per call. A type with nothing to
+ *       checksum loses its turn.
+ *
+ *  \return Boolean cycle done response
+ *  \retval true  The background cycle is done
+ *  \retval false Bytes are left in the cycle, or nothing was checksummed
+ */
+bool CS_BackgroundInterleaved(void);
+
+/**
+ * \brief Gets the enabled map of a table
+ *
+ *  \par Description
+ *       Returns the bitmap holding one bit for each entry of the
+ *       table's results table, set while the entry is enabled.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cFE core and OS have no map.
+ *
+ *  \param [in]  Table       The checksum type number
+ *  \param [out] NumEntries  The number of entries in the map
+ *
+ *  \return Pointer to the map, or NULL if the type has none
+ */
+uint32 *CS_GetEnabledMap(uint16 Table, uint16 *NumEntries);
+
+/**
+ * \brief Marks an entry enabled or not in its table's enabled map
+ *
+ *  \par Description
+ *       Keeps the enabled map in step with the state of a results
+ *       entry. Called wherever a results entry is enabled, disabled
+ *       or loaded from a new definition table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Entries outside the table are ignored.
+ *
+ *  \param [in] Table    The checksum type number
+ *  \param [in] Entry    The index of the entry
+ *  \param [in] Enabled  Whether the entry is enabled
+ */
+void CS_SetEntryEnabled(uint16 Table, uint16 Entry, bool Enabled);
+
+/**
+ * \brief Gets the lowest set bit of a word
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The word must not be zero.
+ *
+ *  \param [in] Word  The word to look in
+ *
+ *  \return The bit number of the lowest set bit
+ */
+uint16 CS_FirstSetBit(uint32 Word);
+
+/**
+ * \brief Finds the next enabled entry of a table
+ *
+ *  \par Description
+ *       Looks through the table's enabled map a word at a time from
+ *       the given entry on, so disabled and empty entries cost
+ *       nothing to pass over.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]     Table  The checksum type number
+ *  \param [in,out] Entry  The entry to start from, updated to the
+ *                         enabled entry found, or to the number of
+ *                         entries in the table if there is none
+ *
+ *  \return Boolean enabled entry found response
+ *  \retval true  Enabled entry was found in the table
+ *  \retval false Enabled entry was not found in the table
+ */
+bool CS_FindNextEnabledEntry(uint16 Table, uint16 *Entry);
+
+/**
+ * \brief Checks whether a child task request may start now
+ *
+ *  \par Description
+ *       A child task is free when a recompute worker is free, no one
+ *       shot is in progress and no earlier request is waiting in the
+ *       queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A queued request being started does not wait behind the
+ *       requests queued after it.
+ *
+ *  \return Boolean child task free response
+ *  \retval true  The request may start the child task
+ *  \retval false The request has to wait
+ */
+bool CS_ChildTaskIsFree(void);
+
+/**
+ * \brief Queues a child task request
+ *
+ *  \par Description
+ *       Copies a recompute baseline or one shot command to the end of
+ *       the request queue, to be started once the requests ahead of it
+ *       have finished.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The command is counted in #CS_HkPacket_Payload_t.CmdCounter or
+ *       #CS_HkPacket_Payload_t.CmdErrCounter when it is started, not
+ *       when it is queued. A queued request that still can't start
+ *       while it is being started goes back to the head of the queue.
+ *
+ *  \param [in] MsgPtr   The command to queue
+ *  \param [in] MsgSize  The size of the command in bytes
+ *
+ *  \return Boolean request queued response
+ *  \retval true  The request was queued
+ *  \retval false The queue was full, and the request was counted as dropped
+ */
+bool CS_QueueChildTaskRequest(const CFE_MSG_Message_t *MsgPtr, size_t MsgSize);
+
+/**
+ * \brief Starts queued child task requests
+ *
+ *  \par Description
+ *       While a recompute worker is free, takes the oldest request off
+ *       the queue and processes the command again to start it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from the main loop, which alone touches the queue.
+ *       Requests that fail to start are followed by the next one at
+ *       once. A one shot put back at the head of the queue stops the
+ *       pass until the recomputes ahead of it have finished.
+ */
+void CS_StartQueuedRequests(void);
+
+/**
+ * \brief Starts a recompute worker on an entry
+ *
+ *  \par Description
+ *       Claims a free recompute worker for the entry and hands the
+ *       recompute to its worker task. The worker holds the entry until
+ *       its recompute finishes, so no other worker can start on the
+ *       same entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from the main task once #CS_ChildTaskIsFree has found a
+ *       free worker. Sends #CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID when
+ *       another worker holds the entry. No task is created, the worker
+ *       tasks are created by #CS_InitWorkerTasks at startup.
+ *
+ *  \param [in] Table     The table of the entry
+ *  \param [in] EntryID   The entry ID, for the EEPROM and Memory tables
+ *  \param [in] EntryPtr  The results entry to recompute
+ *  \param [in] WorkFunc  The function the worker task runs to recompute the entry
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS     \copybrief CFE_SUCCESS
+ * \retval #CS_ENTRY_LOCKED \copybrief CS_ENTRY_LOCKED
+ * \retval #CS_ERROR        No recompute worker was free
+ */
+CFE_Status_t CS_StartRecomputeWorker(uint16 Table, uint16 EntryID, void *EntryPtr,
+                                     CFE_ES_ChildTaskMainFuncPtr_t WorkFunc);
+
+/**
+ * \brief Hands a work item to a worker task
+ *
+ *  \par Description
+ *       Puts the function on the queue the worker task waits on. The
+ *       worker task runs it and then waits for its next work item.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller only hands work to a free worker, so the queue is
+ *       never full.
+ *
+ *  \param [in] QueueID   The queue of the worker task
+ *  \param [in] WorkFunc  The function the worker task is to run
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t CS_PostWork(osal_id_t QueueID, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc);
+
+/**
+ * \brief Finds the queue of the calling worker task
+ *
+ *  \par Description
+ *       Looks up the recompute worker, sub-range or one shot task whose
+ *       task ID matches the calling task and returns the queue it waits
+ *       on.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CS_InitWorkerTasks records the task ID before giving back the
+ *       mutex this waits on, so a worker task always finds its queue.
+ *
+ *  \return The queue ID, or #OS_OBJECT_ID_UNDEFINED if the calling task
+ *          is not a worker task
+ */
+osal_id_t CS_FindWorkerQueue(void);
+
+/**
+ * \brief Finds the recompute worker run by the calling child task
+ *
+ *  \par Description
+ *       Looks up the worker whose task ID matches the calling task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The main task records the entry before giving back the mutex
+ *       this waits on, so a worker started by #CS_StartRecomputeWorker
+ *       always finds itself.
+ *
+ *  \return The worker ID, or #CS_MAX_RECOMPUTE_WORKERS if the calling
+ *          task is not a recompute worker
+ */
+uint16 CS_FindRecomputeWorker(void);
+
+/**
+ * \brief Releases a recompute worker and the entry it holds
+ *
+ *  \par Description
+ *       Frees the worker for the next recompute and updates the
+ *       recompute status in housekeeping.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the worker as the last step of its recompute.
+ *
+ *  \param [in] WorkerID  The worker to release
+ */
+void CS_ReleaseRecomputeWorker(uint16 WorkerID);
+
+/**
+ * \brief Resets the Tables table entry of a definition table being recomputed from
+ *
+ *  \par Description
+ *       Resets the Tables table results entry of the CS definition table
+ *       and tells cFE Table Services the table was modified, so its
+ *       checksum is taken again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by a recompute worker while it holds an entry of the
+ *       definition table's type. The entry is only changed under the
+ *       worker mutex, as other workers may reset it at the same time.
+ *
+ *  \param [in] TablesTblResultEntry  The Tables table results entry of the
+ *                                    definition table, NULL if not listed
+ *  \param [in] DefTblHandle          The handle of the definition table
+ */
+void CS_ResetRecomputeDefTableEntry(CS_Res_Tables_Table_Entry_t *TablesTblResultEntry, CFE_TBL_Handle_t DefTblHandle);
+
+/**
+ * \brief Starts the child task for one sub-range of a split recompute
+ *
+ *  \par Description
+ *       Hands the checksum of one sub-range of the entry held by a
+ *       recompute worker to the worker's task for that sub-range, and
+ *       marks the sub-range busy until it is finished.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by the recompute worker. The sub-range tasks are created
+ *       by #CS_InitWorkerTasks at startup, and one that could not be
+ *       created is never handed work. cFE places child tasks on
+ *       cores as the OS scheduler sees fit, so sub-range tasks run side
+ *       by side on multi-core targets without being pinned to a core.
+ *
+ *  \param [in] WorkerID  The recompute worker splitting its entry
+ *  \param [in] SubRange  The sub-range, less than #CS_NUM_SUB_RANGES
+ *  \param [in] WorkFunc  The function the sub-range task runs to checksum the sub-range
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ * \retval #CS_ERROR    The sub-range has no task
+ */
+CFE_Status_t CS_StartSubRangeTask(uint16 WorkerID, uint16 SubRange, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc);
+
+/**
+ * \brief Finds the sub-range checksummed by the calling child task
+ *
+ *  \par Description
+ *       Looks up the recompute worker and sub-range whose task ID
+ *       matches the calling task and whose sub-range is busy.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The recompute worker marks the sub-range busy before giving
+ *       back the mutex this waits on, so a task handed work by
+ *       #CS_StartSubRangeTask always finds itself.
+ *
+ *  \param [out] WorkerID  The recompute worker that started the task
+ *  \param [out] SubRange  The sub-range the task checksums
+ *
+ *  \return Boolean sub-range found response
+ *  \retval true  The calling task checksums a sub-range
+ *  \retval false The calling task is not a sub-range task
+ */
+bool CS_FindSubRangeTask(uint16 *WorkerID, uint16 *SubRange);
+
+/**
+ * \brief Records the checksum of one sub-range of a split recompute
+ *
+ *  \par Description
+ *       Stores the sub-range checksum in the entry held by the worker,
+ *       marks the sub-range as computed and no longer busy.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called as the last step of a sub-range, by its child task or by
+ *       the worker itself when the work could not be handed over.
+ *
+ *  \param [in] WorkerID          The recompute worker splitting its entry
+ *  \param [in] SubRange          The sub-range, less than #CS_NUM_SUB_RANGES
+ *  \param [in] SubRangeChecksum  The checksum of the sub-range
+ */
+void CS_FinishSubRange(uint16 WorkerID, uint16 SubRange, uint32 SubRangeChecksum);
+
+/**
+ * \brief Checks whether any sub-range task of a worker is still running
+ *
+ *  \par Description
+ *       The recompute worker waits for this to clear before merging the
+ *       sub-range checksums.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] WorkerID  The recompute worker splitting its entry
+ *
+ *  \return Boolean sub-ranges running response
+ *  \retval true  At least one sub-range task has not finished
+ *  \retval false Every sub-range task has finished
+ */
+bool CS_SubRangesRunning(uint16 WorkerID);
+
+/**
+ * \brief Checks whether a recompute worker holds an entry of a table
+ *
+ *  \par Description
+ *       Table updates are put off while an entry of the table is being
+ *       recomputed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Table  The table to check
+ *
+ *  \return Boolean table recomputing response
+ *  \retval true  A worker holds an entry of the table
+ *  \retval false No worker holds an entry of the table
+ */
+bool CS_RecomputingTable(uint16 Table);
+
+/**
+ * \brief Checks whether a recompute worker holds an entry
+ *
+ *  \par Description
+ *       The background skips an entry while it is being recomputed, and
+ *       goes on checksumming the rest. The Tables table entry of a CS
+ *       definition table counts as held while any entry of that table's
+ *       type is recomputed, since the worker resets that entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Read without the worker mutex. Entries are only claimed by the
+ *       command handlers, which run in the same task as the background.
+ *
+ *  \param [in] Table    The table of the entry
+ *  \param [in] EntryID  The entry in the table
+ *
+ *  \return Boolean entry recomputing response
+ *  \retval true  A worker holds the entry
+ *  \retval false No worker holds the entry
+ */
+bool CS_RecomputingEntry(uint16 Table, uint16 EntryID);
+
+/**
+ * \brief Gets the background's share of a byte budget
+ *
+ *  \par Description
+ *       Splits the bytes evenly between the background and each running
+ *       recompute worker or one shot, so the background keeps checking
+ *       the entries that are not being recomputed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A budget that is not zero always leaves the background at least
+ *       one byte.
+ *
+ *  \param [in] Bytes  The bytes to share
+ *
+ *  \return The bytes the background may checksum
+ */
+uint32 CS_ShareCycleBytes(uint32 Bytes);
+
 #endif
@@ -87,8 +87,102 @@
 #error CS_CHILD_TASK_PRIORITY cannot be greater than 255!
 #endif
 
-#if (CS_DEFAULT_ALGORITHM != CFE_MISSION_ES_DEFAULT_CRC && CS_DEFAULT_ALGORITHM != CFE_ES_CRC_16)
-#error CS_DEFAULT_ALGORITHM is limited to either CFE_MISSION_ES_DEFAULT_CRC or CFE_ES_CRC_16!
+#if (CS_DEFAULT_CYCLE_TIME_BUDGET > CS_MAX_CYCLE_TIME_BUDGET)
+#error CS_DEFAULT_CYCLE_TIME_BUDGET cannot be greater than CS_MAX_CYCLE_TIME_BUDGET!
+#endif
+
+#if (CS_DEFAULT_CYCLE_TIME_TARGET > CS_MAX_CYCLE_TIME_BUDGET)
+#error CS_DEFAULT_CYCLE_TIME_TARGET cannot be greater than CS_MAX_CYCLE_TIME_BUDGET!
+#endif
+
+#if (CS_MIN_ADAPTIVE_BYTES_PER_CYCLE < 1)
+#error CS_MIN_ADAPTIVE_BYTES_PER_CYCLE cannot be less than 1!
+#endif
+
+#if (CS_MIN_ADAPTIVE_BYTES_PER_CYCLE > CS_MAX_ADAPTIVE_BYTES_PER_CYCLE)
+#error CS_MIN_ADAPTIVE_BYTES_PER_CYCLE cannot be greater than CS_MAX_ADAPTIVE_BYTES_PER_CYCLE!
+#endif
+
+#if (CS_MAX_ADAPTIVE_BYTES_PER_CYCLE > 0xFFFFFFFF)
+#error CS_MAX_ADAPTIVE_BYTES_PER_CYCLE cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_MAX_BUDGET_BYTES_PER_CYCLE < 1)
+#error CS_MAX_BUDGET_BYTES_PER_CYCLE cannot be less than 1!
+#endif
+
+#if (CS_MAX_BUDGET_BYTES_PER_CYCLE > 0xFFFFFFFF)
+#error CS_MAX_BUDGET_BYTES_PER_CYCLE cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_DEFAULT_SCHEDULER_MODE != CS_SCHEDULER_SEQUENTIAL && CS_DEFAULT_SCHEDULER_MODE != CS_SCHEDULER_DEADLINE && \
+     CS_DEFAULT_SCHEDULER_MODE != CS_SCHEDULER_WEIGHTED && CS_DEFAULT_SCHEDULER_MODE != CS_SCHEDULER_INTERLEAVED)
+#error CS_DEFAULT_SCHEDULER_MODE must be one of the CS_SCHEDULER_... modes!
+#endif
+
+#if (CS_DEFAULT_PACING_PERIOD > CS_MAX_PACING_PERIOD)
+#error CS_DEFAULT_PACING_PERIOD cannot be greater than CS_MAX_PACING_PERIOD!
+#endif
+
+#if (CS_DEFAULT_IDLE_BYTES_PER_WAKEUP > CS_MAX_IDLE_BYTES_PER_WAKEUP)
+#error CS_DEFAULT_IDLE_BYTES_PER_WAKEUP cannot be greater than CS_MAX_IDLE_BYTES_PER_WAKEUP!
+#endif
+
+#if (CS_MAX_IDLE_BYTES_PER_WAKEUP > 0xFFFFFFFF)
+#error CS_MAX_IDLE_BYTES_PER_WAKEUP cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_MAX_RECOMPUTE_WORKERS < 1)
+#error CS_MAX_RECOMPUTE_WORKERS must be at least 1!
+#endif
+
+#if (CS_MAX_RECOMPUTE_WORKERS > 8)
+#error CS_MAX_RECOMPUTE_WORKERS cannot be greater than 8!
+#endif
+
+#if (CS_SPLIT_RECOMPUTE_MIN_BYTES < 1)
+#error CS_SPLIT_RECOMPUTE_MIN_BYTES must be at least 1!
+#endif
+
+#if (CS_SPLIT_RECOMPUTE_MIN_BYTES > 0xFFFFFFFF)
+#error CS_SPLIT_RECOMPUTE_MIN_BYTES cannot be greater than 0xFFFFFFFF!
+#endif
+
+#if (CS_MAX_QUEUED_REQUESTS < 1)
+#error CS_MAX_QUEUED_REQUESTS must be at least 1!
+#endif
+
+#if (CS_MAX_QUEUED_REQUESTS > 0xFFFF)
+#error CS_MAX_QUEUED_REQUESTS cannot be greater than 0xFFFF!
+#endif
+
+#if (CS_CRC_FOLD_MIN_BYTES < 64)
+#error CS_CRC_FOLD_MIN_BYTES must be at least 64!
+#endif
+
+#if (CS_CRC_INTERLEAVE_MIN_BYTES < 32)
+#error CS_CRC_INTERLEAVE_MIN_BYTES must be at least 32!
+#endif
+
+#if (CS_CRC_CALIBRATION_BYTES < 1)
+#error CS_CRC_CALIBRATION_BYTES must be at least 1!
+#endif
+
+#if (CS_CRC_CALIBRATION_PASSES < 1)
+#error CS_CRC_CALIBRATION_PASSES must be at least 1!
+#endif
+
+#if (CS_NUM_SUB_RANGES < 1)
+#error CS_NUM_SUB_RANGES must be at least 1!
+#endif
+
+#if (CS_NUM_SUB_RANGES > 32)
+#error CS_NUM_SUB_RANGES cannot be greater than 32!
+#endif
+
+#if (CS_DEFAULT_ALGORITHM != CFE_MISSION_ES_DEFAULT_CRC && CS_DEFAULT_ALGORITHM != CFE_ES_CRC_16 && \
+     CS_DEFAULT_ALGORITHM != CFE_ES_CRC_32 && CS_DEFAULT_ALGORITHM != CS_ALGORITHM_CRC_32C)
+#error CS_DEFAULT_ALGORITHM is limited to CFE_MISSION_ES_DEFAULT_CRC, CFE_ES_CRC_16, CFE_ES_CRC_32 or CS_ALGORITHM_CRC_32C!
 #endif
 
 #endif
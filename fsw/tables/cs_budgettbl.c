@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *  The CFS Checksum (CS) Application Default Byte Budget Table Definition
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "cfe.h"
+#include "cfe_tbl_filedef.h"
+#include "cs_msgdefs.h"
+#include "cs_platform_cfg.h"
+#include "cs_tbldefs.h"
+
+/* A budget of zero uses the shared bytes per cycle */
+CS_Def_Budget_Table_t CS_BudgetTable = {
+    .BytesPerCycle = {
+        /* CS_CFECORE           */ 0,
+        /* CS_OSCORE            */ 0,
+        /* CS_EEPROM_TABLE      */ 0,
+        /* CS_MEMORY_TABLE      */ 0,
+        /* CS_TABLES_TABLE      */ 0,
+        /* CS_APP_TABLE         */ 0,
+        /* CS_CHILD_TASK_BUDGET */ 0},
+
+    /* Every weight zero gives each checksum type an equal share */
+    .Weight = {
+        /* CS_CFECORE           */ 0,
+        /* CS_OSCORE            */ 0,
+        /* CS_EEPROM_TABLE      */ 0,
+        /* CS_MEMORY_TABLE      */ 0,
+        /* CS_TABLES_TABLE      */ 0,
+        /* CS_APP_TABLE         */ 0}};
+
+/*
+** Table file header
+*/
+CFE_TBL_FILEDEF(CS_BudgetTable, CS.DefBudgetTbl, CS Byte Budget Tbl, cs_budgettbl.tbl)
@@ -186,7 +186,8 @@ void CS_ReportBaselineAppCmd_Test_Baseline(void)
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Report baseline of app %%s is 0x%%08X");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Report baseline of app %%s is 0x%%08X, algorithm %%d");
 
     strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
     strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
@@ -354,19 +355,20 @@ void CS_RecomputeBaselineAppCmd_Test_Nominal(void)
     CS_AppData.ResAppTblPtr->State = 1;
 
     /* Set to generate event message CS_RECOMPUTE_APP_STARTED_DBG_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CFE_SUCCESS);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
 
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
     /* Execute the function being tested */
     CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr,
-                  "CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr");
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, CS_AppData.ResAppTblPtr);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -385,14 +387,14 @@ void CS_RecomputeBaselineAppCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineAppCmd_Test_PostWorkError(void)
 {
     CS_AppNameCmd_t CmdPacket;
     int32           strCmpResult;
     char            ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of app %%s failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute baseline of app %%s failed, posting to worker queue failed: 0x%%08X");
 
     strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
     strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
@@ -402,22 +404,23 @@ void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
     /* Needed to make subfunction CS_GetAppResTblEntryByName behave properly */
     CS_AppData.ResAppTblPtr->State = 1;
 
-    /* Set to generate event message CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate event message CS_RECOMPUTE_APP_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
     UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
                           NULL);
 
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
     /* Execute the function being tested */
     CS_RecomputeBaselineAppCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr,
-                  "CS_AppData.ResAppTblPtr == CS_AppData.RecomputeAppEntryPtr");
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, CS_AppData.ResAppTblPtr);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_APP_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -432,6 +435,38 @@ void CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineAppCmd_Test_EntryLocked(void)
+{
+    CS_AppNameCmd_t CmdPacket;
+
+    strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
+    strncpy(CS_AppData.ResAppTblPtr->Name, "App1", OS_MAX_API_NAME);
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
+
+    /* Needed to make subfunction CS_GetAppResTblEntryByName behave properly */
+    CS_AppData.ResAppTblPtr->State = 1;
+
+    /* Another worker already holds the entry */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CS_ENTRY_LOCKED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_GetAppResTblEntryByName), CS_APP_CMDS_TEST_CS_GetAppResTblEntryByNameHandler1,
+                          NULL);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineAppCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_RecomputeBaselineAppCmd_Test_UnknownNameError(void)
 {
     CS_AppNameCmd_t CmdPacket;
@@ -451,6 +486,7 @@ void CS_RecomputeBaselineAppCmd_Test_UnknownNameError(void)
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_GetAppResTblEntryByName), 1, false);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineAppCmd(&CmdPacket);
@@ -509,6 +545,28 @@ void CS_RecomputeBaselineAppCmd_Test_RecomputeInProgress(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineAppCmd_Test_Queued(void)
+{
+    CS_AppNameCmd_t CmdPacket;
+
+    strncpy(CmdPacket.Payload.Name, "App1", OS_MAX_API_NAME);
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineAppCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_DisableNameAppCmd_Test_Nominal(void)
 {
     CS_AppNameCmd_t CmdPacket;
@@ -551,6 +609,8 @@ void CS_DisableNameAppCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -713,6 +773,8 @@ void CS_EnableNameAppCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -853,12 +915,16 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineAppCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineAppCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineAppCmd_Test_PostWorkError");
+    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineAppCmd_Test_EntryLocked");
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_UnknownNameError, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineAppCmd_Test_UnknownNameError");
     UtTest_Add(CS_RecomputeBaselineAppCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineAppCmd_Test_RecomputeInProgress");
+    UtTest_Add(CS_RecomputeBaselineAppCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineAppCmd_Test_Queued");
 
     UtTest_Add(CS_DisableNameAppCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_DisableNameAppCmd_Test_Nominal");
     UtTest_Add(CS_DisableNameAppCmd_Test_UpdateAppsDefinitionTableError, CS_Test_Setup, CS_Test_TearDown,
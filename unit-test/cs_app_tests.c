@@ -57,6 +57,13 @@ typedef union
     CS_TableNameCmd_t  TableNameCmd;
     CS_AppNameCmd_t    AppNameCmd;
     CS_OneShotCmd_t    OneShotCmd;
+
+    CS_SetCycleTimeBudgetCmd_t SetCycleTimeBudgetCmd;
+    CS_SetCycleTimeTargetCmd_t SetCycleTimeTargetCmd;
+    CS_SetBytesPerCycleCmd_t   SetBytesPerCycleCmd;
+    CS_SetSchedulerModeCmd_t   SetSchedulerModeCmd;
+    CS_SetPacingPeriodCmd_t    SetPacingPeriodCmd;
+    CS_SetIdleBytesCmd_t       SetIdleBytesCmd;
 } UT_CmdBuf_t;
 
 /* cs_app_tests globals */
@@ -318,6 +325,9 @@ void CS_AppMain_Test_RcvMsgTimeout(void)
     /* Verify results */
     UtAssert_True(CS_AppData.RunStatus == CFE_ES_RunStatus_APP_ERROR,
                   "CS_AppData.RunStatus == CFE_ES_RunStatus_APP_ERROR");
+    UtAssert_STUB_COUNT(CS_GetPipeTimeout, 1);
+    UtAssert_STUB_COUNT(CS_HarvestIdleTime, 0);
+    UtAssert_STUB_COUNT(CS_PaceBackgroundCycle, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_EXIT_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
@@ -364,6 +374,7 @@ void CS_AppMain_Test_RcvNoMsg(void)
     CS_AppMain();
 
     /* Verify results */
+    UtAssert_STUB_COUNT(CS_HarvestIdleTime, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_EXIT_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
@@ -487,6 +498,28 @@ void CS_AppMain_Test_AppPipeError(void)
     UtAssert_True(strCmpResult == 0, "Sys Log string matched expected result, '%s'", context_CFE_ES_WriteToSysLog.Spec);
 }
 
+void CS_AppMain_Test_PacedCycle(void)
+{
+    /* Set to make loop execute exactly once */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+
+    /* Set to prevent unintended error messages */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* The wait for the next paced cycle ends without a message */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+
+    /* Execute the function being tested */
+    CS_AppMain();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_GetPipeTimeout, 1);
+    UtAssert_STUB_COUNT(CS_HandleRoutineTableUpdates, 1);
+    UtAssert_STUB_COUNT(CS_HarvestIdleTime, 1);
+    UtAssert_STUB_COUNT(CS_StartQueuedRequests, 1);
+    UtAssert_STUB_COUNT(CS_PaceBackgroundCycle, 1);
+}
+
 void CS_AppInit_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -519,6 +552,11 @@ void CS_AppInit_Test_Nominal(void)
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
+
+    UtAssert_STUB_COUNT(CS_CalibrateDefaultCRC, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeBudget, CS_DEFAULT_CYCLE_TIME_BUDGET);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeTarget, CS_DEFAULT_CYCLE_TIME_TARGET);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.SchedulerMode, CS_DEFAULT_SCHEDULER_MODE);
 }
 
 void CS_AppInit_Test_NominalPowerOnReset(void)
@@ -872,6 +910,41 @@ void CS_AppInit_Test_EVSRegisterError(void)
     UtAssert_True(strCmpResult == 0, "Sys Log string matched expected result, '%s'", context_CFE_ES_WriteToSysLog.Spec);
 }
 
+void CS_AppInit_Test_WorkerInitError(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to make the recompute worker mutex fail to be created */
+    UT_SetDeferredRetcode(UT_KEY(CS_InitRecomputeWorkers), 1, -1);
+
+    /* Execute the function being tested */
+    Result = CS_AppInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CS_InitRecomputeWorkers, 1);
+    UtAssert_STUB_COUNT(CS_InitWorkerTasks, 0);
+    UtAssert_STUB_COUNT(CS_InitAllTables, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_AppInit_Test_WorkerTasksError(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to make a worker task fail to be created */
+    UT_SetDeferredRetcode(UT_KEY(CS_InitWorkerTasks), 1, -1);
+
+    /* Execute the function being tested */
+    Result = CS_AppInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CS_InitWorkerTasks, 1);
+    UtAssert_STUB_COUNT(CS_InitAllTables, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_AppPipe_Test_TableUpdateErrors(void)
 {
     CFE_Status_t   Result;
@@ -881,8 +954,6 @@ void CS_AppPipe_Test_TableUpdateErrors(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_SEND_HK_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -910,8 +981,6 @@ void CS_AppPipe_Test_BackgroundCycle(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_BACKGROUND_CYCLE_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -938,8 +1007,6 @@ void CS_AppPipe_Test_NoopCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_NOOP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -967,8 +1034,6 @@ void CS_AppPipe_Test_ResetCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RESET_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -996,8 +1061,6 @@ void CS_AppPipe_Test_OneShotCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ONE_SHOT_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1025,8 +1088,6 @@ void CS_AppPipe_Test_CancelOneShotCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_CANCEL_ONE_SHOT_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1054,8 +1115,6 @@ void CS_AppPipe_Test_EnableAllCSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ALL_CS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1083,8 +1142,6 @@ void CS_AppPipe_Test_DisableAllCSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ALL_CS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1112,8 +1169,6 @@ void CS_AppPipe_Test_EnableCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1141,8 +1196,6 @@ void CS_AppPipe_Test_DisableCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1170,8 +1223,6 @@ void CS_AppPipe_Test_ReportBaselineCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1199,8 +1250,6 @@ void CS_AppPipe_Test_RecomputeBaselineCfeCoreCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_CFE_CORE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1228,8 +1277,6 @@ void CS_AppPipe_Test_EnableOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1257,8 +1304,6 @@ void CS_AppPipe_Test_DisableOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1286,8 +1331,6 @@ void CS_AppPipe_Test_ReportBaselineOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1315,8 +1358,6 @@ void CS_AppPipe_Test_RecomputeBaselineOSCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_OS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1344,8 +1385,6 @@ void CS_AppPipe_Test_EnableEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1373,8 +1412,6 @@ void CS_AppPipe_Test_DisableEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1402,8 +1439,6 @@ void CS_AppPipe_Test_ReportBaselineEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1431,8 +1466,6 @@ void CS_AppPipe_Test_RecomputeBaselineEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1460,8 +1493,6 @@ void CS_AppPipe_Test_EnableEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ENTRY_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1489,8 +1520,6 @@ void CS_AppPipe_Test_DisableEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ENTRY_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1518,8 +1547,6 @@ void CS_AppPipe_Test_GetEntryIDEepromCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_GET_ENTRY_ID_EEPROM_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1547,8 +1574,6 @@ void CS_AppPipe_Test_EnableMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1576,8 +1601,6 @@ void CS_AppPipe_Test_DisableMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1605,8 +1628,6 @@ void CS_AppPipe_Test_ReportBaselineEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1634,8 +1655,6 @@ void CS_AppPipe_Test_RecomputeBaselineMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1663,8 +1682,6 @@ void CS_AppPipe_Test_EnableEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_ENTRY_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1692,8 +1709,6 @@ void CS_AppPipe_Test_DisableEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_ENTRY_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1721,8 +1736,6 @@ void CS_AppPipe_Test_GetEntryIDMemoryCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_GET_ENTRY_ID_MEMORY_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1750,8 +1763,6 @@ void CS_AppPipe_Test_EnableTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_TABLES_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1779,8 +1790,6 @@ void CS_AppPipe_Test_DisableTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_TABLES_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1808,8 +1817,6 @@ void CS_AppPipe_Test_ReportBaselineTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1837,8 +1844,6 @@ void CS_AppPipe_Test_RecomputeBaselineTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1866,8 +1871,6 @@ void CS_AppPipe_Test_EnableNameTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_NAME_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1895,8 +1898,6 @@ void CS_AppPipe_Test_DisableNameTablesCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_NAME_TABLE_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1924,8 +1925,6 @@ void CS_AppPipe_Test_EnableAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_APPS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1953,8 +1952,6 @@ void CS_AppPipe_Test_DisableAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_APPS_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -1982,8 +1979,6 @@ void CS_AppPipe_Test_ReportBaselineAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_REPORT_BASELINE_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2011,8 +2006,6 @@ void CS_AppPipe_Test_RecomputeBaselineAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_RECOMPUTE_BASELINE_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2040,8 +2033,6 @@ void CS_AppPipe_Test_EnableNameAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_ENABLE_NAME_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2069,8 +2060,6 @@ void CS_AppPipe_Test_DisableNameAppCmd(void)
 
     memset(&CmdBuf, 0, sizeof(CmdBuf));
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = CS_DISABLE_NAME_APP_CC;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2103,8 +2092,6 @@ void CS_AppPipe_Test_InvalidCCError(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Invalid ground command code: ID = 0x%%08lX, CC = %%d");
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     FcnCode   = 99;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2142,8 +2129,6 @@ void CS_AppPipe_Test_InvalidMIDError(void)
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Invalid command pipe message ID: 0x%%08lX");
 
-    CS_AppData.ChildTaskTable = -1;
-
     TestMsgId = CFE_SB_INVALID_MSG_ID;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
@@ -2210,6 +2195,7 @@ void CS_HousekeepingCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.LastOneShotSize     = 24;
     CS_AppData.HkPacket.Payload.LastOneShotChecksum = 25;
     CS_AppData.HkPacket.Payload.PassCounter         = 26;
+    CS_AppData.MaxBytesPerCycle                     = 27;
 
     /* Execute the function being tested */
     CS_HousekeepingCmd(&CmdPacket);
@@ -2241,6 +2227,7 @@ void CS_HousekeepingCmd_Test_Nominal(void)
     UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotSize == 24, "CS_AppData.HkPacket.Payload.LastOneShotSize == 24");
     UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotChecksum == 25, "CS_AppData.HkPacket.Payload.LastOneShotChecksum == 25");
     UtAssert_True(CS_AppData.HkPacket.Payload.PassCounter == 26, "CS_AppData.HkPacket.Payload.PassCounter == 26");
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesPerCycle, 27);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -2526,6 +2513,125 @@ void CS_ProcessCmd_CancelOneShotCmd_Test(void)
     UtAssert_STUB_COUNT(CS_CancelOneShotCmd, 1);
 }
 
+void CS_ProcessCmd_CalibrateCRCCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_CALIBRATE_CRC_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalibrateCRCCmd, 1);
+}
+
+void CS_ProcessCmd_SetCycleTimeBudgetCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_CYCLE_TIME_BUDGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetCycleTimeBudgetCmd, 1);
+}
+
+void CS_ProcessCmd_SetCycleTimeTargetCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_CYCLE_TIME_TARGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetCycleTimeTargetCmd, 1);
+}
+
+void CS_ProcessCmd_SetBytesPerCycleCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_BYTES_PER_CYCLE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetBytesPerCycleCmd, 1);
+}
+
+void CS_ProcessCmd_SetSchedulerModeCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_SCHEDULER_MODE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetSchedulerModeCmd, 1);
+}
+
+void CS_ProcessCmd_SetPacingPeriodCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_PACING_PERIOD_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetPacingPeriodCmd, 1);
+}
+
+void CS_ProcessCmd_SetIdleBytesCmd_Test(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_IDLE_BYTES_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetIdleBytesCmd, 1);
+}
+
 void CS_ProcessCmd_DisableTablesCmd_Test(void)
 {
     UT_CmdBuf_t       CmdBuf;
@@ -3206,6 +3312,125 @@ void CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError(void)
     UtAssert_STUB_COUNT(CS_CancelOneShotCmd, 0);
 }
 
+void CS_ProcessCmd_CalibrateCRCCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_CALIBRATE_CRC_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalibrateCRCCmd, 0);
+}
+
+void CS_ProcessCmd_SetCycleTimeBudgetCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_CYCLE_TIME_BUDGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetCycleTimeBudgetCmd, 0);
+}
+
+void CS_ProcessCmd_SetCycleTimeTargetCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_CYCLE_TIME_TARGET_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetCycleTimeTargetCmd, 0);
+}
+
+void CS_ProcessCmd_SetBytesPerCycleCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_BYTES_PER_CYCLE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetBytesPerCycleCmd, 0);
+}
+
+void CS_ProcessCmd_SetSchedulerModeCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_SCHEDULER_MODE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetSchedulerModeCmd, 0);
+}
+
+void CS_ProcessCmd_SetPacingPeriodCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_PACING_PERIOD_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetPacingPeriodCmd, 0);
+}
+
+void CS_ProcessCmd_SetIdleBytesCmd_Test_VerifyError(void)
+{
+    UT_CmdBuf_t       CmdBuf;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = CS_SET_IDLE_BYTES_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    CS_ProcessCmd(&CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_SetIdleBytesCmd, 0);
+}
+
 void CS_ProcessCmd_DisableTablesCmd_Test_VerifyError(void)
 {
     UT_CmdBuf_t       CmdBuf;
@@ -3724,9 +3949,12 @@ void UtTest_Setup(void)
     UtTest_Add(CS_AppMain_Test_RcvNoMsg, CS_Test_Setup, CS_Test_TearDown, "CS_AppMain_Test_RcvNoMsg");
     UtTest_Add(CS_AppMain_Test_RcvNullBufPtr, CS_Test_Setup, CS_Test_TearDown, "CS_AppMain_Test_RcvNullBufPtr");
     UtTest_Add(CS_AppMain_Test_AppPipeError, CS_Test_Setup, CS_Test_TearDown, "CS_AppMain_Test_AppPipeError");
+    UtTest_Add(CS_AppMain_Test_PacedCycle, CS_Test_Setup, CS_Test_TearDown, "CS_AppMain_Test_PacedCycle");
 
     UtTest_Add(CS_AppInit_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_AppInit_Test_Nominal");
     UtTest_Add(CS_AppInit_Test_EVSRegisterError, CS_Test_Setup, CS_Test_TearDown, "CS_AppInit_Test_EVSRegisterError");
+    UtTest_Add(CS_AppInit_Test_WorkerInitError, CS_Test_Setup, CS_Test_TearDown, "CS_AppInit_Test_WorkerInitError");
+    UtTest_Add(CS_AppInit_Test_WorkerTasksError, CS_Test_Setup, CS_Test_TearDown, "CS_AppInit_Test_WorkerTasksError");
 
     UtTest_Add(CS_AppPipe_Test_TableUpdateErrors, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_TableUpdateErrors");
     UtTest_Add(CS_AppPipe_Test_BackgroundCycle, CS_Test_Setup, CS_Test_TearDown, "CS_AppPipe_Test_BackgroundCycle");
@@ -3828,6 +4056,20 @@ void UtTest_Setup(void)
                "CS_ProcessCmd_OneShotCmd_Test");
     UtTest_Add(CS_ProcessCmd_CancelOneShotCmd_Test, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_CancelOneShotCmd_Test");
+    UtTest_Add(CS_ProcessCmd_CalibrateCRCCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_CalibrateCRCCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetCycleTimeBudgetCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetCycleTimeBudgetCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetCycleTimeTargetCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetCycleTimeTargetCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetBytesPerCycleCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetBytesPerCycleCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetSchedulerModeCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetSchedulerModeCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetPacingPeriodCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetPacingPeriodCmd_Test");
+    UtTest_Add(CS_ProcessCmd_SetIdleBytesCmd_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetIdleBytesCmd_Test");
     UtTest_Add(CS_ProcessCmd_DisableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_DisableTablesCmd_Test");
     UtTest_Add(CS_ProcessCmd_EnableTablesCmd_Test, CS_Test_Setup, CS_Test_TearDown,
@@ -3909,6 +4151,20 @@ void UtTest_Setup(void)
                "CS_ProcessCmd_OneShotCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_CancelOneShotCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_CalibrateCRCCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_CalibrateCRCCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetCycleTimeBudgetCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetCycleTimeBudgetCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetCycleTimeTargetCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetCycleTimeTargetCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetBytesPerCycleCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetBytesPerCycleCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetSchedulerModeCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetSchedulerModeCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetPacingPeriodCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetPacingPeriodCmd_Test_VerifyError");
+    UtTest_Add(CS_ProcessCmd_SetIdleBytesCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ProcessCmd_SetIdleBytesCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_DisableTablesCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessCmd_DisableTablesCmd_Test_VerifyError");
     UtTest_Add(CS_ProcessCmd_EnableTablesCmd_Test_VerifyError, CS_Test_Setup, CS_Test_TearDown,
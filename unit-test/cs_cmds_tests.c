@@ -39,6 +39,9 @@
 /* cs_cmds_tests globals */
 uint8 call_count_CFE_EVS_SendEvent;
 
+/* Microseconds returned by successive OS_GetLocalTime calls */
+static const uint32 *CS_CMDS_TEST_LocalTimes;
+
 /*
  * Function Definitions
  */
@@ -52,6 +55,35 @@ CFE_Status_t CS_CMDS_TEST_CFE_ES_CreateChildTaskHook(uint32 *TaskIdPtr, const ch
     return CFE_SUCCESS;
 }
 
+void CS_CMDS_TEST_OS_GetLocalTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    uint32     Call    = UT_GetStubCount(FuncKey) - 1;
+
+    *TimePtr = OS_TimeAssembleFromMicroseconds(0, CS_CMDS_TEST_LocalTimes[Call]);
+}
+
+/* Checksums up to 4 bytes of the cycle's budget per call */
+void CS_CMDS_TEST_CS_BackgroundAppHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 NumBytes = (CS_AppData.CycleBytesRemaining < 4) ? CS_AppData.CycleBytesRemaining : 4;
+
+    CS_AppData.CycleBytesRemaining -= NumBytes;
+}
+
+void CS_CMDS_TEST_CS_ResetCycleBytesHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_AppData.CycleBytesBudget    = CS_AppData.MaxBytesPerCycle;
+    CS_AppData.CycleBytesRemaining = CS_AppData.MaxBytesPerCycle;
+}
+
+void CS_CMDS_TEST_CS_ResetCycleBytesSharedHandler(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    CS_AppData.CycleBytesBudget    = CS_AppData.MaxBytesPerCycle / 2;
+    CS_AppData.CycleBytesRemaining = CS_AppData.CycleBytesBudget;
+}
+
 void CS_NoopCmd_Test(void)
 {
     CS_NoArgsCmd_t CmdPacket;
@@ -96,6 +128,16 @@ void CS_ResetCmd_Test(void)
     CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter = 7;
     CS_AppData.HkPacket.Payload.OSCSErrCounter      = 8;
     CS_AppData.HkPacket.Payload.PassCounter         = 9;
+    CS_AppData.HkPacket.Payload.CycleOvershootCount = 10;
+    CS_AppData.HkPacket.Payload.MaxCycleOvershoot   = 11;
+    CS_AppData.HkPacket.Payload.DeadlineMissCount   = 12;
+    CS_AppData.HkPacket.Payload.MaxPacingJitter     = 14;
+    CS_AppData.HkPacket.Payload.MissedPacedCycles   = 15;
+    CS_AppData.HkPacket.Payload.IdleBytesChecked    = 16;
+    CS_AppData.HkPacket.Payload.QueuedRequestCount  = 17;
+    CS_AppData.HkPacket.Payload.DroppedRequestCount = 18;
+
+    CS_AppData.HkPacket.Payload.BytesChecked[CS_OSCORE] = 13;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -112,6 +154,15 @@ void CS_ResetCmd_Test(void)
     UtAssert_True(CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter == 0, "CS_AppData.HkPacket.Payload.CfeCoreCSErrCounter == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.OSCSErrCounter == 0, "CS_AppData.HkPacket.Payload.OSCSErrCounter == 0");
     UtAssert_True(CS_AppData.HkPacket.Payload.PassCounter == 0, "CS_AppData.HkPacket.Payload.PassCounter == 0");
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleOvershootCount, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxCycleOvershoot, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCount, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_OSCORE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxPacingJitter, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MissedPacedCycles, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesChecked, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.QueuedRequestCount, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DroppedRequestCount, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RESET_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -177,11 +228,6 @@ void CS_BackgroundCheckCycle_Test_BackgroundInProgress(void)
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
     size_t            MsgSize;
-    int32             strCmpResult;
-    char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Skipping background cycle. Recompute or oneshot in progress.");
 
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
@@ -205,17 +251,9 @@ void CS_BackgroundCheckCycle_Test_BackgroundInProgress(void)
     CS_BackgroundCheckCycle(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BKGND_COMPUTE_PROG_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(CS_ResetCycleBytes, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundCfeCore, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void CS_BackgroundCheckCycle_Test_BackgroundCfeCore(void)
@@ -483,11 +521,6 @@ void CS_BackgroundCheckCycle_Test_OneShot(void)
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
     size_t            MsgSize;
-    int32             strCmpResult;
-    char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Skipping background cycle. Recompute or oneshot in progress.");
 
     TestMsgId = CFE_SB_ValueToMsgId(CS_CMD_MID);
     MsgSize   = sizeof(CS_NoArgsCmd_t);
@@ -512,17 +545,9 @@ void CS_BackgroundCheckCycle_Test_OneShot(void)
     CS_BackgroundCheckCycle(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_BKGND_COMPUTE_PROG_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(CS_ResetCycleBytes, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundCfeCore, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void CS_BackgroundCheckCycle_Test_EndOfList(void)
@@ -757,7 +782,8 @@ void CS_ReportBaselineCfeCoreCmd_Test_Nominal(void)
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Baseline of cFE Core is 0x%%08X");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Baseline of cFE Core is 0x%%08X, algorithm %%d");
 
     CS_AppData.CfeCoreCodeSeg.ComputedYet     = true;
     CS_AppData.CfeCoreCodeSeg.ComparisonValue = -1;
@@ -820,7 +846,8 @@ void CS_ReportBaselineOSCmd_Test_Nominal(void)
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Baseline of OS code segment is 0x%%08X");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Baseline of OS code segment is 0x%%08X, algorithm %%d");
 
     CS_AppData.OSCodeSeg.ComputedYet     = true;
     CS_AppData.OSCodeSeg.ComparisonValue = -1;
@@ -889,17 +916,17 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_CFECORE, "CS_AppData.ChildTaskTable == CS_CFECORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.ChildTaskEntryID == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_CFECORE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, 0);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.CfeCoreCodeSeg);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -916,33 +943,33 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineCfeCoreCmd_Test_PostWorkError(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute cFE core failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute cFE core failed, posting to worker queue failed: 0x%%08X");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
-    /* Set to generate error message CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_CFECORE_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
 
     /* Verify results */
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_CFECORE, "CS_AppData.ChildTaskTable == CS_CFECORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.ChildTaskEntryID == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.CfeCoreCodeSeg");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_CFECORE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, 0);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.CfeCoreCodeSeg);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_CFECORE_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -958,6 +985,28 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineCfeCoreCmd_Test_EntryLocked(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
+
+    /* Another worker already holds the entry */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CS_ENTRY_LOCKED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError(void)
 {
     CS_NoArgsCmd_t CmdPacket;
@@ -989,6 +1038,26 @@ void CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineCfeCoreCmd_Test_Queued(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineCfeCoreCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_RecomputeBaselineCfeCoreCmd_Test_OneShot(void)
 {
     CS_NoArgsCmd_t CmdPacket;
@@ -1033,17 +1102,17 @@ void CS_RecomputeBaselineOSCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineOSCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_OSCORE, "CS_AppData.ChildTaskTable == CS_OSCORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.OSCodeSeg == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_OSCORE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, 0);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.OSCodeSeg);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -1060,33 +1129,33 @@ void CS_RecomputeBaselineOSCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineOSCmd_Test_PostWorkError(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute OS code segment failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute OS code segment failed, posting to worker queue failed: 0x%%08X");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
-    /* Set to generate error message CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_OS_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineOSCmd(&CmdPacket);
 
     /* Verify results */
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_OSCORE, "CS_AppData.ChildTaskTable == CS_OSCORE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == 0, "CS_AppData.OSCodeSeg == 0");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg,
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.OSCodeSeg");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_OSCORE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, 0);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.OSCodeSeg);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_OS_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -1102,6 +1171,28 @@ void CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineOSCmd_Test_EntryLocked(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
+
+    /* Another worker already holds the entry */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CS_ENTRY_LOCKED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineOSCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_RecomputeBaselineOSCmd_Test_ChildTaskError(void)
 {
     CS_NoArgsCmd_t CmdPacket;
@@ -1134,6 +1225,26 @@ void CS_RecomputeBaselineOSCmd_Test_ChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineOSCmd_Test_Queued(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineOSCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_RecomputeBaselineOSCmd_Test_OneShot(void)
 {
     CS_NoArgsCmd_t CmdPacket;
@@ -1184,7 +1295,10 @@ void CS_OneShotCmd_Test_Nominal(void)
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.MaxBytesPerCycle             = 8;
 
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), CS_AppData.MaxBytesPerCycle);
+
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
@@ -1208,7 +1322,7 @@ void CS_OneShotCmd_Test_Nominal(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
+    UtAssert_STUB_COUNT(CS_PostWork, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1234,6 +1348,7 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
     CS_AppData.MaxBytesPerCycle             = 8;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
@@ -1257,7 +1372,7 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
+    UtAssert_STUB_COUNT(CS_PostWork, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -1266,7 +1381,7 @@ void CS_OneShotCmd_Test_MaxBytesPerCycleNonZero(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_OneShotCmd_Test_CreateChildTaskError(void)
+void CS_OneShotCmd_Test_PostWorkError(void)
 {
     CS_OneShotCmd_t CmdPacket;
     int32           strCmpResult;
@@ -1275,14 +1390,15 @@ void CS_OneShotCmd_Test_CreateChildTaskError(void)
     memset(&CmdPacket, 0, sizeof(CmdPacket));
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "OneShot checkum failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "OneShot checkum failed, posting to worker queue failed: 0x%%08X");
 
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
 
-    /* Set to generate error message CS_RECOMPUTE_OS_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_ONESHOT_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_PostWork), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_OneShotCmd(&CmdPacket);
@@ -1294,7 +1410,7 @@ void CS_OneShotCmd_Test_CreateChildTaskError(void)
                   "CS_AppData.HkPacket.Payload.LastOneShotSize == CmdPacket.Payload.Size");
     UtAssert_True(CS_AppData.HkPacket.Payload.LastOneShotChecksum == 0, "CS_AppData.HkPacket.Payload.LastOneShotChecksum == 0");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -1342,6 +1458,48 @@ void CS_OneShotCmd_Test_ChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_OneShotCmd_Test_Queued(void)
+{
+    CS_OneShotCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_OneShotCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_PostWork, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
+void CS_OneShotCmd_Test_QueuedBehindRecompute(void)
+{
+    CS_OneShotCmd_t CmdPacket;
+
+    /* A worker is free, but a one shot waits for every recompute to finish */
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_OneShotCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_PostWork, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_OneShotCmd_Test_MemValidateRangeError(void)
 {
     CS_OneShotCmd_t CmdPacket;
@@ -1428,9 +1586,9 @@ void CS_CancelOneShotCmd_Test_Nominal(void)
     CS_CancelOneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
+    UtAssert_BOOL_TRUE(CS_AppData.OneShotCancelled);
     UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == false, "CS_AppData.HkPacket.Payload.RecomputeInProgress == false");
-    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
+    UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == true, "CS_AppData.HkPacket.Payload.OneShotInProgress == true");
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCELLED_INF_EID);
@@ -1446,20 +1604,19 @@ void CS_CancelOneShotCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_CancelOneShotCmd_Test_DeleteChildTaskError(void)
+void CS_CancelOneShotCmd_Test_AlreadyCancelled(void)
 {
     CS_NoArgsCmd_t CmdPacket;
     int32          strCmpResult;
     char           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Cancel OneShot checksum failed, CFE_ES_DeleteChildTask returned:  0x%%08X");
+             "Cancel OneShot checksum failed. No OneShot active");
 
+    /* The one shot has been cancelled but has not reached its next chunk yet */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
-
-    /* Set to generate error message CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
+    CS_AppData.OneShotCancelled                     = true;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
@@ -1467,7 +1624,8 @@ void CS_CancelOneShotCmd_Test_DeleteChildTaskError(void)
     CS_CancelOneShotCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCEL_DELETE_CHDTASK_ERR_EID);
+    UtAssert_BOOL_TRUE(CS_AppData.OneShotCancelled);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -1495,8 +1653,6 @@ void CS_CancelOneShotCmd_Test_NoChildTaskError(void)
     CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
     /* Set to generate error message CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
-
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
     /* Execute the function being tested */
@@ -1531,8 +1687,6 @@ void CS_CancelOneShotCmd_Test_OneShot(void)
     CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
 
     /* Set to generate error message CS_ONESHOT_CANCEL_NO_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_DeleteChildTask), 1, -1);
-
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
 
     /* Execute the function being tested */
@@ -1554,6 +1708,952 @@ void CS_CancelOneShotCmd_Test_OneShot(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_BackgroundCheckCycle_Test_TimeBudget(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    /* The third chunk takes the cycle past its budget */
+    static const uint32 LocalTimes[] = {0, 1000, 2000, 3000, 3000};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 2500;
+    CS_AppData.MaxBytesPerCycle                 = 4;
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 3);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 5);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleTime, 3000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 12);
+}
+
+void CS_BackgroundCheckCycle_Test_TimeBudgetNothingEnabled(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 10};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 2500;
+
+    /* Passing the end of the list a second time without a chunk ends the cycle with budget to spare */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 2);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleTime, 10);
+}
+
+void CS_BackgroundCheckCycle_Test_TimeBudgetClockBackwards(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {5000, 4000, 4000};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 2500;
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleTime, 0);
+}
+
+void CS_BackgroundCheckCycle_Test_NoTimeBudget(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 700};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 0;
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleTime, 700);
+}
+
+void CS_BackgroundCheckCycle_Test_CarryBytes(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_APP_TABLE;
+    CS_AppData.MaxBytesPerCycle                = 16;
+
+    /* Bytes left after each entry carry on, but the end of the list is only passed once */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_FindOverdueEntry, 0);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 2);
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 8);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 8);
+}
+
+void CS_BackgroundCheckCycle_Test_TimeTarget(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 400};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_UpdateBytesPerCycle, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleTime, 400);
+}
+
+void CS_BackgroundCheckCycle_Test_TimeTargetShared(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 400};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState       = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeTarget     = 1000;
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    CS_AppData.MaxBytesPerCycle                     = 16;
+
+    /* A cycle sharing its bytes with a recompute runs, but is not used to adapt the bytes per cycle */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesSharedHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 1);
+    UtAssert_STUB_COUNT(CS_UpdateBytesPerCycle, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 4);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 16);
+}
+
+void CS_BackgroundCheckCycle_Test_TimeTargetWithBudget(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 3000, 3000};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable  = CS_APP_TABLE;
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 2500;
+    CS_AppData.MaxBytesPerCycle                 = 4;
+
+    /* The time budget takes precedence over the controller */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_UpdateBytesPerCycle, 0);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 4);
+}
+
+void CS_BackgroundCheckCycle_Test_Deadline(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.SchedulerMode  = CS_SCHEDULER_DEADLINE;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_APP_TABLE;
+    CS_AppData.MaxBytesPerCycle                = 8;
+
+    /* One entry is overdue, then the sweep takes the rest of the cycle */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundEntry), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_FindOverdueEntry), 1, true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundEntry, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 8);
+}
+
+void CS_BackgroundCheckCycle_Test_DeadlineNoProgress(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.SchedulerMode  = CS_SCHEDULER_DEADLINE;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_APP_TABLE;
+    CS_AppData.MaxBytesPerCycle                = 8;
+
+    /* An overdue entry that checksums nothing is not picked again this cycle */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_FindOverdueEntry), true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_FindOverdueEntry, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundEntry, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 8);
+}
+
+void CS_BackgroundCheckCycle_Test_Weighted(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.SchedulerMode = CS_SCHEDULER_WEIGHTED;
+    CS_AppData.MaxBytesPerCycle               = 8;
+
+    /* The weighted scheduler hands out the whole cycle, the sweep is not used */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundWeighted), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_BackgroundWeighted), 2, true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundWeighted, 2);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 0);
+    UtAssert_STUB_COUNT(CS_FindOverdueEntry, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 8);
+}
+
+void CS_BackgroundCheckCycle_Test_Interleaved(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.SchedulerMode = CS_SCHEDULER_INTERLEAVED;
+    CS_AppData.MaxBytesPerCycle               = 8;
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundInterleaved), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_BackgroundInterleaved), 2, true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundInterleaved, 2);
+    UtAssert_STUB_COUNT(CS_BackgroundWeighted, 0);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 8);
+}
+
+void CS_BackgroundCheckCycle_Test_WeightedNoProgress(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+    size_t         MsgSize = sizeof(CS_NoArgsCmd_t);
+
+    static const uint32 LocalTimes[] = {0, 100};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    CS_AppData.HkPacket.Payload.ChecksumState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.SchedulerMode = CS_SCHEDULER_WEIGHTED;
+    CS_AppData.MaxBytesPerCycle               = 8;
+
+    /* Nothing left to checksum ends the cycle early */
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ResetCycleBytes), CS_CMDS_TEST_CS_ResetCycleBytesHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundWeighted, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastCycleBytes, 0);
+}
+
+void CS_BackgroundCheckCycle_Test_Paced(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.ChecksumState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.PacingPeriod  = 10;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    CS_BackgroundCheckCycle(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ResetCycleBytes, 0);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+}
+
+void CS_PaceBackgroundCycle_Test_NotPaced(void)
+{
+    /* Execute the function being tested */
+    CS_PaceBackgroundCycle();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacedCycleCount, 0);
+}
+
+void CS_PaceBackgroundCycle_Test_NotDue(void)
+{
+    static const uint32 LocalTimes[] = {15000};
+
+    CS_AppData.HkPacket.Payload.ChecksumState = CS_STATE_DISABLED;
+    CS_AppData.HkPacket.Payload.PacingPeriod  = 10;
+    CS_AppData.NextPacedCycle                 = OS_TimeAssembleFromMicroseconds(0, 20000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_PaceBackgroundCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacedCycleCount, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(CS_AppData.NextPacedCycle), 20000);
+}
+
+void CS_PaceBackgroundCycle_Test_Due(void)
+{
+    static const uint32 LocalTimes[] = {12500};
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_DISABLED;
+    CS_AppData.HkPacket.Payload.PacingPeriod    = 10;
+    CS_AppData.HkPacket.Payload.MaxPacingJitter = 1000;
+    CS_AppData.NextPacedCycle                   = OS_TimeAssembleFromMicroseconds(0, 10000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_PaceBackgroundCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacedCycleCount, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPacingJitter, 2500);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxPacingJitter, 2500);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MissedPacedCycles, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(CS_AppData.NextPacedCycle), 20000);
+}
+
+void CS_PaceBackgroundCycle_Test_Missed(void)
+{
+    static const uint32 LocalTimes[] = {35000};
+
+    CS_AppData.HkPacket.Payload.ChecksumState   = CS_STATE_DISABLED;
+    CS_AppData.HkPacket.Payload.PacingPeriod    = 10;
+    CS_AppData.HkPacket.Payload.MaxPacingJitter = 6000;
+    CS_AppData.NextPacedCycle                   = OS_TimeAssembleFromMicroseconds(0, 10000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_PaceBackgroundCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacedCycleCount, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MissedPacedCycles, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastPacingJitter, 5000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxPacingJitter, 6000);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(CS_AppData.NextPacedCycle), 40000);
+}
+
+void CS_PaceBackgroundCycle_Test_ClockBackwards(void)
+{
+    static const uint32 LocalTimes[] = {20000};
+
+    CS_AppData.HkPacket.Payload.PacingPeriod = 10;
+    CS_AppData.NextPacedCycle                = OS_TimeAssembleFromMicroseconds(0, 50000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_PaceBackgroundCycle();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacedCycleCount, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(CS_AppData.NextPacedCycle), 20000);
+}
+
+void CS_GetPipeTimeout_Test_NotPaced(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_GetPipeTimeout(), CS_WAKEUP_TIMEOUT);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+}
+
+void CS_GetPipeTimeout_Test_Due(void)
+{
+    static const uint32 LocalTimes[] = {12000};
+
+    CS_AppData.HkPacket.Payload.PacingPeriod = 10;
+    CS_AppData.NextPacedCycle                = OS_TimeAssembleFromMicroseconds(0, 10000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_GetPipeTimeout(), CFE_SB_POLL);
+}
+
+void CS_GetPipeTimeout_Test_Wait(void)
+{
+    static const uint32 LocalTimes[] = {7500};
+
+    CS_AppData.HkPacket.Payload.PacingPeriod = 10;
+    CS_AppData.NextPacedCycle                = OS_TimeAssembleFromMicroseconds(0, 10000);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_GetPipeTimeout(), 3);
+}
+
+void CS_GetPipeTimeout_Test_LongWait(void)
+{
+    static const uint32 LocalTimes[] = {0};
+
+    CS_AppData.HkPacket.Payload.PacingPeriod = CS_MAX_PACING_PERIOD;
+    CS_AppData.NextPacedCycle                = OS_TimeAssembleFromMicroseconds(30, 0);
+
+    CS_CMDS_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CMDS_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_GetPipeTimeout(), CS_WAKEUP_TIMEOUT);
+}
+
+void CS_HarvestIdleTime_Test_Off(void)
+{
+    CS_AppData.HkPacket.Payload.ChecksumState  = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_APP_TABLE;
+
+    /* Execute the function being tested */
+    CS_HarvestIdleTime();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesChecked, 0);
+}
+
+void CS_HarvestIdleTime_Test_RecomputeInProgress(void)
+{
+    CS_AppData.HkPacket.Payload.ChecksumState       = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.IdleBytesPerWakeup  = 100;
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_APP_TABLE;
+
+    /* The recompute takes its share of the idle bytes */
+    UT_SetDefaultReturnValue(UT_KEY(CS_ShareCycleBytes), 50);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_HarvestIdleTime();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ShareCycleBytes, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 1);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE], 50);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesChecked, 4);
+}
+
+void CS_HarvestIdleTime_Test_Nominal(void)
+{
+    CS_AppData.HkPacket.Payload.ChecksumState      = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.IdleBytesPerWakeup = 100;
+    CS_AppData.HkPacket.Payload.IdleBytesChecked   = 10;
+    CS_AppData.HkPacket.Payload.SchedulerMode      = CS_SCHEDULER_WEIGHTED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable     = CS_APP_TABLE;
+    CS_AppData.MaxBytesPerCycle                    = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_ShareCycleBytes), 100);
+    UT_SetHandlerFunction(UT_KEY(CS_BackgroundApp), CS_CMDS_TEST_CS_BackgroundAppHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), true);
+
+    /* Execute the function being tested */
+    CS_HarvestIdleTime();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 1);
+    UtAssert_STUB_COUNT(CS_BackgroundWeighted, 0);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE], 100);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesChecked, 14);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 16);
+}
+
+void CS_HarvestIdleTime_Test_EndOfList(void)
+{
+    CS_AppData.HkPacket.Payload.ChecksumState      = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.IdleBytesPerWakeup = 100;
+    CS_AppData.HkPacket.Payload.CurrentCSTable     = CS_APP_TABLE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_ShareCycleBytes), 100);
+    UT_SetDefaultReturnValue(UT_KEY(CS_BackgroundApp), false);
+
+    /* Execute the function being tested */
+    CS_HarvestIdleTime();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BackgroundApp, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesChecked, 0);
+}
+
+void CS_CalibrateCRCCmd_Test(void)
+{
+    CS_NoArgsCmd_t CmdPacket;
+
+    /* Execute the function being tested */
+    CS_CalibrateCRCCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalibrateDefaultCRC, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+}
+
+void CS_SetCycleTimeBudgetCmd_Test_Nominal(void)
+{
+    CS_SetCycleTimeBudgetCmd_t CmdPacket;
+
+    CmdPacket.Payload.CycleTimeBudget = CS_MAX_CYCLE_TIME_BUDGET;
+
+    /* Execute the function being tested */
+    CS_SetCycleTimeBudgetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeBudget, CS_MAX_CYCLE_TIME_BUDGET);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_CYCLE_TIME_BUDGET_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetCycleTimeBudgetCmd_Test_TooLarge(void)
+{
+    CS_SetCycleTimeBudgetCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.CycleTimeBudget = 1000;
+    CmdPacket.Payload.CycleTimeBudget           = CS_MAX_CYCLE_TIME_BUDGET + 1;
+
+    /* Execute the function being tested */
+    CS_SetCycleTimeBudgetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeBudget, 1000);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_CYCLE_TIME_BUDGET_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetCycleTimeTargetCmd_Test_Nominal(void)
+{
+    CS_SetCycleTimeTargetCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.CycleOvershootCount = 1;
+    CS_AppData.HkPacket.Payload.MaxCycleOvershoot   = 2;
+    CS_AppData.MaxBytesPerCycle                     = 3;
+    CmdPacket.Payload.CycleTimeTarget               = CS_MAX_CYCLE_TIME_BUDGET;
+
+    /* Execute the function being tested */
+    CS_SetCycleTimeTargetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeTarget, CS_MAX_CYCLE_TIME_BUDGET);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleOvershootCount, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxCycleOvershoot, 0);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 3);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_CYCLE_TIME_TARGET_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetCycleTimeTargetCmd_Test_Off(void)
+{
+    CS_SetCycleTimeTargetCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+    CS_AppData.MaxBytesPerCycle                 = 3;
+    CmdPacket.Payload.CycleTimeTarget           = 0;
+
+    /* Execute the function being tested */
+    CS_SetCycleTimeTargetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeTarget, 0);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, CS_DEFAULT_BYTES_PER_CYCLE);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_CYCLE_TIME_TARGET_INF_EID);
+}
+
+void CS_SetCycleTimeTargetCmd_Test_TooLarge(void)
+{
+    CS_SetCycleTimeTargetCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+    CmdPacket.Payload.CycleTimeTarget           = CS_MAX_CYCLE_TIME_BUDGET + 1;
+
+    /* Execute the function being tested */
+    CS_SetCycleTimeTargetCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleTimeTarget, 1000);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_CYCLE_TIME_TARGET_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetBytesPerCycleCmd_Test_Nominal(void)
+{
+    CS_SetBytesPerCycleCmd_t CmdPacket;
+    CS_Def_Budget_Table_t    BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    CS_AppData.DefBudgetTblPtr      = &BudgetTbl;
+    CmdPacket.Payload.Budget        = CS_EEPROM_TABLE;
+    CmdPacket.Payload.BytesPerCycle = 64;
+
+    /* Execute the function being tested */
+    CS_SetBytesPerCycleCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE], 64);
+    UtAssert_UINT32_EQ(BudgetTbl.BytesPerCycle[CS_MEMORY_TABLE], 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+    UtAssert_STUB_COUNT(CS_RefreshBudgets, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_BYTES_PER_CYCLE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetBytesPerCycleCmd_Test_InvalidBudget(void)
+{
+    CS_SetBytesPerCycleCmd_t CmdPacket;
+    CS_Def_Budget_Table_t    BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    CS_AppData.DefBudgetTblPtr      = &BudgetTbl;
+    CmdPacket.Payload.Budget        = CS_NUM_BUDGETS;
+    CmdPacket.Payload.BytesPerCycle = 64;
+
+    /* Execute the function being tested */
+    CS_SetBytesPerCycleCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_BYTES_PER_CYCLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetBytesPerCycleCmd_Test_TooLarge(void)
+{
+    CS_SetBytesPerCycleCmd_t CmdPacket;
+    CS_Def_Budget_Table_t    BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    CS_AppData.DefBudgetTblPtr      = &BudgetTbl;
+    CmdPacket.Payload.Budget        = CS_EEPROM_TABLE;
+    CmdPacket.Payload.BytesPerCycle = CS_MAX_BUDGET_BYTES_PER_CYCLE + 1;
+
+    /* Execute the function being tested */
+    CS_SetBytesPerCycleCmd(&CmdPacket);
+
+    /* Verify results, the table validation would reject the same budget */
+    UtAssert_UINT32_EQ(BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE], 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_BYTES_PER_CYCLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetBytesPerCycleCmd_Test_NoTable(void)
+{
+    CS_SetBytesPerCycleCmd_t CmdPacket;
+
+    CmdPacket.Payload.Budget        = CS_CHILD_TASK_BUDGET;
+    CmdPacket.Payload.BytesPerCycle = 64;
+
+    /* Execute the function being tested */
+    CS_SetBytesPerCycleCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_BYTES_PER_CYCLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetSchedulerModeCmd_Test_Nominal(void)
+{
+    CS_SetSchedulerModeCmd_t CmdPacket;
+
+    CmdPacket.Payload.Mode = CS_SCHEDULER_DEADLINE;
+
+    /* Execute the function being tested */
+    CS_SetSchedulerModeCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.SchedulerMode, CS_SCHEDULER_DEADLINE);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_SCHEDULER_MODE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetSchedulerModeCmd_Test_Weighted(void)
+{
+    CS_SetSchedulerModeCmd_t CmdPacket;
+
+    CS_AppData.Deficit[CS_APP_TABLE] = 20;
+    CS_AppData.CategoriesDone        = 3;
+    CmdPacket.Payload.Mode           = CS_SCHEDULER_WEIGHTED;
+
+    /* Execute the function being tested */
+    CS_SetSchedulerModeCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.SchedulerMode, CS_SCHEDULER_WEIGHTED);
+    UtAssert_UINT32_EQ(CS_AppData.Deficit[CS_APP_TABLE], 0);
+    UtAssert_UINT16_EQ(CS_AppData.CategoriesDone, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_SCHEDULER_MODE_INF_EID);
+}
+
+void CS_SetSchedulerModeCmd_Test_InvalidMode(void)
+{
+    CS_SetSchedulerModeCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.SchedulerMode = CS_SCHEDULER_DEADLINE;
+    CmdPacket.Payload.Mode                    = CS_SCHEDULER_INTERLEAVED + 1;
+
+    /* Execute the function being tested */
+    CS_SetSchedulerModeCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.SchedulerMode, CS_SCHEDULER_DEADLINE);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_SCHEDULER_MODE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetPacingPeriodCmd_Test_Nominal(void)
+{
+    CS_SetPacingPeriodCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.MaxPacingJitter   = 5;
+    CS_AppData.HkPacket.Payload.MissedPacedCycles = 6;
+    CmdPacket.Payload.PacingPeriod                = 250;
+
+    /* Execute the function being tested */
+    CS_SetPacingPeriodCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacingPeriod, 250);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxPacingJitter, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MissedPacedCycles, 0);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_PACING_PERIOD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetPacingPeriodCmd_Test_TooLong(void)
+{
+    CS_SetPacingPeriodCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.PacingPeriod = 100;
+    CmdPacket.Payload.PacingPeriod           = CS_MAX_PACING_PERIOD + 1;
+
+    /* Execute the function being tested */
+    CS_SetPacingPeriodCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PacingPeriod, 100);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_PACING_PERIOD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_SetIdleBytesCmd_Test_Nominal(void)
+{
+    CS_SetIdleBytesCmd_t CmdPacket;
+
+    CmdPacket.Payload.IdleBytes = 4096;
+
+    /* Execute the function being tested */
+    CS_SetIdleBytesCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesPerWakeup, 4096);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_IDLE_BYTES_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_SetIdleBytesCmd_Test_TooLarge(void)
+{
+    CS_SetIdleBytesCmd_t CmdPacket;
+
+    CS_AppData.HkPacket.Payload.IdleBytesPerWakeup = 100;
+    CmdPacket.Payload.IdleBytes                    = CS_MAX_IDLE_BYTES_PER_WAKEUP + 1;
+
+    /* Execute the function being tested */
+    CS_SetIdleBytesCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.IdleBytesPerWakeup, 100);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_SET_IDLE_BYTES_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_NoopCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_NoopCmd_Test");
@@ -1584,6 +2684,60 @@ void UtTest_Setup(void)
                "CS_BackgroundCheckCycle_Test_OneShot");
     UtTest_Add(CS_BackgroundCheckCycle_Test_EndOfList, CS_Test_Setup, CS_Test_TearDown,
                "CS_BackgroundCheckCycle_Test_EndOfList");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeBudget");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeBudgetNothingEnabled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeBudgetNothingEnabled");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeBudgetClockBackwards, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeBudgetClockBackwards");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_NoTimeBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_NoTimeBudget");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_CarryBytes, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_CarryBytes");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeTarget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeTarget");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeTargetShared, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeTargetShared");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_TimeTargetWithBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_TimeTargetWithBudget");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_Deadline, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_Deadline");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_DeadlineNoProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_DeadlineNoProgress");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_Weighted, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_Weighted");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_Interleaved, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_Interleaved");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_WeightedNoProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_WeightedNoProgress");
+    UtTest_Add(CS_BackgroundCheckCycle_Test_Paced, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCheckCycle_Test_Paced");
+    UtTest_Add(CS_PaceBackgroundCycle_Test_NotPaced, CS_Test_Setup, CS_Test_TearDown,
+               "CS_PaceBackgroundCycle_Test_NotPaced");
+    UtTest_Add(CS_PaceBackgroundCycle_Test_NotDue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_PaceBackgroundCycle_Test_NotDue");
+    UtTest_Add(CS_PaceBackgroundCycle_Test_Due, CS_Test_Setup, CS_Test_TearDown,
+               "CS_PaceBackgroundCycle_Test_Due");
+    UtTest_Add(CS_PaceBackgroundCycle_Test_Missed, CS_Test_Setup, CS_Test_TearDown,
+               "CS_PaceBackgroundCycle_Test_Missed");
+    UtTest_Add(CS_PaceBackgroundCycle_Test_ClockBackwards, CS_Test_Setup, CS_Test_TearDown,
+               "CS_PaceBackgroundCycle_Test_ClockBackwards");
+    UtTest_Add(CS_GetPipeTimeout_Test_NotPaced, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetPipeTimeout_Test_NotPaced");
+    UtTest_Add(CS_GetPipeTimeout_Test_Due, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetPipeTimeout_Test_Due");
+    UtTest_Add(CS_GetPipeTimeout_Test_Wait, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetPipeTimeout_Test_Wait");
+    UtTest_Add(CS_GetPipeTimeout_Test_LongWait, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetPipeTimeout_Test_LongWait");
+    UtTest_Add(CS_HarvestIdleTime_Test_Off, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HarvestIdleTime_Test_Off");
+    UtTest_Add(CS_HarvestIdleTime_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HarvestIdleTime_Test_RecomputeInProgress");
+    UtTest_Add(CS_HarvestIdleTime_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HarvestIdleTime_Test_Nominal");
+    UtTest_Add(CS_HarvestIdleTime_Test_EndOfList, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HarvestIdleTime_Test_EndOfList");
 
     UtTest_Add(CS_DisableAllCSCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_DisableAllCSCmd_Test");
 
@@ -1609,36 +2763,79 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineCfeCoreCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineCfeCoreCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineCfeCoreCmd_Test_PostWorkError");
+    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineCfeCoreCmd_Test_EntryLocked");
     UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineCfeCoreCmd_Test_ChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineCfeCoreCmd_Test_Queued");
     UtTest_Add(CS_RecomputeBaselineCfeCoreCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineCfeCoreCmd_Test_OneShot");
 
     UtTest_Add(CS_RecomputeBaselineOSCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineOSCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineOSCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineOSCmd_Test_PostWorkError");
+    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineOSCmd_Test_EntryLocked");
     UtTest_Add(CS_RecomputeBaselineOSCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineOSCmd_Test_ChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineOSCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineOSCmd_Test_Queued");
     UtTest_Add(CS_RecomputeBaselineOSCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineOSCmd_Test_OneShot");
 
     UtTest_Add(CS_OneShotCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_Nominal");
     UtTest_Add(CS_OneShotCmd_Test_MaxBytesPerCycleNonZero, CS_Test_Setup, CS_Test_TearDown,
                "CS_OneShotCmd_Test_MaxBytesPerCycleNonZero");
-    UtTest_Add(CS_OneShotCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_OneShotCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_OneShotCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_OneShotCmd_Test_PostWorkError");
     UtTest_Add(CS_OneShotCmd_Test_ChildTaskError, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_ChildTaskError");
+    UtTest_Add(CS_OneShotCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_Queued");
+    UtTest_Add(CS_OneShotCmd_Test_QueuedBehindRecompute, CS_Test_Setup, CS_Test_TearDown,
+               "CS_OneShotCmd_Test_QueuedBehindRecompute");
     UtTest_Add(CS_OneShotCmd_Test_MemValidateRangeError, CS_Test_Setup, CS_Test_TearDown,
                "CS_OneShotCmd_Test_MemValidateRangeError");
     UtTest_Add(CS_OneShotCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotCmd_Test_OneShot");
 
     UtTest_Add(CS_CancelOneShotCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_CancelOneShotCmd_Test_Nominal");
-    UtTest_Add(CS_CancelOneShotCmd_Test_DeleteChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_CancelOneShotCmd_Test_DeleteChildTaskError");
+    UtTest_Add(CS_CancelOneShotCmd_Test_AlreadyCancelled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CancelOneShotCmd_Test_AlreadyCancelled");
     UtTest_Add(CS_CancelOneShotCmd_Test_NoChildTaskError, CS_Test_Setup, CS_Test_TearDown,
                "CS_CancelOneShotCmd_Test_NoChildTaskError");
     UtTest_Add(CS_CancelOneShotCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown, "CS_CancelOneShotCmd_Test_OneShot");
+    UtTest_Add(CS_CalibrateCRCCmd_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CalibrateCRCCmd_Test");
+    UtTest_Add(CS_SetCycleTimeBudgetCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetCycleTimeBudgetCmd_Test_Nominal");
+    UtTest_Add(CS_SetCycleTimeBudgetCmd_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetCycleTimeBudgetCmd_Test_TooLarge");
+    UtTest_Add(CS_SetCycleTimeTargetCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetCycleTimeTargetCmd_Test_Nominal");
+    UtTest_Add(CS_SetCycleTimeTargetCmd_Test_Off, CS_Test_Setup, CS_Test_TearDown, "CS_SetCycleTimeTargetCmd_Test_Off");
+    UtTest_Add(CS_SetCycleTimeTargetCmd_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetCycleTimeTargetCmd_Test_TooLarge");
+    UtTest_Add(CS_SetBytesPerCycleCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetBytesPerCycleCmd_Test_Nominal");
+    UtTest_Add(CS_SetBytesPerCycleCmd_Test_InvalidBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetBytesPerCycleCmd_Test_InvalidBudget");
+    UtTest_Add(CS_SetBytesPerCycleCmd_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetBytesPerCycleCmd_Test_TooLarge");
+    UtTest_Add(CS_SetBytesPerCycleCmd_Test_NoTable, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetBytesPerCycleCmd_Test_NoTable");
+    UtTest_Add(CS_SetSchedulerModeCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetSchedulerModeCmd_Test_Nominal");
+    UtTest_Add(CS_SetSchedulerModeCmd_Test_Weighted, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetSchedulerModeCmd_Test_Weighted");
+    UtTest_Add(CS_SetSchedulerModeCmd_Test_InvalidMode, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetSchedulerModeCmd_Test_InvalidMode");
+    UtTest_Add(CS_SetPacingPeriodCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetPacingPeriodCmd_Test_Nominal");
+    UtTest_Add(CS_SetPacingPeriodCmd_Test_TooLong, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetPacingPeriodCmd_Test_TooLong");
+    UtTest_Add(CS_SetIdleBytesCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetIdleBytesCmd_Test_Nominal");
+    UtTest_Add(CS_SetIdleBytesCmd_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SetIdleBytesCmd_Test_TooLarge");
 }
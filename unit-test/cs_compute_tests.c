@@ -22,6 +22,8 @@
  */
 
 #include "cs_compute.h"
+#include "cs_crc.h"
+#include "cs_hash.h"
 #include "cs_msg.h"
 #include "cs_msgdefs.h"
 #include "cs_events.h"
@@ -39,6 +41,13 @@
 /* cs_compute_tests globals */
 uint8 call_count_CFE_EVS_SendEvent;
 
+const void *CS_COMPUTE_TEST_ComputeCRCDataPtr;
+size_t      CS_COMPUTE_TEST_ComputeCRCDataLength;
+uint32      CS_COMPUTE_TEST_ComputeCRCTypeCRC;
+
+size_t CS_COMPUTE_TEST_ComputeHashByteOffset;
+uint64 CS_COMPUTE_TEST_FinishHashValue;
+
 /*
  * Function Definitions
  */
@@ -51,6 +60,15 @@ CFE_Status_t CS_COMPUTE_TEST_CFE_TBL_GetAddressHook(void *UserObj, int32 StubRet
     return CFE_TBL_ERR_UNREGISTERED;
 }
 
+int32 CS_COMPUTE_TEST_CS_GetBytesPerCycleHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                              const UT_StubContext_t *Context)
+{
+    /* Disables the definition table entry as a command would while the recompute runs */
+    ((CS_Def_App_Table_Entry_t *)UserObj)->State = CS_STATE_DISABLED;
+
+    return StubRetcode;
+}
+
 CFE_Status_t CS_COMPUTE_TEST_CFE_TBL_GetInfoHook1(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                                   const UT_StubContext_t *Context)
 {
@@ -61,6 +79,18 @@ CFE_Status_t CS_COMPUTE_TEST_CFE_TBL_GetInfoHook1(void *UserObj, int32 StubRetco
     return CFE_TBL_INFO_UPDATED;
 }
 
+uint32 CS_COMPUTE_TEST_WorkFuncCount;
+
+void CS_COMPUTE_TEST_WorkFunc(void)
+{
+    CS_COMPUTE_TEST_WorkFuncCount++;
+}
+
+void CS_COMPUTE_TEST_OS_TaskDelayCancelHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_AppData.OneShotCancelled = true;
+}
+
 void CS_COMPUTE_TEST_CFE_TBL_ShareHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     CFE_TBL_Handle_t *TblHandlePtr =
@@ -79,6 +109,54 @@ void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1(void *UserObj, UT_EntryKey_t F
     AppInfo->AddressesAreValid = true;
 }
 
+void CS_COMPUTE_TEST_CS_ComputeHashHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_COMPUTE_TEST_ComputeHashByteOffset = UT_Hook_GetArgValueByName(Context, "ByteOffset", size_t);
+}
+
+void CS_COMPUTE_TEST_CS_FinishHashHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint64 *HashValue = UT_Hook_GetArgValueByName(Context, "HashValue", uint64 *);
+
+    *HashValue = CS_COMPUTE_TEST_FinishHashValue;
+}
+
+void CS_COMPUTE_TEST_CS_ComputeCRCHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_COMPUTE_TEST_ComputeCRCDataPtr    = UT_Hook_GetArgValueByName(Context, "DataPtr", const void *);
+    CS_COMPUTE_TEST_ComputeCRCDataLength = UT_Hook_GetArgValueByName(Context, "DataLength", size_t);
+    CS_COMPUTE_TEST_ComputeCRCTypeCRC    = UT_Hook_GetArgValueByName(Context, "TypeCRC", uint32);
+}
+
+void CS_COMPUTE_TEST_CS_CombineCRCHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32  FirstCRC    = UT_Hook_GetArgValueByName(Context, "FirstCRC", uint32);
+    uint32  SecondCRC   = UT_Hook_GetArgValueByName(Context, "SecondCRC", uint32);
+    uint32 *CombinedCRC = UT_Hook_GetArgValueByName(Context, "CombinedCRC", uint32 *);
+
+    /* Any order dependent value will do to show the sub-ranges are merged in order */
+    *CombinedCRC = (FirstCRC * 10) + SecondCRC;
+}
+
+void CS_COMPUTE_TEST_CS_StartSubRangeTaskHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_Res_EepromMemory_Table_Entry_t *ResultsEntry = UserObj;
+    uint16                             SubRange     = UT_Hook_GetArgValueByName(Context, "SubRange", uint16);
+
+    /* Stands in for the sub-range task finishing as soon as it is started */
+    ResultsEntry->SubRangeChecksum[SubRange] = SubRange + 1;
+    ResultsEntry->SubRangeMask |= ((uint32)1 << SubRange);
+}
+
+void CS_COMPUTE_TEST_CS_FindSubRangeTaskHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint16 *WorkerID = UT_Hook_GetArgValueByName(Context, "WorkerID", uint16 *);
+    uint16 *SubRange = UT_Hook_GetArgValueByName(Context, "SubRange", uint16 *);
+
+    *WorkerID = CS_MAX_RECOMPUTE_WORKERS - 1;
+    *SubRange = CS_NUM_SUB_RANGES - 1;
+}
+
 void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     CFE_ES_AppInfo_t *AppInfo =
@@ -90,23 +168,24 @@ void CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2(void *UserObj, UT_EntryKey_t F
 void CS_ComputeEepromMemory_Test_Nominal(void)
 {
     CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
     uint32                            ComputedCSValue = 0;
     bool                              DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
     ResultsEntry.NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle     = 2;
 
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 1;
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -117,23 +196,24 @@ void CS_ComputeEepromMemory_Test_Nominal(void)
 void CS_ComputeEepromMemory_Test_Error(void)
 {
     CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
     uint32                            ComputedCSValue = 0;
     bool                              DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
     ResultsEntry.NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle     = 2;
 
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 5;
 
     /* Set to satisfy condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -144,21 +224,22 @@ void CS_ComputeEepromMemory_Test_Error(void)
 void CS_ComputeEepromMemory_Test_FirstTimeThrough(void)
 {
     CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
     uint32                            ComputedCSValue = 0;
     bool                              DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
     ResultsEntry.NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle     = 2;
 
     ResultsEntry.ComputedYet = false;
 
     /* ComputedCSValue and ResultsEntry.ComparisonValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -169,38 +250,471 @@ void CS_ComputeEepromMemory_Test_FirstTimeThrough(void)
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
     UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 0);
 
+    /* The byte left over stays in the budget for the next entry */
+    UtAssert_UINT32_EQ(BytesRemaining, 1);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void CS_ComputeEepromMemory_Test_NotFinished(void)
 {
     CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 1;
     uint32                            ComputedCSValue = 0;
     bool                              DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
     ResultsEntry.NumBytesToChecksum = 2;
-    CS_AppData.MaxBytesPerCycle     = 1;
 
     ResultsEntry.ComputedYet = false;
 
     /* ComputedCSValue and ResultsEntry.TempChecksumValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 1);
     UtAssert_UINT32_EQ(ResultsEntry.TempChecksumValue, 1);
+    UtAssert_UINT32_EQ(BytesRemaining, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void CS_ComputeEepromMemory_Test_EntryAlgorithm(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 1;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeCRC), CS_COMPUTE_TEST_CS_ComputeCRCHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 1);
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_ComputeCRCTypeCRC, CS_ALGORITHM_CRC_32C);
+}
+
+void CS_ComputeEepromMemory_Test_HashFirstTimeThrough(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 1;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_XXHASH_64;
+
+    ResultsEntry.ComputedYet = false;
+
+    CS_COMPUTE_TEST_ComputeHashByteOffset = 99;
+    CS_COMPUTE_TEST_FinishHashValue       = 0x1122334455667788;
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeHash), CS_COMPUTE_TEST_CS_ComputeHashHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_FinishHash), CS_COMPUTE_TEST_CS_FinishHashHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0x55667788);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValueHigh, 0x11223344);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x55667788);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 0);
+
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_ComputeHashByteOffset, 0);
+    UtAssert_STUB_COUNT(CS_ComputeHash, 1);
+    UtAssert_STUB_COUNT(CS_FinishHash, 1);
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeEepromMemory_Test_HashUpperHalfDiffers(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 1;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_FLETCHER_64;
+
+    ResultsEntry.ComputedYet         = true;
+    ResultsEntry.ComparisonValue     = 0x55667788;
+    ResultsEntry.ComparisonValueHigh = 0x11223344;
+
+    /* Only the upper half of the checksum differs from the saved value */
+    CS_COMPUTE_TEST_FinishHashValue = 0x1122334555667788;
+    UT_SetHandlerFunction(UT_KEY(CS_FinishHash), CS_COMPUTE_TEST_CS_FinishHashHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x55667788);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValueHigh, 0x11223344);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_ComputeEepromMemory_Test_HashNotFinished(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            BytesRemaining  = 2;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 10;
+    ResultsEntry.ByteOffset         = 4;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_XXHASH_64;
+
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeHash), CS_COMPUTE_TEST_CS_ComputeHashHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeEepromMemory(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ResultsEntry.ByteOffset, 6);
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_ComputeHashByteOffset, 4);
+    UtAssert_STUB_COUNT(CS_FinishHash, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_GetEepromMemorySubRange_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            SubRangeOffset = 0;
+    uint32                            SubRangeBytes  = 0;
+    uint32                            TotalBytes     = 0;
+    uint16                            SubRange;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = (CS_NUM_SUB_RANGES * 3) + 1;
+
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        /* Execute the function being tested */
+        CS_GetEepromMemorySubRange(&ResultsEntry, SubRange, &SubRangeOffset, &SubRangeBytes);
+
+        /* Verify results */
+        UtAssert_UINT32_EQ(SubRangeOffset, TotalBytes);
+        TotalBytes += SubRangeBytes;
+    }
+
+    UtAssert_UINT32_EQ(TotalBytes, ResultsEntry.NumBytesToChecksum);
+    UtAssert_UINT32_EQ(SubRangeBytes, ResultsEntry.NumBytesToChecksum - ((CS_NUM_SUB_RANGES - 1) * 4));
+}
+
+void CS_GetEepromMemorySubRange_Test_SmallEntry(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            SubRangeOffset = 0;
+    uint32                            SubRangeBytes  = 0;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = 1;
+
+    /* Execute the function being tested */
+    CS_GetEepromMemorySubRange(&ResultsEntry, 0, &SubRangeOffset, &SubRangeBytes);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SubRangeOffset, 0);
+    UtAssert_UINT32_EQ(SubRangeBytes, 1);
+
+    /* Execute the function being tested */
+    CS_GetEepromMemorySubRange(&ResultsEntry, CS_NUM_SUB_RANGES - 1, &SubRangeOffset, &SubRangeBytes);
+
+    /* Verify results: the last sub-range is empty unless there is only one */
+    UtAssert_UINT32_EQ(SubRangeOffset, (CS_NUM_SUB_RANGES > 1) ? 1 : 0);
+    UtAssert_UINT32_EQ(SubRangeBytes, (CS_NUM_SUB_RANGES > 1) ? 0 : 1);
+}
+
+void CS_MergeEepromMemorySubRanges_Test_NotAllComputed(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = true;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.SubRangeMask       = CS_ALL_SUB_RANGES_MASK & ~1u;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_MergeEepromMemorySubRanges(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+    UtAssert_BOOL_FALSE(ResultsEntry.ComputedYet);
+    UtAssert_STUB_COUNT(CS_CombineCRC, 0);
+}
+
+void CS_MergeEepromMemorySubRanges_Test_FirstTimeThrough(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+    uint32                            Expected        = 0;
+    uint16                            SubRange;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.SubRangeMask       = CS_ALL_SUB_RANGES_MASK;
+
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        ResultsEntry.SubRangeChecksum[SubRange] = SubRange + 1;
+        Expected                                = (Expected * 10) + SubRange + 1;
+    }
+
+    UT_SetHandlerFunction(UT_KEY(CS_CombineCRC), CS_COMPUTE_TEST_CS_CombineCRCHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_CombineCRC), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_MergeEepromMemorySubRanges(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ComputedCSValue, Expected);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, Expected);
+    UtAssert_STUB_COUNT(CS_CombineCRC, CS_NUM_SUB_RANGES - 1);
+
+    /* The sub-range checksums are kept for the next merge */
+    UtAssert_UINT32_EQ(ResultsEntry.SubRangeMask, CS_ALL_SUB_RANGES_MASK);
+}
+
+void CS_MergeEepromMemorySubRanges_Test_Error(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.SubRangeMask       = CS_ALL_SUB_RANGES_MASK;
+    ResultsEntry.ComputedYet        = true;
+    ResultsEntry.ComparisonValue    = 1;
+    ResultsEntry.SubRangeChecksum[0] = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CombineCRC), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_MergeEepromMemorySubRanges(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ComputedCSValue, 2);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 1);
+}
+
+void CS_MergeEepromMemorySubRanges_Test_CannotCombine(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = true;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.SubRangeMask       = CS_ALL_SUB_RANGES_MASK;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_CombineCRC), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_MergeEepromMemorySubRanges(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_True(DoneWithEntry == (CS_NUM_SUB_RANGES == 1), "DoneWithEntry == (CS_NUM_SUB_RANGES == 1)");
+    UtAssert_STUB_COUNT(CS_CombineCRC, (CS_NUM_SUB_RANGES > 1) ? 1 : 0);
+}
+
+void CS_SplitEepromMemory_Test_Split(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_SPLIT_RECOMPUTE_MIN_BYTES;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+
+    /* Execute the function being tested and verify results */
+    UtAssert_True(CS_SplitEepromMemory(CS_OSCORE, &ResultsEntry) == (CS_NUM_SUB_RANGES > 1),
+                  "CS_SplitEepromMemory(CS_OSCORE) == (CS_NUM_SUB_RANGES > 1)");
+    UtAssert_True(CS_SplitEepromMemory(CS_CFECORE, &ResultsEntry) == (CS_NUM_SUB_RANGES > 1),
+                  "CS_SplitEepromMemory(CS_CFECORE) == (CS_NUM_SUB_RANGES > 1)");
+    UtAssert_True(CS_SplitEepromMemory(CS_MEMORY_TABLE, &ResultsEntry) == (CS_NUM_SUB_RANGES > 1),
+                  "CS_SplitEepromMemory(CS_MEMORY_TABLE) == (CS_NUM_SUB_RANGES > 1)");
+}
+
+void CS_SplitEepromMemory_Test_NotSplit(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_SPLIT_RECOMPUTE_MIN_BYTES;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+
+    /* Execute the function being tested and verify results */
+    UtAssert_BOOL_FALSE(CS_SplitEepromMemory(CS_EEPROM_TABLE, &ResultsEntry));
+
+    ResultsEntry.Algorithm = CS_ALGORITHM_XXHASH_64;
+    UtAssert_BOOL_FALSE(CS_SplitEepromMemory(CS_OSCORE, &ResultsEntry));
+
+    ResultsEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+    ResultsEntry.NumBytesToChecksum = CS_SPLIT_RECOMPUTE_MIN_BYTES - 1;
+    UtAssert_BOOL_FALSE(CS_SplitEepromMemory(CS_MEMORY_TABLE, &ResultsEntry));
+}
+
+void CS_ChecksumEepromMemorySubRange_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint16                            SubRange = CS_NUM_SUB_RANGES - 1;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.StartAddress       = 0x1000;
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+
+    /* Each sub-range task gets 3 bytes a chunk, so the 8 byte sub-range takes 3 chunks */
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), CS_NUM_SUB_RANGES * 3);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeCRC), CS_COMPUTE_TEST_CS_ComputeCRCHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 7);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ChecksumEepromMemorySubRange(&ResultsEntry, SubRange), 7);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 3);
+    UtAssert_ADDRESS_EQ(CS_COMPUTE_TEST_ComputeCRCDataPtr, (void *)(cpuaddr)(0x1000 + (SubRange * 8) + 6));
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_ComputeCRCDataLength, 2);
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_ComputeCRCTypeCRC, CS_ALGORITHM_CRC_32C);
+
+    /* The entry itself is left alone */
+    UtAssert_UINT32_EQ(ResultsEntry.SubRangeMask, 0);
+}
+
+void CS_ChecksumEepromMemorySubRange_Test_SmallBudget(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+
+    /* A budget smaller than the number of sub-ranges still checksums a byte at a time */
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), CS_NUM_SUB_RANGES - 1);
+
+    /* Execute the function being tested */
+    CS_ChecksumEepromMemorySubRange(&ResultsEntry, 0);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 8);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 8);
+}
+
+void CS_ComputeEepromMemorySplit_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = false;
+    uint32                            Expected        = 0;
+    uint16                            SubRange;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum  = CS_NUM_SUB_RANGES * 8;
+    ResultsEntry.ComparisonValueHigh = 5;
+
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        Expected = (Expected * 10) + SubRange + 1;
+    }
+
+    UT_SetHandlerFunction(UT_KEY(CS_StartSubRangeTask), CS_COMPUTE_TEST_CS_StartSubRangeTaskHandler, &ResultsEntry);
+    UT_SetDeferredRetcode(UT_KEY(CS_SubRangesRunning), 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_CombineCRC), CS_COMPUTE_TEST_CS_CombineCRCHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_CombineCRC), true);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_ComputeEepromMemorySplit(1, &ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartSubRangeTask, CS_NUM_SUB_RANGES);
+    UtAssert_STUB_COUNT(CS_FinishSubRange, 0);
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ComputedCSValue, Expected);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, Expected);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValueHigh, 0);
+}
+
+void CS_ComputeEepromMemorySplit_Test_TaskNotStarted(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+    uint32                            ComputedCSValue = 0;
+    bool                              DoneWithEntry   = true;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_StartSubRangeTask), -1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), CS_NUM_SUB_RANGES * 8);
+
+    /* Execute the function being tested */
+    CS_ComputeEepromMemorySplit(1, &ResultsEntry, &ComputedCSValue, &DoneWithEntry);
+
+    /* Verify results: the worker checksums every sub-range itself */
+    UtAssert_STUB_COUNT(CS_StartSubRangeTask, CS_NUM_SUB_RANGES);
+    UtAssert_STUB_COUNT(CS_FinishSubRange, CS_NUM_SUB_RANGES);
+    UtAssert_STUB_COUNT(CS_ComputeCRC, CS_NUM_SUB_RANGES);
+
+    /* The stub recorded none of them, so nothing is merged */
+    UtAssert_BOOL_FALSE(DoneWithEntry);
+}
+
 void CS_ComputeTables_Test_TableNeverLoaded(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 0;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     char                        ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -218,7 +732,8 @@ void CS_ComputeTables_Test_TableNeverLoaded(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -235,6 +750,7 @@ void CS_ComputeTables_Test_TableNeverLoaded(void)
 void CS_ComputeTables_Test_TableUnregisteredAndNeverLoaded(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 0;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     char                        ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -258,7 +774,8 @@ void CS_ComputeTables_Test_TableUnregisteredAndNeverLoaded(void)
     UT_SetDeferredRetcode(UT_KEY(CS_AttemptTableReshare), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -279,6 +796,7 @@ void CS_ComputeTables_Test_TableUnregisteredAndNeverLoaded(void)
 void CS_ComputeTables_Test_ResultShareNotSuccess(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 0;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     char                        ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -303,7 +821,8 @@ void CS_ComputeTables_Test_ResultShareNotSuccess(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_UNREGISTERED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -322,6 +841,7 @@ void CS_ComputeTables_Test_ResultShareNotSuccess(void)
 void CS_ComputeTables_Test_TblInfoUpdated(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     CFE_TBL_Info_t              TblInfo;
@@ -330,7 +850,6 @@ void CS_ComputeTables_Test_TblInfoUpdated(void)
     memset(&TblInfo, 0, sizeof(TblInfo));
 
     ResultsEntry.TblHandle      = 99;
-    CS_AppData.MaxBytesPerCycle = 5;
 
     /* Sets TblInfo.Size = 5 and returns CFE_TBL_INFO_UPDATED */
     TblInfo.Size = 5;
@@ -343,7 +862,7 @@ void CS_ComputeTables_Test_TblInfoUpdated(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -362,6 +881,7 @@ void CS_ComputeTables_Test_TblInfoUpdated(void)
 void CS_ComputeTables_Test_GetInfoResult(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     CFE_TBL_Info_t              TblInfo;
@@ -371,8 +891,6 @@ void CS_ComputeTables_Test_GetInfoResult(void)
 
     ResultsEntry.TblHandle = 99;
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     /* Sets TblInfo.Size = 5 and returns CFE_TBL_INFO_UPDATED */
     TblInfo.Size = 5;
 
@@ -384,7 +902,7 @@ void CS_ComputeTables_Test_GetInfoResult(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -403,6 +921,7 @@ void CS_ComputeTables_Test_GetInfoResult(void)
 void CS_ComputeTables_Test_CSError(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = false;
     CFE_TBL_Info_t              TblInfo;
@@ -412,8 +931,6 @@ void CS_ComputeTables_Test_CSError(void)
 
     ResultsEntry.TblHandle = 99;
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 1;
@@ -428,10 +945,10 @@ void CS_ComputeTables_Test_CSError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -448,6 +965,7 @@ void CS_ComputeTables_Test_CSError(void)
 void CS_ComputeTables_Test_NominalBadTableHandle(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = false;
     CFE_TBL_Info_t              TblInfo;
@@ -457,8 +975,6 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
 
     ResultsEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
@@ -476,10 +992,10 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -498,6 +1014,7 @@ void CS_ComputeTables_Test_NominalBadTableHandle(void)
 void CS_ComputeTables_Test_FirstTimeThrough(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = false;
     CFE_TBL_Info_t              TblInfo;
@@ -507,8 +1024,6 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
 
     ResultsEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
@@ -526,10 +1041,10 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 3);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -549,9 +1064,52 @@ void CS_ComputeTables_Test_FirstTimeThrough(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void CS_ComputeTables_Test_HashFirstTimeThrough(void)
+{
+    CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 5;
+    uint32                      ComputedCSValue = 0;
+    bool                        DoneWithEntry   = false;
+    CFE_TBL_Info_t              TblInfo;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+    memset(&TblInfo, 0, sizeof(TblInfo));
+
+    ResultsEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    ResultsEntry.Algorithm = CS_ALGORITHM_XXHASH_64;
+
+    /* Sets ResultsEntry->TblHandle to 99 and returns CFE_SUCCESS */
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_Share), CS_COMPUTE_TEST_CFE_TBL_ShareHandler, NULL);
+
+    TblInfo.Size = 5;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetInfo), &TblInfo, sizeof(TblInfo), false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
+
+    CS_COMPUTE_TEST_FinishHashValue = 0x1122334455667788;
+    UT_SetHandlerFunction(UT_KEY(CS_FinishHash), CS_COMPUTE_TEST_CS_FinishHashHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+
+    UtAssert_BOOL_TRUE(ResultsEntry.ComputedYet);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValue, 0x55667788);
+    UtAssert_UINT32_EQ(ResultsEntry.ComparisonValueHigh, 0x11223344);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x55667788);
+
+    UtAssert_STUB_COUNT(CS_ComputeHash, 1);
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_ComputeTables_Test_EntryNotFinished(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 3;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     CFE_TBL_Info_t              TblInfo;
@@ -561,8 +1119,6 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
 
     ResultsEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    CS_AppData.MaxBytesPerCycle = 3;
-
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
@@ -580,10 +1136,10 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 3);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -603,6 +1159,7 @@ void CS_ComputeTables_Test_EntryNotFinished(void)
 void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 3;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     CFE_TBL_Info_t              TblInfo;
@@ -616,8 +1173,6 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
 
     ResultsEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
-    CS_AppData.MaxBytesPerCycle = 3;
-
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 2;
@@ -637,13 +1192,13 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
 
     /* Set to cause ResultsEntry->ComparisonValue to be set to 3 */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 3);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 3);
 
     /* Set to generate error message CS_COMPUTE_TABLES_RELEASE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_ReleaseAddress), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -669,6 +1224,7 @@ void CS_ComputeTables_Test_ComputeTablesReleaseError(void)
 void CS_ComputeTables_Test_ComputeTablesError(void)
 {
     CS_Res_Tables_Table_Entry_t ResultsEntry;
+    uint32                      BytesRemaining  = 0;
     uint32                      ComputedCSValue = 0;
     bool                        DoneWithEntry   = true;
     CFE_TBL_Info_t              TblInfo;
@@ -696,7 +1252,8 @@ void CS_ComputeTables_Test_ComputeTablesError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeTables(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -713,13 +1270,12 @@ void CS_ComputeTables_Test_ComputeTablesError(void)
 void CS_ComputeApp_Test_NominalApp(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 5;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
@@ -729,10 +1285,10 @@ void CS_ComputeApp_Test_NominalApp(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -750,13 +1306,12 @@ void CS_ComputeApp_Test_NominalApp(void)
 void CS_ComputeApp_Test_NominalLib(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 5;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 2;
@@ -769,10 +1324,10 @@ void CS_ComputeApp_Test_NominalLib(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -790,6 +1345,7 @@ void CS_ComputeApp_Test_NominalLib(void)
 void CS_ComputeApp_Test_GetAppAndLibIDByNameError(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 0;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = true;
     char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -809,7 +1365,8 @@ void CS_ComputeApp_Test_GetAppAndLibIDByNameError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetLibIDByName), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -826,6 +1383,7 @@ void CS_ComputeApp_Test_GetAppAndLibIDByNameError(void)
 void CS_ComputeApp_Test_GetModuleInfoError(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 0;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = true;
     char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -842,7 +1400,8 @@ void CS_ComputeApp_Test_GetModuleInfoError(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetModuleInfo), 1, -1);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -859,6 +1418,7 @@ void CS_ComputeApp_Test_GetModuleInfoError(void)
 void CS_ComputeApp_Test_ComputeAppPlatformError(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 0;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = true;
     char                     ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -878,7 +1438,8 @@ void CS_ComputeApp_Test_ComputeAppPlatformError(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler2, NULL);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERR_NOT_FOUND);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry),
+                       CS_ERR_NOT_FOUND);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -901,13 +1462,12 @@ void CS_ComputeApp_Test_ComputeAppPlatformError(void)
 void CS_ComputeApp_Test_DifferFromSavedValue(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 5;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 3;
@@ -917,10 +1477,10 @@ void CS_ComputeApp_Test_DifferFromSavedValue(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -934,13 +1494,12 @@ void CS_ComputeApp_Test_DifferFromSavedValue(void)
 void CS_ComputeApp_Test_FirstTimeThrough(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 5;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = false;
 
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
 
-    CS_AppData.MaxBytesPerCycle = 5;
-
     ResultsEntry.ComputedYet = false;
 
     ResultsEntry.ComparisonValue = 3;
@@ -950,10 +1509,10 @@ void CS_ComputeApp_Test_FirstTimeThrough(void)
     UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_TRUE(DoneWithEntry);
@@ -971,9 +1530,45 @@ void CS_ComputeApp_Test_FirstTimeThrough(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void CS_ComputeApp_Test_HashUpperHalfDiffers(void)
+{
+    CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 5;
+    uint32                   ComputedCSValue = 0;
+    bool                     DoneWithEntry   = false;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.Algorithm           = CS_ALGORITHM_FLETCHER_64;
+    ResultsEntry.ComputedYet         = true;
+    ResultsEntry.ComparisonValue     = 0x55667788;
+    ResultsEntry.ComparisonValueHigh = 0x11223344;
+
+    /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
+     * CFE_SUCCESS */
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
+
+    /* Only the upper half of the checksum differs from the saved value */
+    CS_COMPUTE_TEST_FinishHashValue = 0x0022334455667788;
+    UT_SetHandlerFunction(UT_KEY(CS_FinishHash), CS_COMPUTE_TEST_CS_FinishHashHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CS_ERROR);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(DoneWithEntry);
+    UtAssert_UINT32_EQ(ComputedCSValue, 0x55667788);
+
+    UtAssert_STUB_COUNT(CS_ComputeHash, 1);
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_ComputeApp_Test_EntryNotFinished(void)
 {
     CS_Res_App_Table_Entry_t ResultsEntry;
+    uint32                   BytesRemaining  = 3;
     uint32                   ComputedCSValue = 0;
     bool                     DoneWithEntry   = true;
     CFE_TBL_Info_t           TblInfo;
@@ -981,8 +1576,6 @@ void CS_ComputeApp_Test_EntryNotFinished(void)
     memset(&ResultsEntry, 0, sizeof(ResultsEntry));
     memset(&TblInfo, 0, sizeof(TblInfo));
 
-    CS_AppData.MaxBytesPerCycle = 3;
-
     ResultsEntry.ComputedYet = true;
 
     ResultsEntry.ComparisonValue = 3;
@@ -998,10 +1591,10 @@ void CS_ComputeApp_Test_EntryNotFinished(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), CFE_TBL_INFO_UPDATED);
 
     /* Set to fail condition "NewChecksumValue != ResultsEntry -> ComparisonValue" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 2);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 2);
 
     /* Execute the function being tested */
-    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CS_ComputeApp(&ResultsEntry, &BytesRemaining, &ComputedCSValue, &DoneWithEntry), CFE_SUCCESS);
 
     /* Verify results */
     UtAssert_BOOL_FALSE(DoneWithEntry);
@@ -1027,12 +1620,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTable(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefEepromTblPtr              = DefEepromTbl;
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_EEPROM_TABLE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
@@ -1040,25 +1633,25 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTable(void)
 
     DefEepromTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1081,12 +1674,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_MemoryTable(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefMemoryTblPtr              = DefMemoryTbl;
 
-    CS_AppData.ChildTaskTable = CS_MEMORY_TABLE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_MEMORY_TABLE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
@@ -1094,25 +1687,25 @@ void CS_RecomputeEepromMemoryChildTask_Test_MemoryTable(void)
 
     DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1135,12 +1728,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_CFECore(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefMemoryTblPtr              = DefMemoryTbl;
 
-    CS_AppData.ChildTaskTable = CS_CFECORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_CFECORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
@@ -1148,25 +1741,25 @@ void CS_RecomputeEepromMemoryChildTask_Test_CFECore(void)
 
     DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1191,12 +1784,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_OSCore(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefMemoryTblPtr               = DefMemoryTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefMemoryTblPtr              = DefMemoryTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefMemoryTblPtr[1].StartAddress = 1;
 
@@ -1204,25 +1797,25 @@ void CS_RecomputeEepromMemoryChildTask_Test_OSCore(void)
 
     DefMemoryTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefMemoryTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1235,6 +1828,89 @@ void CS_RecomputeEepromMemoryChildTask_Test_OSCore(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void CS_RecomputeEepromMemoryChildTask_Test_Split(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
+    uint32                            Expected = 0;
+    uint16                            SubRange;
+
+    memset(&RecomputeEepromMemoryEntry, 0, sizeof(RecomputeEepromMemoryEntry));
+
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.RecomputeWorkers[0].Table    = CS_OSCORE;
+
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = CS_SPLIT_RECOMPUTE_MIN_BYTES;
+    RecomputeEepromMemoryEntry.Algorithm          = CS_ALGORITHM_CRC_32C;
+
+    for (SubRange = 0; SubRange < CS_NUM_SUB_RANGES; SubRange++)
+    {
+        Expected = (Expected * 10) + SubRange + 1;
+    }
+
+    UT_SetHandlerFunction(UT_KEY(CS_StartSubRangeTask), CS_COMPUTE_TEST_CS_StartSubRangeTaskHandler,
+                          &RecomputeEepromMemoryEntry);
+    UT_SetHandlerFunction(UT_KEY(CS_CombineCRC), CS_COMPUTE_TEST_CS_CombineCRCHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_CombineCRC), true);
+
+    /* Execute the function being tested */
+    CS_RecomputeEepromMemoryChildTask();
+
+    /* Verify results: the merged sub-ranges become the baseline without checksumming in order */
+    UtAssert_STUB_COUNT(CS_StartSubRangeTask, (CS_NUM_SUB_RANGES > 1) ? CS_NUM_SUB_RANGES : 0);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
+
+    if (CS_NUM_SUB_RANGES > 1)
+    {
+        UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+        UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.OSBaseline, Expected);
+        UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ComparisonValue, Expected);
+    }
+
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void CS_SubRangeChildTask_Test_Nominal(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.StartAddress       = 0x1000;
+    ResultsEntry.NumBytesToChecksum = CS_NUM_SUB_RANGES * 8;
+
+    CS_AppData.RecomputeWorkers[CS_MAX_RECOMPUTE_WORKERS - 1].EntryPtr = &ResultsEntry;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_FindSubRangeTask), true);
+    UT_SetHandlerFunction(UT_KEY(CS_FindSubRangeTask), CS_COMPUTE_TEST_CS_FindSubRangeTaskHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), CS_NUM_SUB_RANGES * 8);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeCRC), CS_COMPUTE_TEST_CS_ComputeCRCHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_SubRangeChildTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 1);
+    UtAssert_ADDRESS_EQ(CS_COMPUTE_TEST_ComputeCRCDataPtr,
+                        (void *)(cpuaddr)(0x1000 + ((CS_NUM_SUB_RANGES - 1) * 8)));
+    UtAssert_STUB_COUNT(CS_FinishSubRange, 1);
+
+    /* The sub-range task stays, waiting for its next sub-range */
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
+}
+
+void CS_SubRangeChildTask_Test_NotFound(void)
+{
+    /* Execute the function being tested */
+    CS_SubRangeChildTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 0);
+    UtAssert_STUB_COUNT(CS_FinishSubRange, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
+}
+
 void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId(void)
 {
     CS_Res_EepromMemory_Table_Entry_t RecomputeEepromMemoryEntry;
@@ -1247,12 +1923,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefEepromTblPtr              = DefEepromTbl;
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_EEPROM_TABLE;
 
-    CS_AppData.ChildTaskEntryID = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
+    CS_AppData.RecomputeWorkers[0].EntryID = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
@@ -1260,24 +1936,24 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId(void)
 
     DefEepromTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1300,12 +1976,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefEepromTblPtr              = DefEepromTbl;
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_EEPROM_TABLE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
@@ -1313,25 +1989,25 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress(void)
 
     DefEepromTbl[1].State = 1;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1354,12 +2030,12 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "%%s entry %%d recompute finished. New baseline is 0X%%08X");
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr = &RecomputeEepromMemoryEntry;
-    CS_AppData.DefEepromTblPtr               = DefEepromTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeEepromMemoryEntry;
+    CS_AppData.DefEepromTblPtr              = DefEepromTbl;
 
-    CS_AppData.ChildTaskTable = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_EEPROM_TABLE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     CS_AppData.DefEepromTblPtr[1].StartAddress = 1;
 
@@ -1367,25 +2043,26 @@ void CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState(void)
 
     DefEepromTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                                  = 2;
+    RecomputeEepromMemoryEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
-    CS_AppData.RecomputeEepromMemoryEntryPtr->State = 99;
+    RecomputeEepromMemoryEntry.State = 99;
 
     /* Execute the function being tested */
     CS_RecomputeEepromMemoryChildTask();
 
     /* Verify results */
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeEepromMemoryEntryPtr->ComputedYet);
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeEepromMemoryEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeEepromMemoryEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeEepromMemoryEntry.ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeEepromMemoryEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefEepromTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, CS_STATE_EMPTY);
+    UtAssert_STUB_COUNT(CS_ResetRecomputeDefTableEntry, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_EEPROM_MEMORY_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1408,24 +2085,24 @@ void CS_RecomputeAppChildTask_Test_Nominal(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "App %%s recompute finished. New baseline is 0x%%08X");
 
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeAppEntry;
+    CS_AppData.DefAppTblPtr                 = DefAppTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     DefAppTbl[1].State = 1;
 
-    CS_AppData.RecomputeAppEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                         = 2;
+    RecomputeAppEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_APP_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    RecomputeAppEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(RecomputeAppEntry.Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
 
     /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
@@ -1436,11 +2113,11 @@ void CS_RecomputeAppChildTask_Test_Nominal(void)
     CS_RecomputeAppChildTask();
 
     /* Verify results */
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeAppEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefAppTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeAppEntry.ComputedYet);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_APP_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1448,7 +2125,7 @@ void CS_RecomputeAppChildTask_Test_Nominal(void)
     UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
                           CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
@@ -1461,19 +2138,19 @@ void CS_RecomputeAppChildTask_Test_CouldNotGetAddress(void)
     memset(&RecomputeAppEntry, 0, sizeof(RecomputeAppEntry));
     memset(&DefAppTbl, 0, sizeof(DefAppTbl));
 
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeAppEntry;
+    CS_AppData.DefAppTblPtr                 = DefAppTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     /* No matching non-empty state entry */
     DefAppTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    RecomputeAppEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(RecomputeAppEntry.Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
 
     /* Set to cause CS_ComputeApp to return CS_ERR_NOT_FOUND */
@@ -1488,13 +2165,13 @@ void CS_RecomputeAppChildTask_Test_CouldNotGetAddress(void)
     CS_RecomputeAppChildTask();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.ByteOffset, 0);
 
-    UtAssert_BOOL_FALSE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_FALSE(RecomputeAppEntry.ComputedYet);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_COMPUTE_APP_ERR_EID);
@@ -1515,22 +2192,22 @@ void CS_RecomputeAppChildTask_Test_DefEntryId(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "App %%s recompute finished. New baseline is 0x%%08X");
 
-    CS_AppData.RecomputeAppEntryPtr = &RecomputeAppEntry;
-    CS_AppData.DefAppTblPtr         = DefAppTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeAppEntry;
+    CS_AppData.DefAppTblPtr                 = DefAppTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
-    CS_AppData.RecomputeAppEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                         = 2;
+    RecomputeAppEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_APP_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
-    CS_AppData.RecomputeAppEntryPtr->State = 99;
+    RecomputeAppEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeAppEntryPtr->Name, "name", 10);
+    strncpy(RecomputeAppEntry.Name, "name", 10);
     strncpy(DefAppTbl[1].Name, "name", 10);
     DefAppTbl[1].State = CS_STATE_ENABLED;
 
@@ -1542,11 +2219,12 @@ void CS_RecomputeAppChildTask_Test_DefEntryId(void)
     CS_RecomputeAppChildTask();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_ENABLED);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeAppEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeAppEntryPtr->ComputedYet);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefAppTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, CS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CS_ResetRecomputeDefTableEntry, 2);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeAppEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeAppEntry.ComputedYet);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_APP_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1554,11 +2232,48 @@ void CS_RecomputeAppChildTask_Test_DefEntryId(void)
     UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
                           CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void CS_RecomputeAppChildTask_Test_DefEntryDisabled(void)
+{
+    CS_Res_App_Table_Entry_t RecomputeAppEntry;
+    CS_Def_App_Table_Entry_t DefAppTbl[10];
+
+    memset(&RecomputeAppEntry, 0, sizeof(RecomputeAppEntry));
+    memset(&DefAppTbl, 0, sizeof(DefAppTbl));
+
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeAppEntry;
+    CS_AppData.RecomputeWorkers[0].Table    = CS_APP_TABLE;
+    CS_AppData.RecomputeWorkers[0].EntryID  = 1;
+    CS_AppData.DefAppTblPtr                 = DefAppTbl;
+
+    RecomputeAppEntry.NumBytesToChecksum = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 2);
+
+    strncpy(RecomputeAppEntry.Name, "name", 10);
+    strncpy(DefAppTbl[1].Name, "name", 10);
+    DefAppTbl[1].State = CS_STATE_ENABLED;
+
+    /* The entry is disabled by command while it is recomputed */
+    UT_SetHookFunction(UT_KEY(CS_GetBytesPerCycle), CS_COMPUTE_TEST_CS_GetBytesPerCycleHook, &DefAppTbl[1]);
+
+    /* Sets AppInfo.CodeSize = 5, sets AppInfo.CodeAddress = 1, AppInfo.AddressesAreValid = true, and returns
+     * CFE_SUCCESS */
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_GetModuleInfo), CS_COMPUTE_TEST_CFE_ES_GetModuleInfoHandler1, NULL);
+
+    /* Execute the function being tested */
+    CS_RecomputeAppChildTask();
+
+    /* Verify results, the command is not undone when the recompute finishes */
+    UtAssert_UINT32_EQ(DefAppTbl[1].State, CS_STATE_DISABLED);
+    UtAssert_BOOL_TRUE(RecomputeAppEntry.ComputedYet);
+    UtAssert_STUB_COUNT(CS_ResetRecomputeDefTableEntry, 2);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
+}
+
 void CS_RecomputeTablesChildTask_Test_Nominal(void)
 {
     CS_Res_Tables_Table_Entry_t RecomputeTablesEntry;
@@ -1572,30 +2287,29 @@ void CS_RecomputeTablesChildTask_Test_Nominal(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Table %%s recompute finished. New baseline is 0x%%08X");
 
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeTablesEntry;
+    CS_AppData.DefTablesTblPtr              = DefTablesTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     DefTablesTbl[1].State = 1;
 
-    CS_AppData.RecomputeTablesEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                            = 2;
+    RecomputeTablesEntry.NumBytesToChecksum = 1;
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_TABLES_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
+    RecomputeTablesEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(RecomputeTablesEntry.Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
 
     RecomputeTablesEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
     RecomputeTablesEntry.ByteOffset = 0;
-    CS_AppData.MaxBytesPerCycle     = 5;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 5);
 
     RecomputeTablesEntry.ComputedYet = true;
 
@@ -1617,11 +2331,11 @@ void CS_RecomputeTablesChildTask_Test_Nominal(void)
     CS_RecomputeTablesChildTask();
 
     /* Verify results */
-    UtAssert_UINT16_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT16_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, 1);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
+    UtAssert_UINT16_EQ(RecomputeTablesEntry.State, 99);
+    UtAssert_UINT16_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, 1);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeTablesEntry.ComputedYet);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_TABLES_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1629,7 +2343,7 @@ void CS_RecomputeTablesChildTask_Test_Nominal(void)
     UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
                           CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
@@ -1642,19 +2356,19 @@ void CS_RecomputeTablesChildTask_Test_CouldNotGetAddress(void)
     memset(&RecomputeTablesEntry, 0, sizeof(RecomputeTablesEntry));
     memset(&DefTablesTbl, 0, sizeof(DefTablesTbl));
 
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeTablesEntry;
+    CS_AppData.DefTablesTblPtr              = DefTablesTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
     /* No matching non-empty state entry */
     DefTablesTbl[1].State = CS_STATE_EMPTY;
 
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
+    RecomputeTablesEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(RecomputeTablesEntry.Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
 
     /* Set to make CS_ComputeTables return CS_ERR_NOT_FOUND */
@@ -1666,13 +2380,13 @@ void CS_RecomputeTablesChildTask_Test_CouldNotGetAddress(void)
     CS_RecomputeTablesChildTask();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_EMPTY);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, CS_STATE_EMPTY);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.ByteOffset, 0);
 
-    UtAssert_BOOL_FALSE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_BOOL_FALSE(RecomputeTablesEntry.ComputedYet);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_RECOMPUTE_ERROR_TABLES_ERR_EID);
@@ -1694,29 +2408,28 @@ void CS_RecomputeTablesChildTask_Test_DefEntryId(void)
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Table %%s recompute finished. New baseline is 0x%%08X");
 
-    CS_AppData.RecomputeTablesEntryPtr = &RecomputeTablesEntry;
-    CS_AppData.DefTablesTblPtr         = DefTablesTbl;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &RecomputeTablesEntry;
+    CS_AppData.DefTablesTblPtr              = DefTablesTbl;
 
-    CS_AppData.ChildTaskTable = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].Table = CS_OSCORE;
 
-    CS_AppData.ChildTaskEntryID = 1;
+    CS_AppData.RecomputeWorkers[0].EntryID = 1;
 
-    CS_AppData.RecomputeTablesEntryPtr->NumBytesToChecksum = 1;
-    CS_AppData.MaxBytesPerCycle                            = 2;
+    RecomputeTablesEntry.NumBytesToChecksum = 1;
 
     /* Set to a value, which will be printed in message CS_RECOMPUTE_FINISH_TABLES_INF_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(CS_ComputeCRC), 1);
 
-    CS_AppData.RecomputeTablesEntryPtr->State = 99;
+    RecomputeTablesEntry.State = 99;
 
-    strncpy(CS_AppData.RecomputeTablesEntryPtr->Name, "name", 10);
+    strncpy(RecomputeTablesEntry.Name, "name", 10);
     strncpy(DefTablesTbl[1].Name, "name", 10);
     DefTablesTbl[1].State = CS_STATE_ENABLED;
 
     RecomputeTablesEntry.TblHandle = CFE_TBL_BAD_TABLE_HANDLE;
 
     RecomputeTablesEntry.ByteOffset = 0;
-    CS_AppData.MaxBytesPerCycle     = 5;
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetBytesPerCycle), 5);
 
     RecomputeTablesEntry.ComputedYet = true;
 
@@ -1738,11 +2451,12 @@ void CS_RecomputeTablesChildTask_Test_DefEntryId(void)
     CS_RecomputeTablesChildTask();
 
     /* Verify results */
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->State, 99);
-    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.ChildTaskEntryID].State, CS_STATE_ENABLED);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->TempChecksumValue, 0);
-    UtAssert_UINT32_EQ(CS_AppData.RecomputeTablesEntryPtr->ByteOffset, 0);
-    UtAssert_BOOL_TRUE(CS_AppData.RecomputeTablesEntryPtr->ComputedYet);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.State, 99);
+    UtAssert_UINT32_EQ(CS_AppData.DefTablesTblPtr[CS_AppData.RecomputeWorkers[0].EntryID].State, CS_STATE_ENABLED);
+    UtAssert_STUB_COUNT(CS_ResetRecomputeDefTableEntry, 2);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.TempChecksumValue, 0);
+    UtAssert_UINT32_EQ(RecomputeTablesEntry.ByteOffset, 0);
+    UtAssert_BOOL_TRUE(RecomputeTablesEntry.ComputedYet);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_FINISH_TABLES_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
@@ -1750,11 +2464,53 @@ void CS_RecomputeTablesChildTask_Test_DefEntryId(void)
     UtAssert_STRINGBUF_EQ(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, context_CFE_EVS_SendEvent[0].Spec,
                           CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void CS_RecomputeEepromMemoryChildTask_Test_NoWorker(void)
+{
+    /* The task was not started for a worker slot */
+    UT_SetDeferredRetcode(UT_KEY(CS_FindRecomputeWorker), 1, CS_MAX_RECOMPUTE_WORKERS);
+
+    /* Execute the function being tested */
+    CS_RecomputeEepromMemoryChildTask();
+
+    /* Verify results, the worker task carries on waiting for work */
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_RecomputeAppChildTask_Test_NoWorker(void)
+{
+    /* The task was not started for a worker slot */
+    UT_SetDeferredRetcode(UT_KEY(CS_FindRecomputeWorker), 1, CS_MAX_RECOMPUTE_WORKERS);
+
+    /* Execute the function being tested */
+    CS_RecomputeAppChildTask();
+
+    /* Verify results, the worker task carries on waiting for work */
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_RecomputeTablesChildTask_Test_NoWorker(void)
+{
+    /* The task was not started for a worker slot */
+    UT_SetDeferredRetcode(UT_KEY(CS_FindRecomputeWorker), 1, CS_MAX_RECOMPUTE_WORKERS);
+
+    /* Execute the function being tested */
+    CS_RecomputeTablesChildTask();
+
+    /* Verify results, the worker task carries on waiting for work */
+    UtAssert_STUB_COUNT(CS_ReleaseRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_OneShotChildTask_Test_Nominal(void)
 {
     char ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -1763,7 +2519,7 @@ void CS_OneShotChildTask_Test_Nominal(void)
              "OneShot checksum on Address: 0x%%08X, size %%d completed. Checksum =  0x%%08X");
 
     /* NewChecksumValue will be set to value returned by this function */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CalculateCRC), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeCRC), 1, 1);
 
     CS_AppData.HkPacket.Payload.LastOneShotAddress          = 0;
     CS_AppData.HkPacket.Payload.LastOneShotSize             = 1;
@@ -1784,11 +2540,56 @@ void CS_OneShotChildTask_Test_Nominal(void)
 
     UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
     UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
-    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.ChildTaskID));
+    UtAssert_BOOL_FALSE(CS_AppData.OneShotCancelled);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 0);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void CS_OneShotChildTask_Test_Cancelled(void)
+{
+    CS_AppData.HkPacket.Payload.LastOneShotAddress          = 0;
+    CS_AppData.HkPacket.Payload.LastOneShotSize             = 4;
+    CS_AppData.HkPacket.Payload.LastOneShotChecksum         = 5;
+    CS_AppData.HkPacket.Payload.LastOneShotMaxBytesPerCycle = 1;
+    CS_AppData.HkPacket.Payload.OneShotInProgress           = true;
+
+    /* The cancel command arrives while the one shot waits between chunks */
+    UT_SetHandlerFunction(UT_KEY(OS_TaskDelay), CS_COMPUTE_TEST_OS_TaskDelayCancelHandler, NULL);
+
+    /* Execute the function being tested */
+    CS_OneShotChildTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_ComputeCRC, 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.LastOneShotChecksum, 5);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.OneShotInProgress);
+    UtAssert_BOOL_FALSE(CS_AppData.OneShotCancelled);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_WorkerTask_Test(void)
+{
+    CFE_ES_ChildTaskMainFuncPtr_t WorkFunc[2] = {CS_COMPUTE_TEST_WorkFunc, NULL};
+    osal_id_t                     QueueID     = OS_ObjectIdFromInteger(3);
+
+    CS_COMPUTE_TEST_WorkFuncCount = 0;
+
+    UT_SetDataBuffer(UT_KEY(CS_FindWorkerQueue), &QueueID, sizeof(QueueID), false);
+    UT_SetDataBuffer(UT_KEY(OS_QueueGet), WorkFunc, sizeof(WorkFunc), false);
+
+    /* Two work items are taken, the second is empty and skipped, then the queue goes away */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 3, OS_ERROR);
+
+    /* Execute the function being tested */
+    CS_WorkerTask();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_QueueGet, 3);
+    UtAssert_UINT32_EQ(CS_COMPUTE_TEST_WorkFuncCount, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_ComputeEepromMemory_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
@@ -1799,6 +2600,39 @@ void UtTest_Setup(void)
     UtTest_Add(CS_ComputeEepromMemory_Test_NotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeEepromMemory_Test_NotFinished");
 
+    UtTest_Add(CS_ComputeEepromMemory_Test_EntryAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_EntryAlgorithm");
+    UtTest_Add(CS_ComputeEepromMemory_Test_HashFirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_HashFirstTimeThrough");
+    UtTest_Add(CS_ComputeEepromMemory_Test_HashUpperHalfDiffers, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_HashUpperHalfDiffers");
+    UtTest_Add(CS_ComputeEepromMemory_Test_HashNotFinished, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemory_Test_HashNotFinished");
+    UtTest_Add(CS_GetEepromMemorySubRange_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetEepromMemorySubRange_Test_Nominal");
+    UtTest_Add(CS_GetEepromMemorySubRange_Test_SmallEntry, CS_Test_Setup, CS_Test_TearDown,
+               "CS_GetEepromMemorySubRange_Test_SmallEntry");
+    UtTest_Add(CS_MergeEepromMemorySubRanges_Test_NotAllComputed, CS_Test_Setup, CS_Test_TearDown,
+               "CS_MergeEepromMemorySubRanges_Test_NotAllComputed");
+    UtTest_Add(CS_MergeEepromMemorySubRanges_Test_FirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
+               "CS_MergeEepromMemorySubRanges_Test_FirstTimeThrough");
+    UtTest_Add(CS_MergeEepromMemorySubRanges_Test_Error, CS_Test_Setup, CS_Test_TearDown,
+               "CS_MergeEepromMemorySubRanges_Test_Error");
+    UtTest_Add(CS_MergeEepromMemorySubRanges_Test_CannotCombine, CS_Test_Setup, CS_Test_TearDown,
+               "CS_MergeEepromMemorySubRanges_Test_CannotCombine");
+
+    UtTest_Add(CS_SplitEepromMemory_Test_Split, CS_Test_Setup, CS_Test_TearDown, "CS_SplitEepromMemory_Test_Split");
+    UtTest_Add(CS_SplitEepromMemory_Test_NotSplit, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SplitEepromMemory_Test_NotSplit");
+    UtTest_Add(CS_ChecksumEepromMemorySubRange_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumEepromMemorySubRange_Test_Nominal");
+    UtTest_Add(CS_ChecksumEepromMemorySubRange_Test_SmallBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ChecksumEepromMemorySubRange_Test_SmallBudget");
+    UtTest_Add(CS_ComputeEepromMemorySplit_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemorySplit_Test_Nominal");
+    UtTest_Add(CS_ComputeEepromMemorySplit_Test_TaskNotStarted, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeEepromMemorySplit_Test_TaskNotStarted");
+
     UtTest_Add(CS_ComputeTables_Test_TableNeverLoaded, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_TableNeverLoaded");
     UtTest_Add(CS_ComputeTables_Test_TableUnregisteredAndNeverLoaded, CS_Test_Setup, CS_Test_TearDown,
@@ -1814,6 +2648,8 @@ void UtTest_Setup(void)
                "CS_ComputeTables_Test_NominalBadTableHandle");
     UtTest_Add(CS_ComputeTables_Test_FirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_FirstTimeThrough");
+    UtTest_Add(CS_ComputeTables_Test_HashFirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeTables_Test_HashFirstTimeThrough");
     UtTest_Add(CS_ComputeTables_Test_EntryNotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeTables_Test_EntryNotFinished");
     UtTest_Add(CS_ComputeTables_Test_ComputeTablesReleaseError, CS_Test_Setup, CS_Test_TearDown,
@@ -1833,6 +2669,8 @@ void UtTest_Setup(void)
                "CS_ComputeApp_Test_DifferFromSavedValue");
     UtTest_Add(CS_ComputeApp_Test_FirstTimeThrough, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeApp_Test_FirstTimeThrough");
+    UtTest_Add(CS_ComputeApp_Test_HashUpperHalfDiffers, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeApp_Test_HashUpperHalfDiffers");
     UtTest_Add(CS_ComputeApp_Test_EntryNotFinished, CS_Test_Setup, CS_Test_TearDown,
                "CS_ComputeApp_Test_EntryNotFinished");
 
@@ -1844,6 +2682,8 @@ void UtTest_Setup(void)
                "CS_RecomputeEepromMemoryChildTask_Test_CFECore");
     UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_OSCore, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeEepromMemoryChildTask_Test_OSCore");
+    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_Split, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemoryChildTask_Test_Split");
     UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableEntryId");
     UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableStartAddress, CS_Test_Setup, CS_Test_TearDown,
@@ -1851,12 +2691,19 @@ void UtTest_Setup(void)
     UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeEepromMemoryChildTask_Test_EEPROMTableState");
 
+    UtTest_Add(CS_SubRangeChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SubRangeChildTask_Test_Nominal");
+    UtTest_Add(CS_SubRangeChildTask_Test_NotFound, CS_Test_Setup, CS_Test_TearDown,
+               "CS_SubRangeChildTask_Test_NotFound");
+
     UtTest_Add(CS_RecomputeAppChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeAppChildTask_Test_Nominal");
     UtTest_Add(CS_RecomputeAppChildTask_Test_CouldNotGetAddress, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeAppChildTask_Test_CouldNotGetAddress");
     UtTest_Add(CS_RecomputeAppChildTask_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeAppChildTask_Test_DefEntryId");
+    UtTest_Add(CS_RecomputeAppChildTask_Test_DefEntryDisabled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeAppChildTask_Test_DefEntryDisabled");
 
     UtTest_Add(CS_RecomputeTablesChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeTablesChildTask_Test_Nominal");
@@ -1864,6 +2711,15 @@ void UtTest_Setup(void)
                "CS_RecomputeTablesChildTask_Test_CouldNotGetAddress");
     UtTest_Add(CS_RecomputeTablesChildTask_Test_DefEntryId, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeTablesChildTask_Test_DefEntryId");
+    UtTest_Add(CS_RecomputeEepromMemoryChildTask_Test_NoWorker, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeEepromMemoryChildTask_Test_NoWorker");
+    UtTest_Add(CS_RecomputeAppChildTask_Test_NoWorker, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeAppChildTask_Test_NoWorker");
+    UtTest_Add(CS_RecomputeTablesChildTask_Test_NoWorker, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeTablesChildTask_Test_NoWorker");
 
     UtTest_Add(CS_OneShotChildTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown, "CS_OneShotChildTask_Test_Nominal");
+    UtTest_Add(CS_OneShotChildTask_Test_Cancelled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_OneShotChildTask_Test_Cancelled");
+    UtTest_Add(CS_WorkerTask_Test, CS_Test_Setup, CS_Test_TearDown, "CS_WorkerTask_Test");
 }
@@ -0,0 +1,828 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_crc.h"
+#include "cs_msgdefs.h"
+#include "cs_test_utils.h"
+#include <unistd.h>
+#include <stdlib.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* cs_crc_tests globals */
+static const char CS_CRC_TEST_CHECK_STRING[] = "123456789";
+
+/* Check values for the standard "123456789" test string */
+#define CS_CRC_TEST_CRC16_CHECK  0xFFFFBB3D /* 0xBB3D, sign extended like CFE_ES_CalculateCRC */
+#define CS_CRC_TEST_CRC32_CHECK  0xCBF43926
+#define CS_CRC_TEST_CRC32C_CHECK 0xE3069283
+
+#define CS_CRC_TEST_BUFFER_SIZE 256
+
+/* Large enough to cross the folding threshold several times over */
+#define CS_CRC_TEST_FOLD_BUFFER_SIZE (CS_CRC_FOLD_MIN_BYTES * 4 + 16)
+
+/* Large enough to be split into interleaved sub-blocks several times over */
+#define CS_CRC_TEST_INTERLEAVE_BUFFER_SIZE (CS_CRC_INTERLEAVE_MIN_BYTES * 3 + 64)
+
+/* Microsecond times returned by successive calls to OS_GetLocalTime */
+static const uint32 *CS_CRC_TEST_LocalTimes;
+
+/*
+ * Function Definitions
+ */
+
+void CS_CRC_TEST_OS_GetLocalTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_time_t *TimePtr = UT_Hook_GetArgValueByName(Context, "time_struct", OS_time_t *);
+    uint32     Call    = UT_GetStubCount(FuncKey) - 1;
+
+    *TimePtr = OS_TimeAssembleFromMicroseconds(0, CS_CRC_TEST_LocalTimes[Call]);
+}
+
+/* Bit at a time reference implementations to check the sliced kernels against */
+uint32 CS_CRC_Test_ReferenceCRC16(const uint8 *BufPtr, size_t DataLength, uint32 InputCRC)
+{
+    uint32 Crc = InputCRC & 0xFFFF;
+    uint32 Bit;
+
+    while (DataLength-- > 0)
+    {
+        Crc ^= *BufPtr++;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ 0xA001) : (Crc >> 1);
+        }
+    }
+
+    return (uint32)(int32)(int16)Crc;
+}
+
+uint32 CS_CRC_Test_ReferenceCRC32(const uint8 *BufPtr, size_t DataLength, uint32 InputCRC, uint32 Poly)
+{
+    uint32 Crc = ~InputCRC;
+    uint32 Bit;
+
+    while (DataLength-- > 0)
+    {
+        Crc ^= *BufPtr++;
+
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+        }
+    }
+
+    return ~Crc;
+}
+
+void CS_CRC_TEST_CFE_ES_CalculateCRCHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const uint8 *DataPtr    = UT_Hook_GetArgValueByName(Context, "DataPtr", const uint8 *);
+    size_t       DataLength = UT_Hook_GetArgValueByName(Context, "DataLength", size_t);
+    uint32       InputCRC   = UT_Hook_GetArgValueByName(Context, "InputCRC", uint32);
+    uint32       Crc        = CS_CRC_Test_ReferenceCRC16(DataPtr, DataLength, InputCRC);
+
+    UT_Stub_SetReturnValue(FuncKey, Crc);
+}
+
+void CS_CRC_Test_FillBuffer(uint8 *Buffer, size_t Size)
+{
+    size_t i;
+
+    for (i = 0; i < Size; i++)
+    {
+        Buffer[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+}
+
+void CS_ComputeCRC_Test_BeforeInit(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_16),
+        CS_CRC_TEST_CRC16_CHECK);
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32),
+        CS_CRC_TEST_CRC32_CHECK);
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CS_ALGORITHM_CRC_32C),
+        CS_CRC_TEST_CRC32C_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void CS_ComputeCRC_Test_CRC16CheckValue(void)
+{
+    uint32 Result;
+
+    CS_InitCRC();
+
+    /* Execute the function being tested */
+    Result = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_16);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, CS_CRC_TEST_CRC16_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void CS_ComputeCRC_Test_CRC16MatchesReference(void)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE + CS_CRC_SLICE_BYTES];
+    size_t Offset;
+    size_t Length;
+    uint32 MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    /* Cover every alignment and every tail length of the sliced loop */
+    for (Offset = 0; Offset < CS_CRC_SLICE_BYTES; Offset++)
+    {
+        for (Length = 0; Length <= CS_CRC_TEST_BUFFER_SIZE; Length++)
+        {
+            if (CS_ComputeCRC(&Buffer[Offset], Length, 0x1234, CFE_ES_CrcType_CRC_16) !=
+                CS_CRC_Test_ReferenceCRC16(&Buffer[Offset], Length, 0x1234))
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+void CS_ComputeCRC_Test_CRC16Chained(void)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE];
+    uint32 Expected;
+    uint32 Result;
+    size_t Split;
+    uint32 MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    Expected = CS_ComputeCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_16);
+
+    /* A sign extended partial result must chain the same as the whole block */
+    for (Split = 0; Split <= sizeof(Buffer); Split++)
+    {
+        Result = CS_ComputeCRC(Buffer, Split, 0, CFE_ES_CrcType_CRC_16);
+        Result = CS_ComputeCRC(&Buffer[Split], sizeof(Buffer) - Split, Result, CFE_ES_CrcType_CRC_16);
+
+        if (Result != Expected)
+        {
+            MismatchCount++;
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+void CS_ComputeCRC_Test_CRC32CheckValue(void)
+{
+    uint32 Result;
+
+    CS_InitCRC();
+
+    /* Execute the function being tested */
+    Result = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, CS_CRC_TEST_CRC32_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void CS_ComputeCRC_Test_CRC32MatchesReference(void)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE + CS_CRC_SLICE_BYTES];
+    size_t Offset;
+    size_t Length;
+    uint32 MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    for (Offset = 0; Offset < CS_CRC_SLICE_BYTES; Offset++)
+    {
+        for (Length = 0; Length <= CS_CRC_TEST_BUFFER_SIZE; Length++)
+        {
+            if (CS_ComputeCRC(&Buffer[Offset], Length, 0x89ABCDEF, CFE_ES_CrcType_CRC_32) !=
+                CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, 0x89ABCDEF, 0xEDB88320))
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+void CS_ComputeCRC_Test_CRC32Chained(void)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE];
+    uint32 Expected;
+    uint32 Result;
+    size_t Split;
+    uint32 MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    Expected = CS_ComputeCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_32);
+
+    for (Split = 0; Split <= sizeof(Buffer); Split++)
+    {
+        Result = CS_ComputeCRC(Buffer, Split, 0, CFE_ES_CrcType_CRC_32);
+        Result = CS_ComputeCRC(&Buffer[Split], sizeof(Buffer) - Split, Result, CFE_ES_CrcType_CRC_32);
+
+        if (Result != Expected)
+        {
+            MismatchCount++;
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+uint32 CS_CRC_Test_CRC32CMismatches(void)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE + CS_CRC_SLICE_BYTES];
+    size_t Offset;
+    size_t Length;
+    uint32 Result;
+    uint32 MismatchCount = 0;
+
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    for (Offset = 0; Offset < CS_CRC_SLICE_BYTES; Offset++)
+    {
+        for (Length = 0; Length <= CS_CRC_TEST_BUFFER_SIZE; Length++)
+        {
+            if (CS_ComputeCRC(&Buffer[Offset], Length, 0x89ABCDEF, CS_ALGORITHM_CRC_32C) !=
+                CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, 0x89ABCDEF, 0x82F63B78))
+            {
+                MismatchCount++;
+            }
+
+            /* Chained halves must match the whole block */
+            Result = CS_ComputeCRC(&Buffer[Offset], Length / 2, 0, CS_ALGORITHM_CRC_32C);
+            Result = CS_ComputeCRC(&Buffer[Offset + Length / 2], Length - Length / 2, Result, CS_ALGORITHM_CRC_32C);
+
+            if (Result != CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, 0, 0x82F63B78))
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    return MismatchCount;
+}
+
+void CS_ComputeCRC_Test_CRC32CCheckValue(void)
+{
+    uint32 Result;
+
+    CS_InitCRC();
+
+    /* Execute the function being tested */
+    Result = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CS_ALGORITHM_CRC_32C);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, CS_CRC_TEST_CRC32C_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+}
+
+void CS_ComputeCRC_Test_CRC32CTableKernel(void)
+{
+    CS_InitCRC();
+
+    UtAssert_BOOL_FALSE(CS_SelectCRCHardware(false));
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_CRC32CMismatches(), 0);
+}
+
+void CS_ComputeCRC_Test_CRC32CHardwareKernel(void)
+{
+    CS_InitCRC();
+
+    /* Hardware can only be selected where the processor supports it */
+    UtAssert_True(CS_SelectCRCHardware(true) == CS_CRCHardwareSupported(),
+                  "CS_SelectCRCHardware(true) == CS_CRCHardwareSupported()");
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_CRC32CMismatches(), 0);
+}
+
+void CS_ComputeCRC_Test_CRC32HardwareKernel(void)
+{
+    uint32 Result;
+
+    CS_InitCRC();
+    CS_SelectCRCHardware(true);
+
+    /* Execute the function being tested */
+    Result = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, CS_CRC_TEST_CRC32_CHECK);
+}
+
+void CS_ComputeCRC_Test_CRC32FoldMatchesReference(void)
+{
+    static uint8 Buffer[CS_CRC_TEST_FOLD_BUFFER_SIZE + 16];
+    size_t       Offset;
+    size_t       Length;
+    uint32       MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_SelectCRCHardware(true);
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    /* Every length around the threshold, at every alignment within a fold block */
+    for (Offset = 0; Offset < 16; Offset++)
+    {
+        for (Length = CS_CRC_FOLD_MIN_BYTES - 16; Length <= CS_CRC_TEST_FOLD_BUFFER_SIZE; Length++)
+        {
+            if (CS_ComputeCRC(&Buffer[Offset], Length, 0x01234567, CFE_ES_CrcType_CRC_32) !=
+                CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, 0x01234567, 0xEDB88320))
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+void CS_ComputeCRC_Test_CRC32FoldChunkBoundaries(void)
+{
+    static uint8 Buffer[CS_CRC_TEST_FOLD_BUFFER_SIZE];
+    uint32       Expected;
+    uint32       Result;
+    size_t       ChunkSize;
+    size_t       Offset;
+    size_t       Length;
+    uint32       MismatchCount = 0;
+
+    CS_InitCRC();
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    CS_SelectCRCHardware(false);
+    Expected = CS_ComputeCRC(Buffer, sizeof(Buffer), 0, CFE_ES_CrcType_CRC_32);
+
+    CS_SelectCRCHardware(true);
+
+    /* Background checks split an entry into chunks of any size up to the bytes per cycle limit */
+    for (ChunkSize = 1; ChunkSize <= sizeof(Buffer); ChunkSize++)
+    {
+        Result = 0;
+
+        for (Offset = 0; Offset < sizeof(Buffer); Offset += Length)
+        {
+            Length = sizeof(Buffer) - Offset;
+
+            if (Length > ChunkSize)
+            {
+                Length = ChunkSize;
+            }
+
+            Result = CS_ComputeCRC(&Buffer[Offset], Length, Result, CFE_ES_CrcType_CRC_32);
+        }
+
+        if (Result != Expected)
+        {
+            MismatchCount++;
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+/* Number of lengths and alignments around the interleave threshold that do not match the reference */
+uint32 CS_CRC_Test_InterleaveMismatches(uint32 TypeCRC, uint32 InputCRC)
+{
+    static uint8 Buffer[CS_CRC_TEST_INTERLEAVE_BUFFER_SIZE + CS_CRC_SLICE_BYTES];
+    size_t       Offset;
+    size_t       Length;
+    uint32       Expected;
+    uint32       MismatchCount = 0;
+
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    for (Offset = 0; Offset < CS_CRC_SLICE_BYTES; Offset++)
+    {
+        /* Every remainder after the sub-blocks, just below and above the threshold, then much larger */
+        for (Length = CS_CRC_INTERLEAVE_MIN_BYTES - 1; Length <= CS_CRC_TEST_INTERLEAVE_BUFFER_SIZE;
+             Length += (Length < (CS_CRC_INTERLEAVE_MIN_BYTES + (2 * CS_CRC_LANES * CS_CRC_SLICE_BYTES))) ? 1 : 509)
+        {
+            if (TypeCRC == CFE_ES_CrcType_CRC_16)
+            {
+                Expected = CS_CRC_Test_ReferenceCRC16(&Buffer[Offset], Length, InputCRC);
+            }
+            else if (TypeCRC == CFE_ES_CrcType_CRC_32)
+            {
+                Expected = CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, InputCRC, 0xEDB88320);
+            }
+            else
+            {
+                Expected = CS_CRC_Test_ReferenceCRC32(&Buffer[Offset], Length, InputCRC, 0x82F63B78);
+            }
+
+            if (CS_ComputeCRC(&Buffer[Offset], Length, InputCRC, TypeCRC) != Expected)
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    return MismatchCount;
+}
+
+void CS_ComputeCRC_Test_CRC16Interleaved(void)
+{
+    CS_InitCRC();
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_InterleaveMismatches(CFE_ES_CrcType_CRC_16, 0x1234), 0);
+}
+
+void CS_ComputeCRC_Test_CRC32Interleaved(void)
+{
+    CS_InitCRC();
+
+    /* Folding takes over from the table-driven kernel on processors that support it */
+    CS_SelectCRCHardware(false);
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_InterleaveMismatches(CFE_ES_CrcType_CRC_32, 0x89ABCDEF), 0);
+}
+
+void CS_ComputeCRC_Test_CRC32CInterleaved(void)
+{
+    CS_InitCRC();
+
+    /* Execute the function being tested and verify results */
+    CS_SelectCRCHardware(false);
+    UtAssert_UINT32_EQ(CS_CRC_Test_InterleaveMismatches(CS_ALGORITHM_CRC_32C, 0x89ABCDEF), 0);
+
+    CS_SelectCRCHardware(true);
+    UtAssert_UINT32_EQ(CS_CRC_Test_InterleaveMismatches(CS_ALGORITHM_CRC_32C, 0x89ABCDEF), 0);
+}
+
+uint32 CS_CRC_Test_CombineMismatches(uint32 TypeCRC)
+{
+    uint8  Buffer[CS_CRC_TEST_BUFFER_SIZE];
+    uint32 Expected;
+    uint32 FirstCRC;
+    uint32 SecondCRC;
+    uint32 Result;
+    size_t Split;
+    uint32 MismatchCount = 0;
+
+    CS_CRC_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    Expected = CS_ComputeCRC(Buffer, sizeof(Buffer), 0, TypeCRC);
+
+    for (Split = 0; Split <= sizeof(Buffer); Split++)
+    {
+        /* Compute the second part first to show the order does not matter */
+        SecondCRC = CS_ComputeCRC(&Buffer[Split], sizeof(Buffer) - Split, 0, TypeCRC);
+        FirstCRC  = CS_ComputeCRC(Buffer, Split, 0, TypeCRC);
+        Result    = 0;
+
+        if (!CS_CombineCRC(FirstCRC, SecondCRC, sizeof(Buffer) - Split, TypeCRC, &Result) || Result != Expected)
+        {
+            MismatchCount++;
+        }
+    }
+
+    return MismatchCount;
+}
+
+void CS_CombineCRC_Test_CRC16(void)
+{
+    CS_InitCRC();
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_CombineMismatches(CFE_ES_CrcType_CRC_16), 0);
+}
+
+void CS_CombineCRC_Test_CRC32(void)
+{
+    CS_InitCRC();
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_CombineMismatches(CFE_ES_CrcType_CRC_32), 0);
+}
+
+void CS_CombineCRC_Test_CRC32C(void)
+{
+    CS_InitCRC();
+
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_CRC_Test_CombineMismatches(CS_ALGORITHM_CRC_32C), 0);
+}
+
+void CS_CombineCRC_Test_LargeLength(void)
+{
+    uint32 FirstCRC;
+    uint32 Expected;
+    uint32 Result = 0;
+    uint8  Zeros[4096];
+
+    CS_InitCRC();
+    memset(Zeros, 0, sizeof(Zeros));
+
+    FirstCRC = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32);
+    Expected = CS_ComputeCRC(Zeros, sizeof(Zeros), FirstCRC, CFE_ES_CrcType_CRC_32);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(CS_CombineCRC(FirstCRC, CS_ComputeCRC(Zeros, sizeof(Zeros), 0, CFE_ES_CrcType_CRC_32),
+                                     sizeof(Zeros), CFE_ES_CrcType_CRC_32, &Result));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, Expected);
+}
+
+void CS_CombineCRC_Test_OtherAlgorithm(void)
+{
+    uint32 Result = 0x55;
+
+    CS_InitCRC();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(CS_CombineCRC(1, 2, 3, CFE_ES_CrcType_CRC_8, &Result));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, 0x55);
+}
+
+void CS_ComputeCRC_Test_OtherAlgorithm(void)
+{
+    uint32 Result;
+
+    CS_InitCRC();
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x55);
+
+    /* Execute the function being tested */
+    Result = CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_8);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Result, 0x55);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+void CS_CalibrateCRC_Test_CRC16CfeMismatch(void)
+{
+    uint32 KBytesPerSec = 0;
+
+    CS_InitCRC();
+
+    /* The CFE_ES_CalculateCRC stub returns 0, which is not the CRC-16 of the buffer */
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(CS_CalibrateCRC(CFE_ES_CrcType_CRC_16, &KBytesPerSec), CS_CRC_KERNEL_TABLE);
+
+    /* Verify results */
+    UtAssert_True(KBytesPerSec > 0, "KBytesPerSec > 0");
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, CS_CRC_CALIBRATION_PASSES);
+
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_16),
+        CS_CRC_TEST_CRC16_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, CS_CRC_CALIBRATION_PASSES);
+}
+
+void CS_CalibrateCRC_Test_CRC16CfeFaster(void)
+{
+    static const uint32 LocalTimes[] = {0, 1000, 2000, 2100};
+    uint32              KBytesPerSec = 0;
+
+    CS_InitCRC();
+
+    /* cFE gives the right answer, in a tenth of the time */
+    CS_CRC_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CRC_TEST_OS_GetLocalTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_CalculateCRC), CS_CRC_TEST_CFE_ES_CalculateCRCHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(CS_CalibrateCRC(CFE_ES_CrcType_CRC_16, &KBytesPerSec), CS_CRC_KERNEL_CFE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(KBytesPerSec, (CS_CRC_CALIBRATION_BYTES * CS_CRC_CALIBRATION_PASSES * 1000) / 100);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 4);
+
+    /* CRC-16 is now handed to cFE */
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_16),
+        CS_CRC_TEST_CRC16_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, CS_CRC_CALIBRATION_PASSES + 1);
+
+    /* The other algorithms are not */
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32),
+        CS_CRC_TEST_CRC32_CHECK);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, CS_CRC_CALIBRATION_PASSES + 1);
+}
+
+void CS_CalibrateCRC_Test_CRC32HardwareFaster(void)
+{
+    static const uint32 LocalTimes[] = {0, 1000, 2000, 2500};
+    uint32              KBytesPerSec = 0;
+    uint8               Kernel;
+    bool                HardwareSupported;
+
+    CS_InitCRC();
+
+    HardwareSupported = (CS_GetCRCKernel(CFE_ES_CrcType_CRC_32) == CS_CRC_KERNEL_HARDWARE);
+
+    CS_CRC_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CRC_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    Kernel = CS_CalibrateCRC(CFE_ES_CrcType_CRC_32, &KBytesPerSec);
+
+    /* Verify results, the hardware kernel is only timed when the processor has it */
+    if (HardwareSupported)
+    {
+        UtAssert_UINT8_EQ(Kernel, CS_CRC_KERNEL_HARDWARE);
+        UtAssert_UINT32_EQ(KBytesPerSec, (CS_CRC_CALIBRATION_BYTES * CS_CRC_CALIBRATION_PASSES * 1000) / 500);
+        UtAssert_STUB_COUNT(OS_GetLocalTime, 4);
+    }
+    else
+    {
+        UtAssert_UINT8_EQ(Kernel, CS_CRC_KERNEL_TABLE);
+        UtAssert_UINT32_EQ(KBytesPerSec, (CS_CRC_CALIBRATION_BYTES * CS_CRC_CALIBRATION_PASSES * 1000) / 1000);
+        UtAssert_STUB_COUNT(OS_GetLocalTime, 2);
+    }
+
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 0);
+    UtAssert_UINT32_EQ(
+        CS_ComputeCRC(CS_CRC_TEST_CHECK_STRING, strlen(CS_CRC_TEST_CHECK_STRING), 0, CFE_ES_CrcType_CRC_32),
+        CS_CRC_TEST_CRC32_CHECK);
+}
+
+void CS_CalibrateCRC_Test_CRC32KeepsCRC32CKernel(void)
+{
+    static const uint32 LocalTimes[] = {0, 500, 1000, 2000};
+    uint32              KBytesPerSec = 0;
+    uint8               CRC32CKernel;
+
+    CS_InitCRC();
+
+    CRC32CKernel = CS_GetCRCKernel(CS_ALGORITHM_CRC_32C);
+
+    /* The table-driven kernel wins for CRC-32 */
+    CS_CRC_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CRC_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(CS_CalibrateCRC(CFE_ES_CrcType_CRC_32, &KBytesPerSec), CS_CRC_KERNEL_TABLE);
+
+    /* Verify results, CRC-32C keeps the kernel it had */
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CFE_ES_CrcType_CRC_32), CS_CRC_KERNEL_TABLE);
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CS_ALGORITHM_CRC_32C), CRC32CKernel);
+    UtAssert_UINT32_EQ(CS_CRC_Test_CRC32CMismatches(), 0);
+}
+
+void CS_GetCRCKernel_Test(void)
+{
+    bool HardwareSelected;
+
+    CS_InitCRC();
+
+    CS_SelectCRCHardware(false);
+
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CFE_ES_CrcType_CRC_16), CS_CRC_KERNEL_TABLE);
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CFE_ES_CrcType_CRC_32), CS_CRC_KERNEL_TABLE);
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CS_ALGORITHM_CRC_32C), CS_CRC_KERNEL_TABLE);
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CFE_ES_CrcType_CRC_8), CS_CRC_KERNEL_CFE);
+
+    /* Hardware is only reported where the processor has it */
+    HardwareSelected = CS_SelectCRCHardware(true);
+
+    UtAssert_True(HardwareSelected == ((CS_GetCRCKernel(CFE_ES_CrcType_CRC_32) == CS_CRC_KERNEL_HARDWARE) ||
+                                       (CS_GetCRCKernel(CS_ALGORITHM_CRC_32C) == CS_CRC_KERNEL_HARDWARE)),
+                  "CS_SelectCRCHardware(true) matches the kernels reported");
+    UtAssert_UINT8_EQ(CS_GetCRCKernel(CFE_ES_CrcType_CRC_16), CS_CRC_KERNEL_TABLE);
+}
+
+void CS_CalibrateCRC_Test_InstantKernel(void)
+{
+    static const uint32 LocalTimes[] = {500, 500, 500, 500};
+    uint32              KBytesPerSec = 0;
+
+    CS_InitCRC();
+
+    /* Passes too quick for the clock to resolve count as a microsecond */
+    CS_CRC_TEST_LocalTimes = LocalTimes;
+    UT_SetHandlerFunction(UT_KEY(OS_GetLocalTime), CS_CRC_TEST_OS_GetLocalTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(CS_CalibrateCRC(CS_ALGORITHM_CRC_32C, &KBytesPerSec), CS_CRC_KERNEL_TABLE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(KBytesPerSec, CS_CRC_CALIBRATION_BYTES * CS_CRC_CALIBRATION_PASSES * 1000);
+}
+
+void CS_CalibrateCRC_Test_OtherAlgorithm(void)
+{
+    uint32 KBytesPerSec = 0;
+
+    CS_InitCRC();
+
+    /* Execute the function being tested */
+    UtAssert_UINT8_EQ(CS_CalibrateCRC(CFE_ES_CrcType_CRC_8, &KBytesPerSec), CS_CRC_KERNEL_CFE);
+
+    /* Verify results, the reference and every pass go to cFE */
+    UtAssert_True(KBytesPerSec > 0, "KBytesPerSec > 0");
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, CS_CRC_CALIBRATION_PASSES + 1);
+}
+
+void UtTest_Setup(void)
+{
+    /* Must run first, before any test has called CS_InitCRC */
+    UtTest_Add(CS_ComputeCRC_Test_BeforeInit, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeCRC_Test_BeforeInit");
+    UtTest_Add(CS_ComputeCRC_Test_CRC16CheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC16CheckValue");
+    UtTest_Add(CS_ComputeCRC_Test_CRC16MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC16MatchesReference");
+    UtTest_Add(CS_ComputeCRC_Test_CRC16Chained, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeCRC_Test_CRC16Chained");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32CheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32CheckValue");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32MatchesReference");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32Chained, CS_Test_Setup, CS_Test_TearDown, "CS_ComputeCRC_Test_CRC32Chained");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32CCheckValue, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32CCheckValue");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32CTableKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32CTableKernel");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32CHardwareKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32CHardwareKernel");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32HardwareKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32HardwareKernel");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32FoldMatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32FoldMatchesReference");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32FoldChunkBoundaries, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32FoldChunkBoundaries");
+    UtTest_Add(CS_ComputeCRC_Test_CRC16Interleaved, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC16Interleaved");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32Interleaved, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32Interleaved");
+    UtTest_Add(CS_ComputeCRC_Test_CRC32CInterleaved, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_CRC32CInterleaved");
+    UtTest_Add(CS_CombineCRC_Test_CRC16, CS_Test_Setup, CS_Test_TearDown, "CS_CombineCRC_Test_CRC16");
+    UtTest_Add(CS_CombineCRC_Test_CRC32, CS_Test_Setup, CS_Test_TearDown, "CS_CombineCRC_Test_CRC32");
+    UtTest_Add(CS_CombineCRC_Test_CRC32C, CS_Test_Setup, CS_Test_TearDown, "CS_CombineCRC_Test_CRC32C");
+    UtTest_Add(CS_CombineCRC_Test_LargeLength, CS_Test_Setup, CS_Test_TearDown, "CS_CombineCRC_Test_LargeLength");
+    UtTest_Add(CS_CombineCRC_Test_OtherAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CombineCRC_Test_OtherAlgorithm");
+    UtTest_Add(CS_CalibrateCRC_Test_CRC16CfeMismatch, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_CRC16CfeMismatch");
+    UtTest_Add(CS_CalibrateCRC_Test_CRC16CfeFaster, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_CRC16CfeFaster");
+    UtTest_Add(CS_CalibrateCRC_Test_CRC32HardwareFaster, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_CRC32HardwareFaster");
+    UtTest_Add(CS_CalibrateCRC_Test_CRC32KeepsCRC32CKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_CRC32KeepsCRC32CKernel");
+    UtTest_Add(CS_GetCRCKernel_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetCRCKernel_Test");
+    UtTest_Add(CS_CalibrateCRC_Test_InstantKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_InstantKernel");
+    UtTest_Add(CS_CalibrateCRC_Test_OtherAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateCRC_Test_OtherAlgorithm");
+    UtTest_Add(CS_ComputeCRC_Test_OtherAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeCRC_Test_OtherAlgorithm");
+}
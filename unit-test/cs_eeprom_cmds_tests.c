@@ -151,7 +151,8 @@ void CS_ReportBaselineEntryIDEepromCmd_Test_Computed(void)
     int32         strCmpResult;
     char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Report baseline of EEPROM Entry %%d is 0x%%08X");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Report baseline of EEPROM Entry %%d is 0x%%08X, algorithm %%d");
 
     CmdPacket.Payload.EntryID = 1;
 
@@ -296,18 +297,18 @@ void CS_RecomputeBaselineEepromCmd_Test_Nominal(void)
     CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
 
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_EEPROM_TABLE, "CS_AppData.ChildTaskTable == CS_EEPROM_TABLE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID, "CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID],
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, CmdPacket.Payload.EntryID);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -324,23 +325,24 @@ void CS_RecomputeBaselineEepromCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineEepromCmd_Test_PostWorkError(void)
 {
     CS_EntryCmd_t CmdPacket;
     int32         strCmpResult;
     char          ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of EEPROM Entry ID %%d failed, CFE_ES_CreateChildTask returned:  0x%%08X");
+             "Recompute baseline of EEPROM Entry ID %%d failed, posting to worker queue failed:  0x%%08X");
 
     CmdPacket.Payload.EntryID = 1;
 
     CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
 
-    /* Set to generate error message CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_EEPROM_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
@@ -348,12 +350,11 @@ void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
     /* Verify results */
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
 
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_EEPROM_TABLE, "CS_AppData.ChildTaskTable == CS_EEPROM_TABLE");
-    UtAssert_True(CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID, "CS_AppData.ChildTaskEntryID == CmdPacket.Payload.EntryID");
-    UtAssert_True(CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID],
-                  "CS_AppData.RecomputeEepromMemoryEntryPtr == &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_EEPROM_TABLE);
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.EntryID, CmdPacket.Payload.EntryID);
+    UtAssert_ADDRESS_EQ(context_CS_StartRecomputeWorker.EntryPtr, &CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID]);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_EEPROM_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -369,6 +370,30 @@ void CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineEepromCmd_Test_EntryLocked(void)
+{
+    CS_EntryCmd_t CmdPacket;
+
+    CmdPacket.Payload.EntryID = 1;
+
+    CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = 99;
+
+    /* Another worker already holds the entry */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CS_ENTRY_LOCKED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineEepromCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh(void)
 {
     CS_EntryCmd_t CmdPacket;
@@ -381,6 +406,7 @@ void CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh(void)
     CmdPacket.Payload.EntryID = CS_MAX_NUM_EEPROM_TABLE_ENTRIES;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
@@ -415,6 +441,7 @@ void CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorStateEmpty(void)
     CS_AppData.ResEepromTblPtr[CmdPacket.Payload.EntryID].State = CS_STATE_EMPTY;
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineEepromCmd(&CmdPacket);
@@ -469,6 +496,28 @@ void CS_RecomputeBaselineEepromCmd_Test_RecomputeInProgress(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineEepromCmd_Test_Queued(void)
+{
+    CS_EntryCmd_t CmdPacket;
+
+    CmdPacket.Payload.EntryID = 1;
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineEepromCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_RecomputeBaselineEepromCmd_Test_OneShot(void)
 {
     CS_EntryCmd_t CmdPacket;
@@ -538,6 +587,8 @@ void CS_EnableEntryIDEepromCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -718,6 +769,8 @@ void CS_DisableEntryIDEepromCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -1021,14 +1074,18 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineEepromCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineEepromCmd_Test_PostWorkError");
+    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineEepromCmd_Test_EntryLocked");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorEntryIDTooHigh");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorStateEmpty, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_InvalidEntryErrorStateEmpty");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_RecomputeInProgress");
+    UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineEepromCmd_Test_Queued");
     UtTest_Add(CS_RecomputeBaselineEepromCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineEepromCmd_Test_OneShot");
 
@@ -0,0 +1,252 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_hash.h"
+#include "cs_msgdefs.h"
+#include "cs_test_utils.h"
+#include <unistd.h>
+#include <stdlib.h>
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/* cs_hash_tests globals */
+static const char CS_HASH_TEST_SPAM_STRING[] = "Nobody inspects the spammish repetition";
+
+/* Published check values */
+#define CS_HASH_TEST_XXH64_EMPTY 0xEF46DB3751D8E999ULL
+#define CS_HASH_TEST_XXH64_A     0xD24EC4F1A98C6E5BULL
+#define CS_HASH_TEST_XXH64_ABC   0x44BC2CF5AD770999ULL
+#define CS_HASH_TEST_XXH64_SPAM  0xFBCEA83C8A378BF1ULL
+
+#define CS_HASH_TEST_FLETCHER64_ABCDE    0xC8C6C527646362C6ULL
+#define CS_HASH_TEST_FLETCHER64_ABCDEF   0xC8C72B276463C8C6ULL
+#define CS_HASH_TEST_FLETCHER64_ABCDEFGH 0x312E2B28CCCAC8C6ULL
+
+#define CS_HASH_TEST_BUFFER_SIZE 256
+
+/* Large enough for the Fletcher-64 sums to be reduced part way through */
+#define CS_HASH_TEST_LARGE_BUFFER_SIZE 40000
+
+/*
+ * Function Definitions
+ */
+
+uint64 CS_HASH_Test_OneCall(const void *DataPtr, size_t DataLength, uint32 Algorithm)
+{
+    CS_Hash_State_t State;
+    uint64          HashValue;
+
+    /* Unfinished state from an earlier entry must not matter */
+    memset(&State, 0xA5, sizeof(State));
+
+    CS_ComputeHash(DataPtr, DataLength, 0, &State, Algorithm);
+    CS_FinishHash(&State, DataLength, Algorithm, &HashValue);
+
+    return HashValue;
+}
+
+void CS_HASH_Test_FillBuffer(uint8 *Buffer, size_t Size)
+{
+    size_t i;
+
+    for (i = 0; i < Size; i++)
+    {
+        Buffer[i] = (uint8)((i * 131) ^ (i >> 3));
+    }
+}
+
+/* Word at a time reference implementation with a full reduction on every step */
+uint64 CS_HASH_Test_ReferenceFletcher64(const uint8 *BufPtr, size_t DataLength)
+{
+    uint64 SumA = 0;
+    uint64 SumB = 0;
+    uint32 Word;
+    size_t i;
+
+    while (DataLength > 0)
+    {
+        Word = 0;
+        for (i = 0; (i < 4) && (DataLength > 0); i++)
+        {
+            Word |= (uint32)(*BufPtr++) << (8 * i);
+            DataLength--;
+        }
+
+        SumA = (SumA + Word) % 0xFFFFFFFF;
+        SumB = (SumB + SumA) % 0xFFFFFFFF;
+    }
+
+    return (SumB << 32) | SumA;
+}
+
+/* Number of ways of splitting a buffer into two or three calls that do not match one call */
+uint32 CS_HASH_Test_ChunkMismatches(uint32 Algorithm)
+{
+    uint8           Buffer[CS_HASH_TEST_BUFFER_SIZE];
+    CS_Hash_State_t State;
+    uint64          Expected;
+    uint64          HashValue;
+    size_t          Split;
+    size_t          Middle;
+    uint32          MismatchCount = 0;
+
+    CS_HASH_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    Expected = CS_HASH_Test_OneCall(Buffer, sizeof(Buffer), Algorithm);
+
+    for (Split = 0; Split <= sizeof(Buffer); Split++)
+    {
+        CS_ComputeHash(Buffer, Split, 0, &State, Algorithm);
+        CS_ComputeHash(&Buffer[Split], sizeof(Buffer) - Split, Split, &State, Algorithm);
+        CS_FinishHash(&State, sizeof(Buffer), Algorithm, &HashValue);
+
+        if (HashValue != Expected)
+        {
+            MismatchCount++;
+        }
+
+        /* Short middle chunks start and end part way through a stripe or word */
+        for (Middle = 1; (Middle < 40) && ((Split + Middle) <= sizeof(Buffer)); Middle += 3)
+        {
+            CS_ComputeHash(Buffer, Split, 0, &State, Algorithm);
+            CS_ComputeHash(&Buffer[Split], Middle, Split, &State, Algorithm);
+            CS_ComputeHash(&Buffer[Split + Middle], sizeof(Buffer) - Split - Middle, Split + Middle, &State,
+                           Algorithm);
+            CS_FinishHash(&State, sizeof(Buffer), Algorithm, &HashValue);
+
+            if (HashValue != Expected)
+            {
+                MismatchCount++;
+            }
+        }
+    }
+
+    return MismatchCount;
+}
+
+void CS_FinishHash_Test_XXHash64CheckValues(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_True(CS_HASH_Test_OneCall("", 0, CS_ALGORITHM_XXHASH_64) == CS_HASH_TEST_XXH64_EMPTY,
+                  "XXH64 of the empty string");
+    UtAssert_True(CS_HASH_Test_OneCall("a", 1, CS_ALGORITHM_XXHASH_64) == CS_HASH_TEST_XXH64_A, "XXH64 of \"a\"");
+    UtAssert_True(CS_HASH_Test_OneCall("abc", 3, CS_ALGORITHM_XXHASH_64) == CS_HASH_TEST_XXH64_ABC,
+                  "XXH64 of \"abc\"");
+    UtAssert_True(CS_HASH_Test_OneCall(CS_HASH_TEST_SPAM_STRING, strlen(CS_HASH_TEST_SPAM_STRING),
+                                       CS_ALGORITHM_XXHASH_64) == CS_HASH_TEST_XXH64_SPAM,
+                  "XXH64 of \"%s\"", CS_HASH_TEST_SPAM_STRING);
+}
+
+void CS_FinishHash_Test_Fletcher64CheckValues(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_True(CS_HASH_Test_OneCall("abcde", 5, CS_ALGORITHM_FLETCHER_64) == CS_HASH_TEST_FLETCHER64_ABCDE,
+                  "Fletcher-64 of \"abcde\"");
+    UtAssert_True(CS_HASH_Test_OneCall("abcdef", 6, CS_ALGORITHM_FLETCHER_64) == CS_HASH_TEST_FLETCHER64_ABCDEF,
+                  "Fletcher-64 of \"abcdef\"");
+    UtAssert_True(CS_HASH_Test_OneCall("abcdefgh", 8, CS_ALGORITHM_FLETCHER_64) == CS_HASH_TEST_FLETCHER64_ABCDEFGH,
+                  "Fletcher-64 of \"abcdefgh\"");
+    UtAssert_True(CS_HASH_Test_OneCall("", 0, CS_ALGORITHM_FLETCHER_64) == 0, "Fletcher-64 of the empty string");
+}
+
+void CS_ComputeHash_Test_XXHash64Chunked(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_HASH_Test_ChunkMismatches(CS_ALGORITHM_XXHASH_64), 0);
+}
+
+void CS_ComputeHash_Test_Fletcher64Chunked(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_HASH_Test_ChunkMismatches(CS_ALGORITHM_FLETCHER_64), 0);
+}
+
+void CS_ComputeHash_Test_Fletcher64MatchesReference(void)
+{
+    static uint8 Buffer[CS_HASH_TEST_LARGE_BUFFER_SIZE];
+    size_t       Length;
+    uint32       MismatchCount = 0;
+
+    /* All ones words push the sums as close to overflowing as possible */
+    memset(Buffer, 0xFF, sizeof(Buffer));
+
+    for (Length = sizeof(Buffer) - 4; Length <= sizeof(Buffer); Length++)
+    {
+        if (CS_HASH_Test_OneCall(Buffer, Length, CS_ALGORITHM_FLETCHER_64) !=
+            CS_HASH_Test_ReferenceFletcher64(Buffer, Length))
+        {
+            MismatchCount++;
+        }
+    }
+
+    CS_HASH_Test_FillBuffer(Buffer, sizeof(Buffer));
+
+    for (Length = sizeof(Buffer) - 4; Length <= sizeof(Buffer); Length++)
+    {
+        if (CS_HASH_Test_OneCall(Buffer, Length, CS_ALGORITHM_FLETCHER_64) !=
+            CS_HASH_Test_ReferenceFletcher64(Buffer, Length))
+        {
+            MismatchCount++;
+        }
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MismatchCount, 0);
+}
+
+void CS_ComputeHash_Test_OtherAlgorithm(void)
+{
+    CS_Hash_State_t State;
+    CS_Hash_State_t Expected;
+    uint64          HashValue = 0x55;
+
+    memset(&State, 0xA5, sizeof(State));
+    memset(&Expected, 0xA5, sizeof(Expected));
+
+    /* Execute the function being tested */
+    CS_ComputeHash(CS_HASH_TEST_SPAM_STRING, strlen(CS_HASH_TEST_SPAM_STRING), 0, &State, CFE_ES_CrcType_CRC_32);
+    CS_FinishHash(&State, strlen(CS_HASH_TEST_SPAM_STRING), CFE_ES_CrcType_CRC_32, &HashValue);
+
+    /* Verify results */
+    UtAssert_MemCmp(&State, &Expected, sizeof(State), "State unchanged");
+    UtAssert_True(HashValue == 0, "HashValue == 0");
+}
+
+void UtTest_Setup(void)
+{
+    UtTest_Add(CS_FinishHash_Test_XXHash64CheckValues, CS_Test_Setup, CS_Test_TearDown,
+               "CS_FinishHash_Test_XXHash64CheckValues");
+    UtTest_Add(CS_FinishHash_Test_Fletcher64CheckValues, CS_Test_Setup, CS_Test_TearDown,
+               "CS_FinishHash_Test_Fletcher64CheckValues");
+    UtTest_Add(CS_ComputeHash_Test_XXHash64Chunked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeHash_Test_XXHash64Chunked");
+    UtTest_Add(CS_ComputeHash_Test_Fletcher64Chunked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeHash_Test_Fletcher64Chunked");
+    UtTest_Add(CS_ComputeHash_Test_Fletcher64MatchesReference, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeHash_Test_Fletcher64MatchesReference");
+    UtTest_Add(CS_ComputeHash_Test_OtherAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ComputeHash_Test_OtherAlgorithm");
+}
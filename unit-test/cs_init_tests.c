@@ -36,6 +36,10 @@
 #include "utassert.h"
 #include "utstubs.h"
 
+/* Every recompute worker has a task of its own and one for each sub-range of a split, and the one shot has one */
+#define CS_INIT_TEST_NUM_WORKER_TASKS \
+    ((CS_MAX_RECOMPUTE_WORKERS * (1 + ((CS_NUM_SUB_RANGES > 1) ? CS_NUM_SUB_RANGES : 0))) + 1)
+
 /* cs_init_tests globals */
 uint8 call_count_CFE_EVS_SendEvent;
 
@@ -344,6 +348,21 @@ void CS_Init_Test_TableInitErrorTables(void)
     /* Generates 1 event message we don't care about in this test */
 }
 
+void CS_Init_Test_TableInitErrorBudget(void)
+{
+    /* Set to generate error message CS_INIT_BUDGET_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CS_BudgetTableInit), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitAllTables(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_BudgetTableInit, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_BUDGET_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void CS_Init_Test_CFETextSegmentInfoError(void)
 {
     int32 strCmpResult;
@@ -408,6 +427,112 @@ void CS_Init_Test_KernelTextSegmentInfoError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_Init_Test_RecomputeWorkersNominal(void)
+{
+    CS_AppData.RecomputeWorkers[0].EntryPtr          = &CS_AppData.OSCodeSeg;
+    CS_AppData.RecomputeWorkers[0].SubRangeTaskID[0] = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(5));
+    CS_AppData.RecomputeWorkers[0].SubRangeBusyMask  = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitRecomputeWorkers(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_NULL(CS_AppData.RecomputeWorkers[0].EntryPtr);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.RecomputeWorkers[0].TaskID));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.RecomputeWorkers[0].SubRangeTaskID[0]));
+    UtAssert_UINT32_EQ(CS_AppData.RecomputeWorkers[0].SubRangeBusyMask, 0);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_Init_Test_RecomputeWorkersMutexError(void)
+{
+    /* Set to generate error message CS_INIT_WORKER_MUTEX_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitRecomputeWorkers(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_WORKER_MUTEX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_Init_Test_WorkerTasksNominal(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitWorkerTasks(), CFE_SUCCESS);
+
+    /* Verify results, one queue and task per recompute worker and sub-range, and one for the one shot */
+    UtAssert_STUB_COUNT(OS_QueueCreate, CS_INIT_TEST_NUM_WORKER_TASKS);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CS_INIT_TEST_NUM_WORKER_TASKS);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CS_AppData.RecomputeWorkers[CS_MAX_RECOMPUTE_WORKERS - 1].QueueID));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(
+        CS_AppData.RecomputeWorkers[CS_MAX_RECOMPUTE_WORKERS - 1].SubRangeQueueID[CS_NUM_SUB_RANGES - 1]));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CS_AppData.OneShotQueueID));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_Init_Test_WorkerTasksQueueError(void)
+{
+    /* Set to generate error message CS_INIT_WORKER_QUEUE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitWorkerTasks(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_QueueCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_WORKER_QUEUE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_Init_Test_WorkerTasksTaskError(void)
+{
+    /* Set to generate error message CS_INIT_WORKER_TASK_ERR_EID on the one shot task */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), CS_INIT_TEST_NUM_WORKER_TASKS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_InitWorkerTasks(), -1);
+
+    /* Verify results, the queue no task would read is deleted */
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CS_INIT_TEST_NUM_WORKER_TASKS);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CS_AppData.OneShotQueueID));
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_WORKER_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_Init_Test_WorkerTasksSubRangeError(void)
+{
+    /* The first worker's first sub-range task and second sub-range queue can not be created */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 2, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 3, OS_ERROR);
+
+    /* Execute the function being tested, CS starts without them */
+    UtAssert_INT32_EQ(CS_InitWorkerTasks(), CFE_SUCCESS);
+
+    /* Verify results, the worker checksums those sub-ranges itself */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CS_AppData.RecomputeWorkers[0].SubRangeQueueID[0]));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CS_AppData.RecomputeWorkers[0].SubRangeTaskID[0]));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CS_AppData.RecomputeWorkers[0].SubRangeQueueID[1]));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CS_AppData.RecomputeWorkers[0].QueueID));
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(CS_AppData.OneShotQueueID));
+    UtAssert_STUB_COUNT(OS_QueueDelete, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, CS_INIT_TEST_NUM_WORKER_TASKS - 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_INIT_WORKER_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_INIT_WORKER_QUEUE_ERR_EID);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_Init_Test_SBCreatePipeError, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_SBCreatePipeError");
@@ -421,8 +546,20 @@ void UtTest_Setup(void)
     UtTest_Add(CS_Init_Test_TableInitErrorMemory, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_TableInitErrorMemory");
     UtTest_Add(CS_Init_Test_TableInitErrorApps, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_TableInitErrorApps");
     UtTest_Add(CS_Init_Test_TableInitErrorTables, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_TableInitErrorTables");
+    UtTest_Add(CS_Init_Test_TableInitErrorBudget, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_TableInitErrorBudget");
     UtTest_Add(CS_Init_Test_CFETextSegmentInfoError, CS_Test_Setup, CS_Test_TearDown,
                "CS_Init_Test_CFETextSegmentInfoError");
     UtTest_Add(CS_Init_Test_KernelTextSegmentInfoError, CS_Test_Setup, CS_Test_TearDown,
                "CS_Init_Test_KernelTextSegmentInfoError");
+    UtTest_Add(CS_Init_Test_RecomputeWorkersNominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Init_Test_RecomputeWorkersNominal");
+    UtTest_Add(CS_Init_Test_RecomputeWorkersMutexError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Init_Test_RecomputeWorkersMutexError");
+    UtTest_Add(CS_Init_Test_WorkerTasksNominal, CS_Test_Setup, CS_Test_TearDown, "CS_Init_Test_WorkerTasksNominal");
+    UtTest_Add(CS_Init_Test_WorkerTasksQueueError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Init_Test_WorkerTasksQueueError");
+    UtTest_Add(CS_Init_Test_WorkerTasksTaskError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Init_Test_WorkerTasksTaskError");
+    UtTest_Add(CS_Init_Test_WorkerTasksSubRangeError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_Init_Test_WorkerTasksSubRangeError");
 }
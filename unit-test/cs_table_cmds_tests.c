@@ -186,7 +186,8 @@ void CS_ReportBaselineTablesCmd_Test_Computed(void)
     int32             strCmpResult;
     char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Report baseline of table %%s is 0x%%08X");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Report baseline of table %%s is 0x%%08X, algorithm %%d");
 
     CS_AppData.ResTablesTblPtr[0].ComputedYet     = true;
     CS_AppData.ResTablesTblPtr[0].ComparisonValue = 1;
@@ -315,15 +316,16 @@ void CS_RecomputeBaselineTablesCmd_Test_Nominal(void)
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
 
     /* Verify results */
-    UtAssert_True(CS_AppData.HkPacket.Payload.RecomputeInProgress == true, "CS_AppData.HkPacket.Payload.RecomputeInProgress == true");
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
 
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_TABLES_TABLE, "CS_AppData.ChildTaskTable == CS_TABLES_TABLE");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_TABLES_TABLE);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_STARTED_DBG_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
@@ -340,28 +342,29 @@ void CS_RecomputeBaselineTablesCmd_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
+void CS_RecomputeBaselineTablesCmd_Test_PostWorkError(void)
 {
     CS_TableNameCmd_t CmdPacket;
     int32             strCmpResult;
     char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Recompute baseline of table %%s failed, CFE_ES_CreateChildTask returned: 0x%%08X");
+             "Recompute baseline of table %%s failed, posting to worker queue failed: 0x%%08X");
 
     strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
     strncpy(CmdPacket.Payload.Name, "name", 10);
 
     CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
 
-    /* Set to generate error message CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
+    /* Set to generate error message CS_RECOMPUTE_TABLES_POST_WORK_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, -1);
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
     UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
                           NULL);
     UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
@@ -369,9 +372,9 @@ void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
     /* Verify results */
     UtAssert_True(CS_AppData.HkPacket.Payload.OneShotInProgress == false, "CS_AppData.HkPacket.Payload.OneShotInProgress == false");
 
-    UtAssert_True(CS_AppData.ChildTaskTable == CS_TABLES_TABLE, "CS_AppData.ChildTaskTable == CS_TABLES_TABLE");
+    UtAssert_UINT32_EQ(context_CS_StartRecomputeWorker.Table, CS_TABLES_TABLE);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_CREATE_CHDTASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_TABLES_POST_WORK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -388,6 +391,35 @@ void CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineTablesCmd_Test_EntryLocked(void)
+{
+    CS_TableNameCmd_t CmdPacket;
+
+    strncpy(CS_AppData.ResTablesTblPtr[0].Name, "name", 10);
+    strncpy(CmdPacket.Payload.Name, "name", 10);
+
+    CS_AppData.ResTablesTblPtr[0].State = 99; /* Needed to make CS_GetTableResTblEntryByName return correct results */
+
+    /* Another worker already holds the entry */
+    UT_SetDeferredRetcode(UT_KEY(CS_StartRecomputeWorker), 1, CS_ENTRY_LOCKED);
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
+    UT_SetHandlerFunction(UT_KEY(CS_GetTableResTblEntryByName), CS_APP_CMDS_TEST_CS_GetTableResTblEntryByNameHandler1,
+                          NULL);
+    UT_SetDeferredRetcode(UT_KEY(CS_GetTableResTblEntryByName), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineTablesCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void CS_RecomputeBaselineTablesCmd_Test_TableNotFound(void)
 {
     CS_TableNameCmd_t CmdPacket;
@@ -401,6 +433,7 @@ void CS_RecomputeBaselineTablesCmd_Test_TableNotFound(void)
 
     UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
     UT_SetDeferredRetcode(UT_KEY(CS_CheckRecomputeOneshot), 1, false);
+    UT_SetDeferredRetcode(UT_KEY(CS_ChildTaskIsFree), 1, true);
 
     /* Execute the function being tested */
     CS_RecomputeBaselineTablesCmd(&CmdPacket);
@@ -458,6 +491,28 @@ void CS_RecomputeBaselineTablesCmd_Test_RecomputeInProgress(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_RecomputeBaselineTablesCmd_Test_Queued(void)
+{
+    CS_TableNameCmd_t CmdPacket;
+
+    strncpy(CmdPacket.Payload.Name, "Table1", CFE_TBL_MAX_FULL_NAME_LEN);
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
+
+    UT_SetDeferredRetcode(UT_KEY(CS_VerifyCmdLength), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CS_QueueChildTaskRequest), 1, true);
+
+    /* Execute the function being tested */
+    CS_RecomputeBaselineTablesCmd(&CmdPacket);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_QueueChildTaskRequest, 1);
+    UtAssert_STUB_COUNT(CS_StartRecomputeWorker, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 0);
+}
+
 void CS_RecomputeBaselineTablesCmd_Test_OneShot(void)
 {
     CS_TableNameCmd_t CmdPacket;
@@ -537,6 +592,8 @@ void CS_DisableNameTablesCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -692,6 +749,8 @@ void CS_EnableNameTablesCmd_Test_Nominal(void)
 
     UtAssert_True(CS_AppData.HkPacket.Payload.CmdCounter == 1, "CS_AppData.HkPacket.Payload.CmdCounter == 1");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
@@ -821,12 +880,16 @@ void UtTest_Setup(void)
 
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_Nominal");
-    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError, CS_Test_Setup, CS_Test_TearDown,
-               "CS_RecomputeBaselineTablesCmd_Test_CreateChildTaskError");
+    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineTablesCmd_Test_PostWorkError");
+    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineTablesCmd_Test_EntryLocked");
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_TableNotFound, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_TableNotFound");
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_RecomputeInProgress, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_RecomputeInProgress");
+    UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_Queued, CS_Test_Setup, CS_Test_TearDown,
+               "CS_RecomputeBaselineTablesCmd_Test_Queued");
     UtTest_Add(CS_RecomputeBaselineTablesCmd_Test_OneShot, CS_Test_Setup, CS_Test_TearDown,
                "CS_RecomputeBaselineTablesCmd_Test_OneShot");
 
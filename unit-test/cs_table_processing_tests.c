@@ -62,6 +62,26 @@ CFE_Status_t CS_TABLE_PROCESSING_TEST_CFE_TBL_LoadHook(void *UserObj, int32 Stub
     return CFE_SUCCESS;
 }
 
+void CS_ValidateAlgorithm_Test(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CS_ALGORITHM_DEFAULT));
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CFE_ES_CrcType_CRC_16));
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CFE_ES_CrcType_CRC_32));
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CS_ALGORITHM_CRC_32C));
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CS_ALGORITHM_XXHASH_64));
+    UtAssert_BOOL_TRUE(CS_ValidateAlgorithm(CS_ALGORITHM_FLETCHER_64));
+    UtAssert_BOOL_FALSE(CS_ValidateAlgorithm(CFE_ES_CrcType_CRC_8));
+    UtAssert_BOOL_FALSE(CS_ValidateAlgorithm(0xFF));
+}
+
+void CS_GetEntryAlgorithm_Test(void)
+{
+    /* Execute the function being tested and verify results */
+    UtAssert_UINT32_EQ(CS_GetEntryAlgorithm(CS_ALGORITHM_DEFAULT), CS_DEFAULT_ALGORITHM);
+    UtAssert_UINT32_EQ(CS_GetEntryAlgorithm(CS_ALGORITHM_CRC_32C), CS_ALGORITHM_CRC_32C);
+}
+
 void CS_ValidateEepromChecksumDefinitionTable_Test_Nominal(void)
 {
     CFE_Status_t Result;
@@ -230,6 +250,50 @@ void CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EEPROM Table Validate: Illegal Algorithm (%%d) found in Entry ID %%d");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS EEPROM Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefEepromTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefEepromTblPtr[0].Algorithm = 0xFF;
+
+    /* Execute the function being tested */
+    Result = CS_ValidateEepromChecksumDefinitionTable(CS_AppData.DefEepromTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_EEPROM_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_EEPROM_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -492,6 +556,50 @@ void CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Memory Table Validate: Illegal Algorithm (%%d) found in Entry ID %%d");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Memory Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefMemoryTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefMemoryTblPtr[0].Algorithm = 0xFF;
+
+    /* Execute the function being tested */
+    Result = CS_ValidateMemoryChecksumDefinitionTable(CS_AppData.DefMemoryTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_MEMORY_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_MEMORY_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -851,6 +959,52 @@ void CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Tables Table Validate: Illegal Algorithm (%%d) found with name %%s");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Tables Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefTablesTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefTablesTblPtr[0].Algorithm = 0xFF;
+
+    strncpy(CS_AppData.DefTablesTblPtr[0].Name, "name", 10);
+
+    /* Execute the function being tested */
+    Result = CS_ValidateTablesChecksumDefinitionTable(CS_AppData.DefTablesTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_TABLES_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_TABLES_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -1259,6 +1413,52 @@ void CS_ValidateAppChecksumDefinitionTable_Test_LongName(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
+void CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm(void)
+{
+    CFE_Status_t Result;
+    int32        strCmpResult;
+    char         ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Apps Table Validate: Illegal Algorithm (%%d) found with name %%s");
+
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CS Apps Table verification results: good = %%d, bad = %%d, unused = %%d");
+
+    CS_AppData.DefAppTblPtr[0].State     = CS_STATE_ENABLED;
+    CS_AppData.DefAppTblPtr[0].Algorithm = 0xFF;
+
+    strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 20);
+
+    /* Execute the function being tested */
+    Result = CS_ValidateAppChecksumDefinitionTable(CS_AppData.DefAppTblPtr);
+
+    /* Verify results */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_APP_ALG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_APP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == CS_TABLE_ERROR, "Result == CS_TABLE_ERROR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void CS_ValidateAppChecksumDefinitionTable_Test_TableErrorResult(void)
 {
     CFE_Status_t Result;
@@ -1401,6 +1601,44 @@ void CS_ValidateAppChecksumDefinitionTable_Test_EmptyNameTableResult(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_ValidateBudgetTable_Test_Nominal(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE]      = CS_MAX_BUDGET_BYTES_PER_CYCLE;
+    BudgetTbl.BytesPerCycle[CS_CHILD_TASK_BUDGET] = 1;
+    BudgetTbl.Weight[CS_APP_TABLE]                = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_ValidateBudgetTable(&BudgetTbl), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_BUDGET_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_ValidateBudgetTable_Test_TooLarge(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_MEMORY_TABLE]      = CS_MAX_BUDGET_BYTES_PER_CYCLE + 1;
+    BudgetTbl.BytesPerCycle[CS_CHILD_TASK_BUDGET] = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_ValidateBudgetTable(&BudgetTbl), CS_TABLE_ERROR);
+
+    /* Verify results, only the first bad budget is reported */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_VAL_BUDGET_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_VAL_BUDGET_INF_EID);
+}
+
 void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
 {
     /* Handles both cases of "DefEntry -> State" */
@@ -1412,6 +1650,10 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     CS_AppData.DefEepromTblPtr[0].State              = 1;
     CS_AppData.DefEepromTblPtr[0].NumBytesToChecksum = 2;
     CS_AppData.DefEepromTblPtr[0].StartAddress       = 3;
+    CS_AppData.DefEepromTblPtr[0].Algorithm          = CS_ALGORITHM_CRC_32C;
+    CS_AppData.DefEepromTblPtr[0].MaxStaleness       = 60;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetCurrentSeconds), 1234);
 
     /* Execute the function being tested */
     /* Note: first 2 arguments are passed in as addresses of pointers in the source code, even though the variable
@@ -1435,6 +1677,9 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     UtAssert_True(CS_AppData.ResEepromTblPtr[0].TempChecksumValue == 0,
                   "CS_AppData.ResEepromTblPtr[0].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[0].StartAddress == 3, "CS_AppData.ResEepromTblPtr[0].StartAddress == 3");
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].Algorithm, CS_ALGORITHM_CRC_32C);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].MaxStaleness, 60);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[0].VerifiedTime, 1234);
 
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].State == CS_STATE_EMPTY,
                   "CS_AppData.ResEepromTblPtr[1].State == CS_STATE_EMPTY");
@@ -1448,6 +1693,10 @@ void CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal(void)
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].TempChecksumValue == 0,
                   "CS_AppData.ResEepromTblPtr[1].TempChecksumValue == 0");
     UtAssert_True(CS_AppData.ResEepromTblPtr[1].StartAddress == 0, "CS_AppData.ResEepromTblPtr[1].StartAddress == 0");
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].MaxStaleness, 0);
+    UtAssert_UINT32_EQ(CS_AppData.ResEepromTblPtr[1].VerifiedTime, 0);
+
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, NumEntries);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -1589,6 +1838,9 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle(void)
 {
     CS_AppData.HkPacket.Payload.TablesCSState   = 99;
     CS_AppData.DefTablesTblPtr[0].State = 88;
+    CS_AppData.DefTablesTblPtr[0].MaxStaleness = 60;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetCurrentSeconds), 1234);
 
     strncpy(CS_AppData.DefTablesTblPtr[0].Name, "CS.DefEepromTbl", 20);
 
@@ -1628,6 +1880,8 @@ void CS_ProcessNewTablesDefinitionTable_Test_DefEepromTableHandle(void)
     UtAssert_True(CS_AppData.ResTablesTblPtr[0].IsCSOwner == true, "CS_AppData.ResTablesTblPtr[0].IsCSOwner == true");
     UtAssert_True(strncmp(CS_AppData.ResTablesTblPtr[0].Name, "CS.DefEepromTbl", 20) == 0,
                   "strncmp(CS_AppData.ResTablesTblPtr[0].Name, 'CS.DefEepromTbl', 20) == 0");
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[0].MaxStaleness, 60);
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[0].VerifiedTime, 1234);
 
     UtAssert_True(CS_AppData.HkPacket.Payload.TablesCSState == 99, "CS_AppData.HkPacket.Payload.TablesCSState == 99");
 
@@ -2186,6 +2440,9 @@ void CS_ProcessNewAppDefinitionTable_Test_Nominal(void)
 {
     CS_AppData.HkPacket.Payload.AppCSState   = 99;
     CS_AppData.DefAppTblPtr[0].State = 88;
+    CS_AppData.DefAppTblPtr[0].MaxStaleness = 60;
+
+    UT_SetDefaultReturnValue(UT_KEY(CS_GetCurrentSeconds), 1234);
 
     strncpy(CS_AppData.DefAppTblPtr[0].Name, "name", 20);
 
@@ -2208,9 +2465,14 @@ void CS_ProcessNewAppDefinitionTable_Test_Nominal(void)
     UtAssert_True(CS_AppData.ResAppTblPtr[0].StartAddress == 0, "CS_AppData.ResAppTblPtr[0].StartAddress == 0");
     UtAssert_True(strncmp(CS_AppData.ResAppTblPtr[0].Name, "name", 20) == 0,
                   "strncmp(CS_AppData.ResAppTblPtr[0].Name, 'name', 20) == 0");
+    UtAssert_UINT32_EQ(CS_AppData.ResAppTblPtr[0].Algorithm, CS_DEFAULT_ALGORITHM);
+    UtAssert_UINT32_EQ(CS_AppData.ResAppTblPtr[0].MaxStaleness, 60);
+    UtAssert_UINT32_EQ(CS_AppData.ResAppTblPtr[0].VerifiedTime, 1234);
 
     UtAssert_True(CS_AppData.HkPacket.Payload.AppCSState == 99, "CS_AppData.HkPacket.Payload.AppCSState == 99");
 
+    UtAssert_STUB_COUNT(CS_SetEntryEnabled, CS_MAX_NUM_APP_TABLE_ENTRIES);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -3327,8 +3589,134 @@ void CS_HandleTableUpdate_Test_GetAddressError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void CS_BudgetTableInit_Test_LoadFromFile(void)
+{
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_BudgetTableInit_Test_LoadFromMemory(void)
+{
+    /* The file exists but cannot be loaded */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+
+    /* No file */
+    UT_ResetState(UT_KEY(CFE_TBL_Load));
+    UT_ResetState(UT_KEY(OS_close));
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), -1);
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+}
+
+void CS_BudgetTableInit_Test_RegisterError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+    UtAssert_INT32_EQ(CS_AppData.DefBudgetTableHandle, CFE_TBL_BAD_TABLE_HANDLE);
+    UtAssert_NULL(CS_AppData.DefBudgetTblPtr);
+}
+
+void CS_BudgetTableInit_Test_LoadError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 2);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+    UtAssert_NULL(CS_AppData.DefBudgetTblPtr);
+
+    /* GetAddress error */
+    UT_ResetState(UT_KEY(CFE_TBL_Load));
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -2);
+    UtAssert_INT32_EQ(CS_BudgetTableInit(), -2);
+    UtAssert_NULL(CS_AppData.DefBudgetTblPtr);
+}
+
+void CS_HandleBudgetTableUpdate_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_APP_TABLE] = 20;
+    CS_AppData.DefBudgetTblPtr            = &BudgetTbl;
+
+    /* Not registered, nothing to do */
+    CS_AppData.DefBudgetTableHandle = CFE_TBL_BAD_TABLE_HANDLE;
+    UtAssert_INT32_EQ(CS_HandleBudgetTableUpdate(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+
+    /* Updated */
+    CS_AppData.DefBudgetTableHandle = 0;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(CS_HandleBudgetTableUpdate(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_ADDRESS_EQ(CS_AppData.DefBudgetTblPtr, &BudgetTbl);
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_APP_TABLE], 20);
+
+    /* GetAddress error */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
+    UtAssert_INT32_EQ(CS_HandleBudgetTableUpdate(), -1);
+    UtAssert_NULL(CS_AppData.DefBudgetTblPtr);
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_APP_TABLE], 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_RefreshBudgets_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE]      = 10;
+    BudgetTbl.BytesPerCycle[CS_CHILD_TASK_BUDGET] = 500;
+    CS_AppData.DefBudgetTblPtr                    = &BudgetTbl;
+
+    /* Copied from the table */
+    UtAssert_VOIDCALL(CS_RefreshBudgets());
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_EEPROM_TABLE], 10);
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_MEMORY_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_CHILD_TASK_BUDGET], 500);
+
+    /* Cleared without a table */
+    CS_AppData.DefBudgetTblPtr = NULL;
+    UtAssert_VOIDCALL(CS_RefreshBudgets());
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_EEPROM_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.BytesPerCycleBudget[CS_CHILD_TASK_BUDGET], 0);
+}
+
 void UtTest_Setup(void)
 {
+    UtTest_Add(CS_ValidateAlgorithm_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ValidateAlgorithm_Test");
+    UtTest_Add(CS_GetEntryAlgorithm_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetEntryAlgorithm_Test");
+
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateEepromChecksumDefinitionTable_Test_Nominal");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_IllegalChecksumRangeStateEnabled, CS_Test_Setup,
@@ -3337,6 +3725,8 @@ void UtTest_Setup(void)
                CS_Test_TearDown, "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalChecksumRangeStateDisabled");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateEepromChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateEepromChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateEepromChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3350,6 +3740,8 @@ void UtTest_Setup(void)
                CS_Test_TearDown, "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalChecksumRangeStateDisabled");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateMemoryChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateMemoryChecksumDefinitionTable_Test_TableErrorResult");
     UtTest_Add(CS_ValidateMemoryChecksumDefinitionTable_Test_UndefTableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3365,6 +3757,8 @@ void UtTest_Setup(void)
                CS_Test_TearDown, "CS_ValidateTablesChecksumDefinitionTable_Test_DuplicateNameStateDisabled");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateTablesChecksumDefinitionTable_Test_IllegalStateEmptyName");
     UtTest_Add(CS_ValidateTablesChecksumDefinitionTable_Test_TableErrorResult, CS_Test_Setup, CS_Test_TearDown,
@@ -3384,6 +3778,8 @@ void UtTest_Setup(void)
                "CS_ValidateAppChecksumDefinitionTable_Test_DuplicateNameStateDisabled");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_IllegalStateField, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateAppChecksumDefinitionTable_Test_IllegalStateField");
+    UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateAppChecksumDefinitionTable_Test_IllegalAlgorithm");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_IllegalStateEmptyName, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateAppChecksumDefinitionTable_Test_IllegalStateEmptyName");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_LongName, CS_Test_Setup, CS_Test_TearDown,
@@ -3394,6 +3790,10 @@ void UtTest_Setup(void)
                "CS_ValidateAppChecksumDefinitionTable_Test_UndefTableErrorResult");
     UtTest_Add(CS_ValidateAppChecksumDefinitionTable_Test_EmptyNameTableResult, CS_Test_Setup, CS_Test_TearDown,
                "CS_ValidateAppChecksumDefinitionTable_Test_EmptyNameTableResult");
+    UtTest_Add(CS_ValidateBudgetTable_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateBudgetTable_Test_Nominal");
+    UtTest_Add(CS_ValidateBudgetTable_Test_TooLarge, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ValidateBudgetTable_Test_TooLarge");
 
     UtTest_Add(CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal, CS_Test_Setup, CS_Test_TearDown,
                "CS_ProcessNewEepromMemoryDefinitionTable_Test_EEPROMTableNominal");
@@ -3491,4 +3891,13 @@ void UtTest_Setup(void)
     UtTest_Add(CS_HandleTableUpdate_Test_CsOwner, CS_Test_Setup, CS_Test_TearDown, "CS_HandleTableUpdate_Test_CsOwner");
     UtTest_Add(CS_HandleTableUpdate_Test_GetAddressError, CS_Test_Setup, CS_Test_TearDown,
                "CS_HandleTableUpdate_Test_GetAddressError");
+    UtTest_Add(CS_BudgetTableInit_Test_LoadFromFile, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetTableInit_Test_LoadFromFile");
+    UtTest_Add(CS_BudgetTableInit_Test_LoadFromMemory, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetTableInit_Test_LoadFromMemory");
+    UtTest_Add(CS_BudgetTableInit_Test_RegisterError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BudgetTableInit_Test_RegisterError");
+    UtTest_Add(CS_BudgetTableInit_Test_LoadError, CS_Test_Setup, CS_Test_TearDown, "CS_BudgetTableInit_Test_LoadError");
+    UtTest_Add(CS_HandleBudgetTableUpdate_Test, CS_Test_Setup, CS_Test_TearDown, "CS_HandleBudgetTableUpdate_Test");
+    UtTest_Add(CS_RefreshBudgets_Test, CS_Test_Setup, CS_Test_TearDown, "CS_RefreshBudgets_Test");
 }
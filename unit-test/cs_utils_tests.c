@@ -27,6 +27,7 @@
 #include "cs_events.h"
 #include "cs_version.h"
 #include "cs_compute.h"
+#include "cs_crc.h"
 #include "cs_test_utils.h"
 #include <unistd.h>
 #include <stdlib.h>
@@ -47,6 +48,61 @@ void CS_UTILS_TEST_CS_ComputeHandler(void *UserObj, UT_EntryKey_t FuncKey, const
     *DoneWithEntry = true;
 }
 
+/* Finishes the entry using up to 3 bytes of the cycle's budget */
+void CS_UTILS_TEST_CS_ComputeBytesHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *BytesRemaining = UT_Hook_GetArgValueByName(Context, "BytesRemaining", uint32 *);
+    bool   *DoneWithEntry  = UT_Hook_GetArgValueByName(Context, "DoneWithEntry", bool *);
+
+    *BytesRemaining -= (*BytesRemaining < 3) ? *BytesRemaining : 3;
+    *DoneWithEntry = true;
+}
+
+/* Checksums part of a Tables entry, leaving the entry unfinished */
+void CS_UTILS_TEST_CS_ComputeTablesPartHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CS_Res_Tables_Table_Entry_t *ResultsEntry =
+        UT_Hook_GetArgValueByName(Context, "ResultsEntry", CS_Res_Tables_Table_Entry_t *);
+
+    ResultsEntry->ByteOffset += 4;
+}
+
+void CS_UTILS_TEST_CS_CalibrateCRCHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *KBytesPerSec = UT_Hook_GetArgValueByName(Context, "KBytesPerSec", uint32 *);
+
+    *KBytesPerSec = 123456;
+}
+
+/* Fills the worker pool when replaying entry ID 2, and puts entry ID 5 back on the queue */
+void CS_UTILS_TEST_CS_ProcessCmdHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const CS_ChildTaskRequest_t *Request = UT_Hook_GetArgValueByName(Context, "BufPtr", const CS_ChildTaskRequest_t *);
+
+    UtAssert_BOOL_TRUE(CS_AppData.StartingQueuedRequest);
+
+    if (Request->EntryCmd.Payload.EntryID == 2)
+    {
+        CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = CS_MAX_RECOMPUTE_WORKERS;
+    }
+    else if (Request->EntryCmd.Payload.EntryID == 5)
+    {
+        /* A one shot that has to wait for the running recomputes */
+        CS_QueueChildTaskRequest(&Request->Buf.Msg, sizeof(CS_EntryCmd_t));
+    }
+}
+
+CFE_ES_ChildTaskMainFuncPtr_t UT_PostedWorkFunc;
+
+void CS_UTILS_TEST_OS_QueuePutHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void *Data = UT_Hook_GetArgValueByName(Context, "data", const void *);
+
+    memcpy(&UT_PostedWorkFunc, Data, sizeof(UT_PostedWorkFunc));
+}
+
+void CS_UTILS_TEST_WorkFunc(void) {}
+
 void CS_ZeroEepromTempValues_Test(void)
 {
     CS_ZeroEepromTempValues();
@@ -234,6 +290,8 @@ void CS_FindEnabledEepromEntry_Test(void)
     CS_AppData.ResEepromTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResEepromTblPtr[CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1, true);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledEepromEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1);
@@ -255,6 +313,8 @@ void CS_FindEnabledMemoryEntry_Test(void)
     CS_AppData.ResMemoryTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResMemoryTblPtr[CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEntryEnabled(CS_MEMORY_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_MEMORY_TABLE, CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1, true);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledMemoryEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1);
@@ -276,6 +336,8 @@ void CS_FindEnabledTablesEntry_Test(void)
     CS_AppData.ResTablesTblPtr[0].State                                   = CS_STATE_ENABLED;
     CS_AppData.ResTablesTblPtr[CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                               = 1;
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_TABLES_TABLE, CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1, true);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledTablesEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1);
@@ -297,6 +359,8 @@ void CS_FindEnabledAppEntry_Test(void)
     CS_AppData.ResAppTblPtr[0].State                                = CS_STATE_ENABLED;
     CS_AppData.ResAppTblPtr[CS_MAX_NUM_APP_TABLE_ENTRIES - 1].State = CS_STATE_ENABLED;
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                         = 1;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_APP_TABLE, CS_MAX_NUM_APP_TABLE_ENTRIES - 1, true);
 
     UtAssert_BOOL_TRUE(CS_FindEnabledAppEntry(&EnabledEntry));
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, CS_MAX_NUM_APP_TABLE_ENTRIES - 1);
@@ -364,6 +428,21 @@ void CS_BackgroundCfeCore_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
 }
 
+void CS_BackgroundCfeCore_Test_Recomputing(void)
+{
+    uint8 Entry;
+
+    /* A recompute worker holds the segment, so it is skipped */
+    CS_AppData.HkPacket.Payload.CfeCoreCSState = CS_STATE_ENABLED;
+    CS_AppData.CfeCoreCodeSeg.State            = CS_STATE_ENABLED;
+    CS_AppData.RecomputeWorkers[1].Table       = CS_CFECORE;
+    CS_AppData.RecomputeWorkers[1].EntryPtr    = &Entry;
+
+    UtAssert_BOOL_FALSE(CS_BackgroundCfeCore());
+    UtAssert_STUB_COUNT(CS_ComputeEepromMemory, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 1);
+}
+
 void CS_BackgroundOS_Test(void)
 {
     /* Entirely disabled */
@@ -398,6 +477,22 @@ void CS_BackgroundOS_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
 }
 
+void CS_BackgroundOS_Test_Recomputing(void)
+{
+    uint8 Entry;
+
+    /* A recompute worker holds the segment, so it is skipped */
+    CS_AppData.HkPacket.Payload.CurrentCSTable = CS_OSCORE;
+    CS_AppData.HkPacket.Payload.OSCSState      = CS_STATE_ENABLED;
+    CS_AppData.OSCodeSeg.State                 = CS_STATE_ENABLED;
+    CS_AppData.RecomputeWorkers[0].Table       = CS_OSCORE;
+    CS_AppData.RecomputeWorkers[0].EntryPtr    = &Entry;
+
+    UtAssert_BOOL_FALSE(CS_BackgroundOS());
+    UtAssert_STUB_COUNT(CS_ComputeEepromMemory, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_OSCORE + 1);
+}
+
 void CS_BackgroundEeprom_Test(void)
 {
     /* Entirely disabled */
@@ -417,6 +512,7 @@ void CS_BackgroundEeprom_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResEepromTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, 0, true);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundEeprom());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EepromCSErrCounter, 1);
@@ -429,6 +525,7 @@ void CS_BackgroundEeprom_Test(void)
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_EEPROM_TABLE_ENTRIES - 1;
     CS_AppData.ResEepromTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
     CS_AppData.ResEepromTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].ComparisonValue = 3;
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, CS_AppData.HkPacket.Payload.CurrentEntryInTable, true);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
     UtAssert_BOOL_TRUE(CS_BackgroundEeprom());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EepromCSErrCounter, 1);
@@ -454,6 +551,7 @@ void CS_BackgroundMemory_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResMemoryTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_MEMORY_TABLE, 0, true);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeEepromMemory), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundMemory());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.MemoryCSErrCounter, 1);
@@ -465,6 +563,7 @@ void CS_BackgroundMemory_Test(void)
     /* Last entry, Enabled, compares, done with entry */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_MEMORY_TABLE_ENTRIES - 1;
     CS_AppData.ResMemoryTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_MEMORY_TABLE, CS_AppData.HkPacket.Payload.CurrentEntryInTable, true);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeEepromMemory), CS_UTILS_TEST_CS_ComputeHandler, NULL);
     UtAssert_BOOL_TRUE(CS_BackgroundMemory());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.MemoryCSErrCounter, 1);
@@ -489,6 +588,7 @@ void CS_BackgroundTables_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResTablesTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 0, true);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeTables), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundTables());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.TablesCSErrCounter, 1);
@@ -509,6 +609,7 @@ void CS_BackgroundTables_Test(void)
     /* Last entry, Enabled, compares, done with entry */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                   = CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1;
     CS_AppData.ResTablesTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_TABLES_TABLE, CS_AppData.HkPacket.Payload.CurrentEntryInTable, true);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeHandler, NULL);
     UtAssert_BOOL_TRUE(CS_BackgroundTables());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.TablesCSErrCounter, 1);
@@ -517,6 +618,44 @@ void CS_BackgroundTables_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
 }
 
+void CS_BackgroundTables_Test_DefTableRecompute(void)
+{
+    CS_AppData.HkPacket.Payload.TablesCSState       = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_TABLES_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 1;
+    CS_AppData.ResTablesTblPtr[1].State             = CS_STATE_ENABLED;
+    CS_AppData.ResTablesTblPtr[2].State             = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 1, true);
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 2, true);
+    CS_AppData.EepResTablesTblPtr = &CS_AppData.ResTablesTblPtr[1];
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeTablesPartHandler, NULL);
+
+    /* The background is part way through the EEPROM definition table's entry */
+    CS_BackgroundTables();
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[1].ByteOffset, 4);
+
+    /* An EEPROM recompute starts, and its worker resets that entry as it changes the definition table */
+    CS_AppData.RecomputeWorkers[0].Table    = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].EntryID  = 0;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &CS_AppData.ResEepromTblPtr[0];
+    CS_ResetTablesTblResultEntry(CS_AppData.EepResTablesTblPtr);
+
+    /* The background leaves the entry alone while the worker runs */
+    CS_BackgroundTables();
+    CS_BackgroundTables();
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[1].ByteOffset, 0);
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[2].ByteOffset, 8);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 2);
+
+    /* The worker restores the definition table and is done, and the next sweep checksums the entry afresh */
+    CS_ResetTablesTblResultEntry(CS_AppData.EepResTablesTblPtr);
+    CS_AppData.RecomputeWorkers[0].EntryPtr         = NULL;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 1;
+    CS_BackgroundTables();
+    UtAssert_UINT32_EQ(CS_AppData.ResTablesTblPtr[1].ByteOffset, 4);
+    UtAssert_STUB_COUNT(CS_ComputeTables, 4);
+}
+
 void CS_BackgroundApp_Test(void)
 {
     /* Entirely disabled */
@@ -533,6 +672,7 @@ void CS_BackgroundApp_Test(void)
 
     /* Enabled, miscompare, not done with entry */
     CS_AppData.ResAppTblPtr[0].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
     UT_SetDeferredRetcode(UT_KEY(CS_ComputeApp), 1, CS_ERROR);
     UtAssert_BOOL_TRUE(CS_BackgroundApp());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.AppCSErrCounter, 1);
@@ -553,6 +693,7 @@ void CS_BackgroundApp_Test(void)
     /* Last entry, Enabled, compares, done with entry */
     CS_AppData.HkPacket.Payload.CurrentEntryInTable                                = CS_MAX_NUM_APP_TABLE_ENTRIES - 1;
     CS_AppData.ResAppTblPtr[CS_AppData.HkPacket.Payload.CurrentEntryInTable].State = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, CS_AppData.HkPacket.Payload.CurrentEntryInTable, true);
     UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeHandler, NULL);
     UtAssert_BOOL_TRUE(CS_BackgroundApp());
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.AppCSErrCounter, 1);
@@ -561,6 +702,61 @@ void CS_BackgroundApp_Test(void)
     UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 3);
 }
 
+void CS_BackgroundApp_Test_CarryBytes(void)
+{
+    CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].State       = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[1].State       = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_APP_TABLE, 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+
+    /* Entry finished with bytes left, not done with cycle */
+    CS_AppData.CycleBytesRemaining               = 10;
+    CS_AppData.TableBytesRemaining[CS_APP_TABLE] = 20;
+    UtAssert_BOOL_FALSE(CS_BackgroundApp());
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 7);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 1);
+
+    /* Entry finished with the budget used up, done with cycle */
+    CS_AppData.CycleBytesRemaining = 2;
+    UtAssert_BOOL_TRUE(CS_BackgroundApp());
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 2);
+}
+
+void CS_BackgroundApp_Test_TableBudget(void)
+{
+    CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].State       = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+
+    /* The type's budget runs out before the cycle's, done with cycle */
+    CS_AppData.CycleBytesRemaining               = 10;
+    CS_AppData.TableBytesRemaining[CS_APP_TABLE] = 2;
+    UtAssert_BOOL_TRUE(CS_BackgroundApp());
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 8);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_APP_TABLE], 0);
+}
+
+void CS_BackgroundApp_Test_RecordVerification(void)
+{
+    uint32 Now = CS_GetCurrentSeconds();
+
+    CS_AppData.HkPacket.Payload.AppCSState  = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].State        = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].MaxStaleness = 10;
+    CS_AppData.ResAppTblPtr[0].VerifiedTime = Now - 100;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+
+    /* An app that is not found counts as verified, late */
+    UT_SetDeferredRetcode(UT_KEY(CS_ComputeApp), 1, CS_ERR_NOT_FOUND);
+    CS_BackgroundApp();
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCount, 1);
+    UtAssert_True(CS_AppData.ResAppTblPtr[0].VerifiedTime >= Now, "VerifiedTime updated");
+}
+
 void CS_ResetTablesTblResultEntry_Test(void)
 {
     CS_Res_Tables_Table_Entry_t ResTablesTbl;
@@ -580,22 +776,24 @@ void CS_ResetTablesTblResultEntry_Test(void)
 
 void CS_HandleRoutineTableUpdates_Test(void)
 {
-    uint16 ChildTaskTable[] = {CS_CFECORE, CS_EEPROM_TABLE, CS_MEMORY_TABLE, CS_APP_TABLE, CS_TABLES_TABLE};
-    uint16 TblMax           = sizeof(ChildTaskTable) / sizeof(ChildTaskTable[0]);
+    uint16 WorkerTable[] = {CS_CFECORE, CS_EEPROM_TABLE, CS_MEMORY_TABLE, CS_APP_TABLE, CS_TABLES_TABLE};
+    uint16 TblMax        = sizeof(WorkerTable) / sizeof(WorkerTable[0]);
     uint16 i;
+    uint8  Entry;
 
-    /* Cycle through each all true case */
+    /* Cycle through each table held by a recompute worker */
     CS_AppData.HkPacket.Payload.RecomputeInProgress = true;
     CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
+    CS_AppData.RecomputeWorkers[0].EntryPtr         = &Entry;
     for (i = 0; i < TblMax; i++)
     {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
+        CS_AppData.RecomputeWorkers[0].Table = WorkerTable[i];
 
         UT_ResetState(UT_KEY(CS_HandleTableUpdate));
         UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
 
         /* Confirm stub call count based on selected table */
-        if (CS_AppData.ChildTaskTable == CS_CFECORE)
+        if (CS_AppData.RecomputeWorkers[0].Table == CS_CFECORE)
         {
             UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
         }
@@ -606,11 +804,23 @@ void CS_HandleRoutineTableUpdates_Test(void)
         UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     }
 
-    /* OneShotInProgress true case will update all */
-    CS_AppData.HkPacket.Payload.OneShotInProgress = true;
+    /* Two workers hold two different tables */
+    CS_AppData.RecomputeWorkers[0].Table    = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[1].Table    = CS_APP_TABLE;
+    CS_AppData.RecomputeWorkers[1].EntryPtr = &Entry;
+    UT_ResetState(UT_KEY(CS_HandleTableUpdate));
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* A one shot does not hold a worker, so all tables update */
+    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
+    CS_AppData.HkPacket.Payload.OneShotInProgress   = true;
+    CS_AppData.RecomputeWorkers[0].EntryPtr         = NULL;
+    CS_AppData.RecomputeWorkers[1].EntryPtr         = NULL;
     for (i = 0; i < TblMax; i++)
     {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
+        CS_AppData.RecomputeWorkers[0].Table = WorkerTable[i];
 
         UT_ResetState(UT_KEY(CS_HandleTableUpdate));
         UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
@@ -618,12 +828,11 @@ void CS_HandleRoutineTableUpdates_Test(void)
         UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     }
 
-    /* Recompute false will update all */
-    CS_AppData.HkPacket.Payload.RecomputeInProgress = false;
-    CS_AppData.HkPacket.Payload.OneShotInProgress   = false;
+    /* Idle workers will update all */
+    CS_AppData.HkPacket.Payload.OneShotInProgress = false;
     for (i = 0; i < TblMax; i++)
     {
-        CS_AppData.ChildTaskTable = ChildTaskTable[i];
+        CS_AppData.RecomputeWorkers[0].Table = WorkerTable[i];
 
         UT_ResetState(UT_KEY(CS_HandleTableUpdate));
         UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), CFE_SUCCESS);
@@ -648,6 +857,20 @@ void CS_HandleRoutineTableUpdates_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
 }
 
+void CS_HandleRoutineTableUpdates_Test_BudgetError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CS_HandleBudgetTableUpdate), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(CS_HandleRoutineTableUpdates(), -1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_HandleTableUpdate, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_UPDATE_BUDGET_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void CS_AttemptTableReshare_Test(void)
 {
     CS_Res_Tables_Table_Entry_t TblEntry;
@@ -705,6 +928,1162 @@ void CS_CheckRecomputeOneShot_Test(void)
     UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CmdErrCounter, 2);
 }
 
+void CS_CalibrateDefaultCRC_Test(void)
+{
+    UT_SetHandlerFunction(UT_KEY(CS_CalibrateCRC), CS_UTILS_TEST_CS_CalibrateCRCHandler, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalibrateCRC), CS_CRC_KERNEL_HARDWARE);
+
+    /* Execute the function being tested */
+    CS_CalibrateDefaultCRC();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CS_CalibrateCRC, 1);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CrcKernel, CS_CRC_KERNEL_HARDWARE);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CrcKernelThroughput, 123456);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_CALIBRATE_CRC_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void CS_CalibrateDefaultCRC_Test_UnknownKernel(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CS_CalibrateCRC), 99);
+
+    /* Execute the function being tested */
+    CS_CalibrateDefaultCRC();
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.CrcKernel, 99);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CrcKernelThroughput, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_CALIBRATE_CRC_INF_EID);
+}
+
+void CS_UpdateBytesPerCycle_Test_Undershoot(void)
+{
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+    CS_AppData.MaxBytesPerCycle                 = 4000;
+
+    /* Execute the function being tested */
+    CS_UpdateBytesPerCycle(800, 4000);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 5000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleOvershootCount, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxCycleOvershoot, 0);
+}
+
+void CS_UpdateBytesPerCycle_Test_Overshoot(void)
+{
+    CS_AppData.HkPacket.Payload.CycleTimeTarget     = 1000;
+    CS_AppData.HkPacket.Payload.CycleOvershootCount = 1;
+    CS_AppData.HkPacket.Payload.MaxCycleOvershoot   = 300;
+    CS_AppData.MaxBytesPerCycle                     = 4000;
+
+    /* Execute the function being tested */
+    CS_UpdateBytesPerCycle(2000, 4000);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 2000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleOvershootCount, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxCycleOvershoot, 1000);
+
+    /* A smaller overshoot is counted but does not change the largest */
+    CS_UpdateBytesPerCycle(1100, 2000);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.CycleOvershootCount, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.MaxCycleOvershoot, 1000);
+}
+
+void CS_UpdateBytesPerCycle_Test_Limits(void)
+{
+    CS_AppData.HkPacket.Payload.CycleTimeTarget = 1000;
+    CS_AppData.MaxBytesPerCycle                 = 4000;
+
+    /* Growth is limited to double per cycle */
+    CS_UpdateBytesPerCycle(10, 4000);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 8000);
+
+    /* A cycle too short to measure doubles */
+    CS_UpdateBytesPerCycle(0, 8000);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, 16000);
+
+    /* Never below the minimum */
+    CS_UpdateBytesPerCycle(100000, 1000);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, CS_MIN_ADAPTIVE_BYTES_PER_CYCLE);
+
+    /* Never above the maximum */
+    CS_UpdateBytesPerCycle(0, CS_MAX_ADAPTIVE_BYTES_PER_CYCLE);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, CS_MAX_ADAPTIVE_BYTES_PER_CYCLE);
+
+    /* A cycle with nothing checksummed leaves the bytes per cycle alone */
+    CS_UpdateBytesPerCycle(500, 0);
+    UtAssert_UINT32_EQ(CS_AppData.MaxBytesPerCycle, CS_MAX_ADAPTIVE_BYTES_PER_CYCLE);
+}
+
+void CS_GetBytesPerCycle_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    CS_AppData.MaxBytesPerCycle = 100;
+
+    /* No table loaded, or zero, uses the shared bytes per cycle */
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_EEPROM_TABLE), 100);
+
+    /* The table itself is not read, only the copy of its budgets */
+    BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE] = 7;
+    CS_AppData.DefBudgetTblPtr               = &BudgetTbl;
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_EEPROM_TABLE), 100);
+
+    /* Budget from the copy */
+    CS_AppData.BytesPerCycleBudget[CS_EEPROM_TABLE]      = 10;
+    CS_AppData.BytesPerCycleBudget[CS_CHILD_TASK_BUDGET] = 500;
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_EEPROM_TABLE), 10);
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_CHILD_TASK_BUDGET), 500);
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_MEMORY_TABLE), 100);
+
+    /* Budget that does not exist */
+    UtAssert_UINT32_EQ(CS_GetBytesPerCycle(CS_NUM_BUDGETS), 100);
+}
+
+void CS_ResetCycleBytes_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_EEPROM_TABLE]        = 10;
+    CS_AppData.DefBudgetTblPtr                      = &BudgetTbl;
+    CS_AppData.BytesPerCycleBudget[CS_EEPROM_TABLE] = 10;
+    CS_AppData.MaxBytesPerCycle                     = 100;
+
+    /* Execute the function being tested */
+    CS_ResetCycleBytes();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesBudget, 100);
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 100);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_CFECORE], 100);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE], 10);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_APP_TABLE], 100);
+}
+
+void CS_ResetCycleBytes_Test_Shared(void)
+{
+    /* Two recomputes and a one shot share the cycle with the background */
+    CS_AppData.MaxBytesPerCycle                      = 100;
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 2;
+    CS_AppData.HkPacket.Payload.OneShotInProgress    = true;
+
+    /* Execute the function being tested */
+    CS_ResetCycleBytes();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesBudget, 25);
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 25);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_APP_TABLE], 100);
+}
+
+void CS_ShareCycleBytes_Test(void)
+{
+    UtAssert_UINT32_EQ(CS_ShareCycleBytes(90), 90);
+
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 2;
+    UtAssert_UINT32_EQ(CS_ShareCycleBytes(90), 30);
+
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 0;
+    CS_AppData.HkPacket.Payload.OneShotInProgress    = true;
+    UtAssert_UINT32_EQ(CS_ShareCycleBytes(90), 45);
+
+    /* The background always keeps a byte of a budget that is not zero */
+    UtAssert_UINT32_EQ(CS_ShareCycleBytes(1), 1);
+    UtAssert_UINT32_EQ(CS_ShareCycleBytes(0), 0);
+}
+
+void CS_UseCycleBytes_Test(void)
+{
+    CS_AppData.CycleBytesRemaining                  = 100;
+    CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE] = 10;
+    CS_AppData.TableBytesRemaining[CS_MEMORY_TABLE] = 1000;
+
+    /* The smaller of the two budgets */
+    UtAssert_UINT32_EQ(CS_GetCycleBytes(CS_EEPROM_TABLE), 10);
+    UtAssert_UINT32_EQ(CS_GetCycleBytes(CS_MEMORY_TABLE), 100);
+
+    /* Bytes left, not done with cycle */
+    UtAssert_BOOL_FALSE(CS_UseCycleBytes(CS_EEPROM_TABLE, 6));
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 96);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE], 6);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_EEPROM_TABLE], 4);
+
+    /* The type's budget used up, done with cycle */
+    UtAssert_BOOL_TRUE(CS_UseCycleBytes(CS_EEPROM_TABLE, 0));
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 90);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_EEPROM_TABLE], 0);
+
+    /* The cycle's budget used up, done with cycle */
+    UtAssert_BOOL_TRUE(CS_UseCycleBytes(CS_MEMORY_TABLE, 0));
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 0);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_MEMORY_TABLE], 910);
+}
+
+void CS_GetLateness_Test(void)
+{
+    /* Overdue */
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_ENABLED, 10, 100, 125), 15);
+
+    /* Not yet overdue */
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_ENABLED, 10, 100, 110), 0);
+
+    /* No maximum staleness, or not enabled */
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_ENABLED, 0, 100, 125), 0);
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_DISABLED, 10, 100, 125), 0);
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_EMPTY, 10, 100, 125), 0);
+
+    /* The clock wrapped since the last verification */
+    UtAssert_UINT32_EQ(CS_GetLateness(CS_STATE_ENABLED, 10, 0xFFFFFFF0, 10), 16);
+}
+
+void CS_RecordVerification_Test(void)
+{
+    uint32 Now          = CS_GetCurrentSeconds();
+    uint32 VerifiedTime = Now - 100;
+
+    /* Late */
+    CS_RecordVerification(&VerifiedTime, 10);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCount, 1);
+    UtAssert_True(VerifiedTime >= Now, "VerifiedTime updated");
+
+    /* In time */
+    CS_RecordVerification(&VerifiedTime, 10);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCount, 1);
+
+    /* No maximum staleness */
+    VerifiedTime = Now - 100;
+    CS_RecordVerification(&VerifiedTime, 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DeadlineMissCount, 1);
+    UtAssert_True(VerifiedTime >= Now, "VerifiedTime updated");
+}
+
+void CS_FindOverdueEntry_Test(void)
+{
+    uint32 Now   = CS_GetCurrentSeconds();
+    uint16 Table = 0;
+    uint16 Entry = 0;
+
+    CS_AppData.HkPacket.Payload.EepromCSState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.MemoryCSState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_DISABLED;
+    CS_AppData.HkPacket.Payload.AppCSState    = CS_STATE_ENABLED;
+
+    /* Nothing overdue */
+    UtAssert_BOOL_FALSE(CS_FindOverdueEntry(&Table, &Entry));
+
+    CS_AppData.ResEepromTblPtr[1].State        = CS_STATE_ENABLED;
+    CS_AppData.ResEepromTblPtr[1].MaxStaleness = 10;
+    CS_AppData.ResEepromTblPtr[1].VerifiedTime = Now - 20;
+
+    CS_AppData.ResAppTblPtr[2].State        = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[2].MaxStaleness = 5;
+    CS_AppData.ResAppTblPtr[2].VerifiedTime = Now - 50;
+
+    /* Later, but the entry is disabled */
+    CS_AppData.ResMemoryTblPtr[0].State        = CS_STATE_DISABLED;
+    CS_AppData.ResMemoryTblPtr[0].MaxStaleness = 5;
+    CS_AppData.ResMemoryTblPtr[0].VerifiedTime = Now - 500;
+
+    /* Later, but the table is disabled */
+    CS_AppData.ResTablesTblPtr[0].State        = CS_STATE_ENABLED;
+    CS_AppData.ResTablesTblPtr[0].MaxStaleness = 5;
+    CS_AppData.ResTablesTblPtr[0].VerifiedTime = Now - 500;
+
+    /* The most overdue entry */
+    UtAssert_BOOL_TRUE(CS_FindOverdueEntry(&Table, &Entry));
+    UtAssert_UINT16_EQ(Table, CS_APP_TABLE);
+    UtAssert_UINT16_EQ(Entry, 2);
+
+    /* The next most overdue once it has been verified */
+    CS_AppData.ResAppTblPtr[2].VerifiedTime = Now;
+    UtAssert_BOOL_TRUE(CS_FindOverdueEntry(&Table, &Entry));
+    UtAssert_UINT16_EQ(Table, CS_EEPROM_TABLE);
+    UtAssert_UINT16_EQ(Entry, 1);
+}
+
+void CS_FindOverdueEntry_Test_Recomputing(void)
+{
+    uint32 Now   = CS_GetCurrentSeconds();
+    uint16 Table = 0;
+    uint16 Entry = 0;
+    uint8  Held;
+
+    CS_AppData.HkPacket.Payload.MemoryCSState = CS_STATE_ENABLED;
+
+    CS_AppData.ResMemoryTblPtr[1].State        = CS_STATE_ENABLED;
+    CS_AppData.ResMemoryTblPtr[1].MaxStaleness = 10;
+    CS_AppData.ResMemoryTblPtr[1].VerifiedTime = Now - 100;
+
+    CS_AppData.ResMemoryTblPtr[2].State        = CS_STATE_ENABLED;
+    CS_AppData.ResMemoryTblPtr[2].MaxStaleness = 10;
+    CS_AppData.ResMemoryTblPtr[2].VerifiedTime = Now - 20;
+
+    /* The most overdue entry is being recomputed, so the next one is picked */
+    CS_AppData.RecomputeWorkers[0].Table    = CS_MEMORY_TABLE;
+    CS_AppData.RecomputeWorkers[0].EntryID  = 1;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &Held;
+
+    UtAssert_BOOL_TRUE(CS_FindOverdueEntry(&Table, &Entry));
+    UtAssert_UINT16_EQ(Table, CS_MEMORY_TABLE);
+    UtAssert_UINT16_EQ(Entry, 2);
+}
+
+void CS_BackgroundEntry_Test(void)
+{
+    uint16 Entry     = 2;
+    bool   TableDone = false;
+
+    CS_AppData.HkPacket.Payload.CurrentCSTable      = CS_MEMORY_TABLE;
+    CS_AppData.HkPacket.Payload.CurrentEntryInTable = 3;
+    CS_AppData.HkPacket.Payload.PassCounter         = 7;
+
+    /* The entry's table moves on to the next table, the sweep does not */
+    CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_DISABLED;
+    UtAssert_BOOL_FALSE(CS_BackgroundEntry(CS_APP_TABLE, &Entry, &TableDone));
+    UtAssert_UINT16_EQ(Entry, 0);
+    UtAssert_BOOL_TRUE(TableDone);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentEntryInTable, 3);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 7);
+
+    /* Entry done with more of the table to go */
+    Entry                                        = 1;
+    CS_AppData.HkPacket.Payload.AppCSState       = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[1].State             = CS_STATE_ENABLED;
+    CS_AppData.CycleBytesRemaining               = 10;
+    CS_AppData.TableBytesRemaining[CS_APP_TABLE] = 10;
+    CS_SetEntryEnabled(CS_APP_TABLE, 1, true);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+    UtAssert_BOOL_FALSE(CS_BackgroundEntry(CS_APP_TABLE, &Entry, &TableDone));
+    UtAssert_UINT16_EQ(Entry, 2);
+    UtAssert_BOOL_FALSE(TableDone);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+
+    /* Not a checksum type */
+    UtAssert_BOOL_TRUE(CS_BackgroundEntry(CS_NUM_TABLES, &Entry, &TableDone));
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, CS_MEMORY_TABLE);
+}
+
+void CS_GetWeightedQuantum_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    CS_AppData.MaxBytesPerCycle = 600;
+
+    /* No table, equal shares */
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_TABLES_TABLE), 100);
+
+    /* No weights, equal shares */
+    CS_AppData.DefBudgetTblPtr = &BudgetTbl;
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_CFECORE), 100);
+
+    /* Shares by weight */
+    BudgetTbl.Weight[CS_TABLES_TABLE] = 5;
+    BudgetTbl.Weight[CS_APP_TABLE]    = 3;
+    BudgetTbl.Weight[CS_CFECORE]      = 1;
+    BudgetTbl.Weight[CS_OSCORE]       = 1;
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_TABLES_TABLE), 300);
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_APP_TABLE), 180);
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_OSCORE), 60);
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_EEPROM_TABLE), 0);
+
+    /* A tiny share is still at least a byte */
+    CS_AppData.MaxBytesPerCycle = 4;
+    UtAssert_UINT32_EQ(CS_GetWeightedQuantum(CS_OSCORE), 1);
+}
+
+void CS_BackgroundWeighted_Test(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+    uint16                Loop;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.Weight[CS_TABLES_TABLE] = 1;
+    BudgetTbl.Weight[CS_APP_TABLE]    = 2;
+    CS_AppData.DefBudgetTblPtr        = &BudgetTbl;
+    CS_AppData.MaxBytesPerCycle       = 9;
+
+    CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.AppCSState    = CS_STATE_ENABLED;
+    for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
+    {
+        CS_AppData.ResTablesTblPtr[Loop].State = CS_STATE_ENABLED;
+        CS_SetEntryEnabled(CS_TABLES_TABLE, Loop, true);
+    }
+    for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
+    {
+        CS_AppData.ResAppTblPtr[Loop].State = CS_STATE_ENABLED;
+        CS_SetEntryEnabled(CS_APP_TABLE, Loop, true);
+    }
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+
+    /* Each cycle shares its bytes 1:2, skipping the types with no weight */
+    for (Loop = 0; Loop < 4; Loop++)
+    {
+        CS_ResetCycleBytes();
+        while (CS_BackgroundWeighted() == false)
+        {
+        }
+    }
+
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_TABLES_TABLE], 12);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_APP_TABLE], 24);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_CFECORE], 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_TABLES_TABLE], 4);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE], 8);
+    UtAssert_STUB_COUNT(CS_ComputeEepromMemory, 0);
+}
+
+void CS_BackgroundWeighted_Test_PassDone(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.Weight[CS_APP_TABLE] = 1;
+    CS_AppData.DefBudgetTblPtr     = &BudgetTbl;
+    CS_AppData.MaxBytesPerCycle    = 60;
+    CS_ResetCycleBytes();
+
+    /* The disabled type with weight goes through its table, and the types
+       with no weight do not hold up the pass */
+    UtAssert_BOOL_FALSE(CS_BackgroundWeighted());
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 1);
+    UtAssert_UINT16_EQ(CS_AppData.CategoriesDone, 0);
+}
+
+void CS_BackgroundWeighted_Test_NothingEnabled(void)
+{
+    CS_AppData.MaxBytesPerCycle = 60;
+    CS_ResetCycleBytes();
+
+    /* Every type is asked once, then the cycle is left with its bytes */
+    UtAssert_BOOL_FALSE(CS_BackgroundWeighted());
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 60);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCategory, 0);
+}
+
+void CS_BackgroundWeighted_Test_TableBudget(void)
+{
+    CS_Def_Budget_Table_t BudgetTbl;
+
+    memset(&BudgetTbl, 0, sizeof(BudgetTbl));
+
+    BudgetTbl.BytesPerCycle[CS_APP_TABLE]        = 2;
+    BudgetTbl.Weight[CS_APP_TABLE]               = 1;
+    CS_AppData.DefBudgetTblPtr                   = &BudgetTbl;
+    CS_AppData.BytesPerCycleBudget[CS_APP_TABLE] = 2;
+    CS_AppData.MaxBytesPerCycle                  = 60;
+    CS_AppData.HkPacket.Payload.CurrentCategory  = CS_APP_TABLE;
+
+    CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[0].State       = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+    CS_ResetCycleBytes();
+
+    /* The type's own budget limits the chunk, and its turn waits for the next cycle */
+    UtAssert_BOOL_FALSE(CS_BackgroundWeighted());
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_APP_TABLE], 2);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_APP_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.Deficit[CS_APP_TABLE], 58);
+
+    UtAssert_BOOL_FALSE(CS_BackgroundWeighted());
+    UtAssert_UINT32_EQ(CS_AppData.Deficit[CS_APP_TABLE], 58);
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 58);
+}
+
+void CS_BackgroundChunk_Test(void)
+{
+    CS_AppData.HkPacket.Payload.AppCSState = CS_STATE_ENABLED;
+    CS_AppData.ResAppTblPtr[2].State       = CS_STATE_ENABLED;
+    CS_SetEntryEnabled(CS_APP_TABLE, 2, true);
+
+    CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE] = 2;
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+
+    CS_AppData.MaxBytesPerCycle = 60;
+    CS_ResetCycleBytes();
+
+    /* The chunk limits the bytes, and the cursor moves on */
+    UtAssert_UINT32_EQ(CS_BackgroundChunk(CS_APP_TABLE, 3), 3);
+    UtAssert_UINT32_EQ(CS_AppData.TableBytesRemaining[CS_APP_TABLE], 57);
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 57);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE], 3);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 0);
+
+    /* No budget left for the type */
+    CS_AppData.TableBytesRemaining[CS_APP_TABLE] = 0;
+    UtAssert_UINT32_EQ(CS_BackgroundChunk(CS_APP_TABLE, 3), 0);
+    UtAssert_STUB_COUNT(CS_ComputeApp, 1);
+}
+
+void CS_BackgroundInterleaved_Test(void)
+{
+    uint16 Loop;
+
+    CS_AppData.MaxBytesPerCycle = 6;
+
+    CS_AppData.HkPacket.Payload.TablesCSState = CS_STATE_ENABLED;
+    CS_AppData.HkPacket.Payload.AppCSState    = CS_STATE_ENABLED;
+    for (Loop = 0; Loop < CS_MAX_NUM_TABLES_TABLE_ENTRIES; Loop++)
+    {
+        CS_AppData.ResTablesTblPtr[Loop].State = CS_STATE_ENABLED;
+        CS_SetEntryEnabled(CS_TABLES_TABLE, Loop, true);
+    }
+    for (Loop = 0; Loop < CS_MAX_NUM_APP_TABLE_ENTRIES; Loop++)
+    {
+        CS_AppData.ResAppTblPtr[Loop].State = CS_STATE_ENABLED;
+        CS_SetEntryEnabled(CS_APP_TABLE, Loop, true);
+    }
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeTables), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_ComputeApp), CS_UTILS_TEST_CS_ComputeBytesHandler, NULL);
+
+    /* The enabled types take turns, one entry each, with the rest skipped */
+    CS_ResetCycleBytes();
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCategory, CS_TABLES_TABLE + 1);
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCategory, (CS_APP_TABLE + 1) % CS_NUM_TABLES);
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCategory, CS_TABLES_TABLE + 1);
+
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_TABLES_TABLE], 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.BytesChecked[CS_APP_TABLE], 1);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_TABLES_TABLE], 2);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE], 1);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCSTable, 0);
+
+    /* Only the disabled types are through their tables, so the pass goes on */
+    UtAssert_UINT16_EQ(CS_AppData.CategoriesDone,
+                       (1 << CS_CFECORE) | (1 << CS_OSCORE) | (1 << CS_EEPROM_TABLE) | (1 << CS_MEMORY_TABLE));
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 0);
+
+    /* The pass is done once the enabled types finish their tables too */
+    CS_AppData.HkPacket.Payload.EntryCursor[CS_TABLES_TABLE] = CS_MAX_NUM_TABLES_TABLE_ENTRIES - 1;
+    CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE]    = CS_MAX_NUM_APP_TABLE_ENTRIES - 1;
+    CS_ResetCycleBytes();
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_TABLES_TABLE], 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.EntryCursor[CS_APP_TABLE], 0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 1);
+}
+
+void CS_CategoryPassDone_Test(void)
+{
+    uint16 Loop;
+
+    for (Loop = 0; Loop < CS_NUM_TABLES - 1; Loop++)
+    {
+        CS_CategoryPassDone(Loop);
+    }
+
+    /* A type counted twice does not finish the pass */
+    CS_CategoryPassDone(0);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 0);
+
+    CS_CategoryPassDone(CS_NUM_TABLES - 1);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.PassCounter, 1);
+    UtAssert_UINT16_EQ(CS_AppData.CategoriesDone, 0);
+}
+
+void CS_BackgroundInterleaved_Test_NothingEnabled(void)
+{
+    CS_AppData.MaxBytesPerCycle                 = 3;
+    CS_AppData.HkPacket.Payload.CurrentCategory = CS_APP_TABLE;
+    CS_ResetCycleBytes();
+
+    /* Every type gets its turn once, and a tiny cycle still makes a chunk of one byte */
+    UtAssert_BOOL_FALSE(CS_BackgroundInterleaved());
+    UtAssert_UINT32_EQ(CS_AppData.CycleBytesRemaining, 3);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.CurrentCategory, CS_APP_TABLE);
+}
+
+void CS_GetEnabledMap_Test(void)
+{
+    uint16 NumEntries = 1;
+
+    UtAssert_ADDRESS_EQ(CS_GetEnabledMap(CS_EEPROM_TABLE, &NumEntries), CS_AppData.EepromEnabledMap);
+    UtAssert_UINT16_EQ(NumEntries, CS_MAX_NUM_EEPROM_TABLE_ENTRIES);
+    UtAssert_ADDRESS_EQ(CS_GetEnabledMap(CS_MEMORY_TABLE, &NumEntries), CS_AppData.MemoryEnabledMap);
+    UtAssert_UINT16_EQ(NumEntries, CS_MAX_NUM_MEMORY_TABLE_ENTRIES);
+    UtAssert_ADDRESS_EQ(CS_GetEnabledMap(CS_TABLES_TABLE, &NumEntries), CS_AppData.TablesEnabledMap);
+    UtAssert_UINT16_EQ(NumEntries, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+    UtAssert_ADDRESS_EQ(CS_GetEnabledMap(CS_APP_TABLE, &NumEntries), CS_AppData.AppEnabledMap);
+    UtAssert_UINT16_EQ(NumEntries, CS_MAX_NUM_APP_TABLE_ENTRIES);
+
+    UtAssert_NULL(CS_GetEnabledMap(CS_OSCORE, &NumEntries));
+    UtAssert_UINT16_EQ(NumEntries, 0);
+}
+
+void CS_SetEntryEnabled_Test(void)
+{
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, true);
+    CS_SetEntryEnabled(CS_APP_TABLE, 5, true);
+    UtAssert_UINT32_EQ(CS_AppData.AppEnabledMap[0], 0x21);
+
+    CS_SetEntryEnabled(CS_APP_TABLE, 0, false);
+    UtAssert_UINT32_EQ(CS_AppData.AppEnabledMap[0], 0x20);
+
+    /* Out of range entries and types without a map are ignored */
+    CS_SetEntryEnabled(CS_APP_TABLE, CS_MAX_NUM_APP_TABLE_ENTRIES, true);
+    CS_SetEntryEnabled(CS_CFECORE, 0, true);
+    UtAssert_UINT32_EQ(CS_AppData.AppEnabledMap[0], 0x20);
+    UtAssert_UINT32_EQ(CS_AppData.EepromEnabledMap[0], 0);
+}
+
+void CS_FirstSetBit_Test(void)
+{
+    UtAssert_UINT16_EQ(CS_FirstSetBit(1), 0);
+    UtAssert_UINT16_EQ(CS_FirstSetBit(0x00F0), 4);
+    UtAssert_UINT16_EQ(CS_FirstSetBit(0x80000000), 31);
+}
+
+void CS_FindNextEnabledEntry_Test(void)
+{
+    uint16 Entry = 0;
+
+    /* Nothing enabled */
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 3, true);
+    CS_SetEntryEnabled(CS_TABLES_TABLE, 9, true);
+
+    /* From before, at and past an enabled entry */
+    Entry = 0;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 3);
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 3);
+    Entry = 4;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 9);
+    Entry = 10;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+
+    /* Starting past the table, or in a type without entries */
+    Entry = CS_MAX_NUM_TABLES_TABLE_ENTRIES + 1;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledEntry(CS_TABLES_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, CS_MAX_NUM_TABLES_TABLE_ENTRIES);
+    Entry = 0;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledEntry(CS_OSCORE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 0);
+}
+
+void CS_FindNextEnabledEntry_Test_Recomputing(void)
+{
+    uint16 Entry = 0;
+    uint8  Held[2];
+
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, 2, true);
+    CS_SetEntryEnabled(CS_EEPROM_TABLE, 5, true);
+
+    /* Entries held by a recompute worker are passed over */
+    CS_AppData.RecomputeWorkers[0].Table    = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[0].EntryID  = 2;
+    CS_AppData.RecomputeWorkers[0].EntryPtr = &Held[0];
+
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledEntry(CS_EEPROM_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 5);
+
+    /* With every enabled entry held, the index ends up past the table */
+    CS_AppData.RecomputeWorkers[1].Table    = CS_EEPROM_TABLE;
+    CS_AppData.RecomputeWorkers[1].EntryID  = 5;
+    CS_AppData.RecomputeWorkers[1].EntryPtr = &Held[1];
+
+    Entry = 0;
+    UtAssert_BOOL_FALSE(CS_FindNextEnabledEntry(CS_EEPROM_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, CS_MAX_NUM_EEPROM_TABLE_ENTRIES);
+
+    /* The same entry in another table is not held */
+    CS_SetEntryEnabled(CS_MEMORY_TABLE, 2, true);
+
+    Entry = 0;
+    UtAssert_BOOL_TRUE(CS_FindNextEnabledEntry(CS_MEMORY_TABLE, &Entry));
+    UtAssert_UINT16_EQ(Entry, 2);
+}
+
+void CS_ChildTaskIsFree_Test(void)
+{
+    UtAssert_BOOL_TRUE(CS_ChildTaskIsFree());
+
+    /* A worker is still free while one recompute runs */
+    CS_AppData.HkPacket.Payload.RecomputeInProgress  = true;
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = CS_MAX_RECOMPUTE_WORKERS - 1;
+    UtAssert_BOOL_TRUE(CS_ChildTaskIsFree());
+
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = CS_MAX_RECOMPUTE_WORKERS;
+    UtAssert_BOOL_FALSE(CS_ChildTaskIsFree());
+
+    CS_AppData.HkPacket.Payload.RecomputeInProgress  = false;
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 0;
+    CS_AppData.HkPacket.Payload.OneShotInProgress    = true;
+    UtAssert_BOOL_FALSE(CS_ChildTaskIsFree());
+
+    /* A new request waits behind the queued ones, but the one being started does not */
+    CS_AppData.HkPacket.Payload.OneShotInProgress = false;
+    CS_AppData.HkPacket.Payload.RequestQueueDepth = 1;
+    UtAssert_BOOL_FALSE(CS_ChildTaskIsFree());
+
+    CS_AppData.StartingQueuedRequest = true;
+    UtAssert_BOOL_TRUE(CS_ChildTaskIsFree());
+}
+
+void CS_QueueChildTaskRequest_Test(void)
+{
+    CS_EntryCmd_t CmdPacket;
+
+    memset(&CmdPacket, 0, sizeof(CmdPacket));
+    CmdPacket.Payload.EntryID = 7;
+
+    /* The tail wraps around to the start of the queue */
+    CS_AppData.RequestQueueHead = CS_MAX_QUEUED_REQUESTS - 1;
+
+    UtAssert_BOOL_TRUE(CS_QueueChildTaskRequest(&CmdPacket.CmdHeader.Msg, sizeof(CmdPacket)));
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueue[CS_MAX_QUEUED_REQUESTS - 1].EntryCmd.Payload.EntryID, 7);
+
+    CmdPacket.Payload.EntryID = 8;
+
+    UtAssert_BOOL_TRUE(CS_QueueChildTaskRequest(&CmdPacket.CmdHeader.Msg, sizeof(CmdPacket)));
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueue[0].EntryCmd.Payload.EntryID, 8);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.RequestQueueDepth, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.QueuedRequestCount, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, CS_REQUEST_QUEUED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_DEBUG);
+
+    /* With the queue full the request is dropped */
+    CS_AppData.HkPacket.Payload.RequestQueueDepth = CS_MAX_QUEUED_REQUESTS;
+
+    UtAssert_BOOL_FALSE(CS_QueueChildTaskRequest(&CmdPacket.CmdHeader.Msg, sizeof(CmdPacket)));
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.RequestQueueDepth, CS_MAX_QUEUED_REQUESTS);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.QueuedRequestCount, 2);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.DroppedRequestCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void CS_StartQueuedRequests_Test(void)
+{
+    uint16 Loop;
+
+    for (Loop = 0; Loop < 3; Loop++)
+    {
+        CS_AppData.RequestQueue[Loop].EntryCmd.Payload.EntryID = Loop + 1;
+    }
+
+    CS_AppData.HkPacket.Payload.RequestQueueDepth = 3;
+
+    UT_SetHandlerFunction(UT_KEY(CS_ProcessCmd), CS_UTILS_TEST_CS_ProcessCmdHandler, NULL);
+
+    /* The first request fails to start, so the second one follows at once */
+    CS_StartQueuedRequests();
+
+    UtAssert_STUB_COUNT(CS_ProcessCmd, 2);
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueueHead, 2);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.RequestQueueDepth, 1);
+    UtAssert_BOOL_FALSE(CS_AppData.StartingQueuedRequest);
+
+    /* Nothing starts while the child task is in use */
+    CS_StartQueuedRequests();
+
+    UtAssert_STUB_COUNT(CS_ProcessCmd, 2);
+
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 0;
+
+    CS_StartQueuedRequests();
+
+    UtAssert_STUB_COUNT(CS_ProcessCmd, 3);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.RequestQueueDepth, 0);
+}
+
+void CS_StartQueuedRequests_Test_PutBack(void)
+{
+    CS_AppData.RequestQueue[0].EntryCmd.Payload.EntryID = 5;
+    CS_AppData.RequestQueue[1].EntryCmd.Payload.EntryID = 6;
+
+    CS_AppData.HkPacket.Payload.RequestQueueDepth = 2;
+
+    UT_SetHandlerFunction(UT_KEY(CS_ProcessCmd), CS_UTILS_TEST_CS_ProcessCmdHandler, NULL);
+
+    /* The request put back stays at the head and nothing behind it starts */
+    CS_StartQueuedRequests();
+
+    UtAssert_STUB_COUNT(CS_ProcessCmd, 1);
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueueHead, 0);
+    UtAssert_UINT16_EQ(CS_AppData.HkPacket.Payload.RequestQueueDepth, 2);
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueue[0].EntryCmd.Payload.EntryID, 5);
+    UtAssert_UINT16_EQ(CS_AppData.RequestQueue[1].EntryCmd.Payload.EntryID, 6);
+    UtAssert_UINT32_EQ(CS_AppData.HkPacket.Payload.QueuedRequestCount, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.StartingQueuedRequest);
+}
+
+void CS_StartRecomputeWorker_Test_Nominal(void)
+{
+    uint8 Entry[2];
+
+    UT_PostedWorkFunc = NULL;
+
+    /* Worker 0 already holds another entry */
+    CS_AppData.RecomputeWorkers[0].EntryPtr          = &Entry[0];
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 1;
+
+    UT_SetHandlerFunction(UT_KEY(OS_QueuePut), CS_UTILS_TEST_OS_QueuePutHandler, NULL);
+
+    UtAssert_INT32_EQ(CS_StartRecomputeWorker(CS_EEPROM_TABLE, 3, &Entry[1], CS_UTILS_TEST_WorkFunc), CFE_SUCCESS);
+
+    UtAssert_UINT16_EQ(CS_AppData.RecomputeWorkers[1].Table, CS_EEPROM_TABLE);
+    UtAssert_UINT16_EQ(CS_AppData.RecomputeWorkers[1].EntryID, 3);
+    UtAssert_ADDRESS_EQ(CS_AppData.RecomputeWorkers[1].EntryPtr, &Entry[1]);
+
+    /* The work goes to the worker task created at startup, no task is created here */
+    UtAssert_STUB_COUNT(OS_QueuePut, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_ADDRESS_EQ(UT_PostedWorkFunc, CS_UTILS_TEST_WorkFunc);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 2);
+    UtAssert_BOOL_TRUE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_StartRecomputeWorker_Test_EntryLocked(void)
+{
+    uint8 Entry;
+
+    CS_AppData.RecomputeWorkers[1].EntryPtr          = &Entry;
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 1;
+
+    UtAssert_INT32_EQ(CS_StartRecomputeWorker(CS_MEMORY_TABLE, 2, &Entry, NULL), CS_ENTRY_LOCKED);
+
+    UtAssert_ADDRESS_EQ(CS_AppData.RecomputeWorkers[0].EntryPtr, NULL);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, CS_RECOMPUTE_ENTRY_LOCKED_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void CS_StartRecomputeWorker_Test_NoneFree(void)
+{
+    uint8  Entry[CS_MAX_RECOMPUTE_WORKERS + 1];
+    uint16 i;
+
+    for (i = 0; i < CS_MAX_RECOMPUTE_WORKERS; i++)
+    {
+        CS_AppData.RecomputeWorkers[i].EntryPtr = &Entry[i];
+    }
+
+    UtAssert_INT32_EQ(CS_StartRecomputeWorker(CS_APP_TABLE, 0, &Entry[CS_MAX_RECOMPUTE_WORKERS], NULL), CS_ERROR);
+
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void CS_StartRecomputeWorker_Test_PostWorkError(void)
+{
+    uint8           Entry;
+    CFE_ES_TaskId_t TaskID = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(5));
+
+    CS_AppData.RecomputeWorkers[0].TaskID = TaskID;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_ERROR);
+
+    UtAssert_INT32_EQ(CS_StartRecomputeWorker(CS_TABLES_TABLE, 1, &Entry, NULL), OS_ERROR);
+
+    /* The worker task keeps running and waits for the next request */
+    UtAssert_ADDRESS_EQ(CS_AppData.RecomputeWorkers[0].EntryPtr, NULL);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(CS_AppData.RecomputeWorkers[0].TaskID, TaskID));
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void CS_PostWork_Test(void)
+{
+    UT_PostedWorkFunc = NULL;
+
+    UT_SetHandlerFunction(UT_KEY(OS_QueuePut), CS_UTILS_TEST_OS_QueuePutHandler, NULL);
+
+    UtAssert_INT32_EQ(CS_PostWork(CS_AppData.OneShotQueueID, CS_UTILS_TEST_WorkFunc), CFE_SUCCESS);
+    UtAssert_ADDRESS_EQ(UT_PostedWorkFunc, CS_UTILS_TEST_WorkFunc);
+
+    /* The OSAL error is handed back to the command */
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+
+    UtAssert_INT32_EQ(CS_PostWork(CS_AppData.OneShotQueueID, CS_UTILS_TEST_WorkFunc), OS_QUEUE_FULL);
+    UtAssert_STUB_COUNT(OS_QueuePut, 2);
+}
+
+void CS_FindWorkerQueue_Test(void)
+{
+    CFE_ES_TaskId_t OneShotTaskID = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(5));
+    CFE_ES_TaskId_t WorkerTaskID  = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(6));
+    CFE_ES_TaskId_t OtherTaskID   = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(7));
+    CFE_ES_TaskId_t SubRangeID    = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(8));
+
+    CS_AppData.ChildTaskID                                                = OneShotTaskID;
+    CS_AppData.OneShotQueueID                                             = OS_ObjectIdFromInteger(10);
+    CS_AppData.RecomputeWorkers[1].TaskID                                 = WorkerTaskID;
+    CS_AppData.RecomputeWorkers[1].QueueID                                = OS_ObjectIdFromInteger(11);
+    CS_AppData.RecomputeWorkers[1].SubRangeTaskID[CS_NUM_SUB_RANGES - 1]  = SubRangeID;
+    CS_AppData.RecomputeWorkers[1].SubRangeQueueID[CS_NUM_SUB_RANGES - 1] = OS_ObjectIdFromInteger(12);
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &OneShotTaskID, sizeof(OneShotTaskID), false);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(CS_FindWorkerQueue(), CS_AppData.OneShotQueueID));
+
+    /* A worker finds its queue whether or not it has work */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &WorkerTaskID, sizeof(WorkerTaskID), false);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(CS_FindWorkerQueue(), CS_AppData.RecomputeWorkers[1].QueueID));
+
+    /* So does each of its sub-range tasks */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &SubRangeID, sizeof(SubRangeID), false);
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(CS_FindWorkerQueue(),
+                                        CS_AppData.RecomputeWorkers[1].SubRangeQueueID[CS_NUM_SUB_RANGES - 1]));
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &OtherTaskID, sizeof(OtherTaskID), false);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CS_FindWorkerQueue()));
+
+    UtAssert_STUB_COUNT(OS_MutSemTake, 4);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 4);
+}
+
+void CS_FindRecomputeWorker_Test(void)
+{
+    CFE_ES_TaskId_t TaskID = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(5));
+    uint8           Entry;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskID, sizeof(TaskID), false);
+
+    CS_AppData.RecomputeWorkers[1].TaskID   = TaskID;
+    CS_AppData.RecomputeWorkers[1].EntryPtr = &Entry;
+
+    UtAssert_UINT16_EQ(CS_FindRecomputeWorker(), 1);
+
+    /* A free slot is never matched */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskID, sizeof(TaskID), false);
+    CS_AppData.RecomputeWorkers[1].EntryPtr = NULL;
+
+    UtAssert_UINT16_EQ(CS_FindRecomputeWorker(), CS_MAX_RECOMPUTE_WORKERS);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void CS_ReleaseRecomputeWorker_Test(void)
+{
+    uint8 Entry[2];
+
+    CS_AppData.RecomputeWorkers[0].EntryPtr          = &Entry[0];
+    CS_AppData.RecomputeWorkers[1].EntryPtr          = &Entry[1];
+    CS_AppData.HkPacket.Payload.RecomputeWorkersBusy = 2;
+    CS_AppData.HkPacket.Payload.RecomputeInProgress  = true;
+
+    /* Recompute stays in progress while another worker is busy */
+    CS_ReleaseRecomputeWorker(0);
+
+    UtAssert_ADDRESS_EQ(CS_AppData.RecomputeWorkers[0].EntryPtr, NULL);
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 1);
+    UtAssert_BOOL_TRUE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+
+    CS_ReleaseRecomputeWorker(1);
+
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 0);
+    UtAssert_BOOL_FALSE(CS_AppData.HkPacket.Payload.RecomputeInProgress);
+
+    /* Releasing a free slot or an unknown worker changes nothing */
+    CS_ReleaseRecomputeWorker(1);
+    CS_ReleaseRecomputeWorker(CS_MAX_RECOMPUTE_WORKERS);
+
+    UtAssert_UINT8_EQ(CS_AppData.HkPacket.Payload.RecomputeWorkersBusy, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 4);
+}
+
+void CS_ResetRecomputeDefTableEntry_Test(void)
+{
+    CS_Res_Tables_Table_Entry_t ResTablesTbl;
+
+    memset(&ResTablesTbl, 0xFF, sizeof(ResTablesTbl));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(CS_ResetRecomputeDefTableEntry(&ResTablesTbl, CS_AppData.DefAppTableHandle));
+
+    /* Verify results, the entry is reset under the mutex */
+    UtAssert_UINT32_EQ(ResTablesTbl.ByteOffset, 0);
+    UtAssert_UINT32_EQ(ResTablesTbl.TempChecksumValue, 0);
+    UtAssert_BOOL_FALSE(ResTablesTbl.ComputedYet);
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+
+    /* A definition table not listed in the Tables table is only marked modified */
+    UtAssert_VOIDCALL(CS_ResetRecomputeDefTableEntry(NULL, CS_AppData.DefAppTableHandle));
+
+    UtAssert_STUB_COUNT(CFE_TBL_Modified, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void CS_StartSubRangeTask_Test_Nominal(void)
+{
+    UT_PostedWorkFunc = NULL;
+
+    UT_SetHandlerFunction(UT_KEY(OS_QueuePut), CS_UTILS_TEST_OS_QueuePutHandler, NULL);
+
+    CS_AppData.RecomputeWorkers[1].SubRangeBusyMask   = 2;
+    CS_AppData.RecomputeWorkers[1].SubRangeQueueID[0] = OS_ObjectIdFromInteger(12);
+
+    UtAssert_INT32_EQ(CS_StartSubRangeTask(1, 0, CS_UTILS_TEST_WorkFunc), CFE_SUCCESS);
+
+    /* The work goes to the sub-range task created at startup, no task is created */
+    UtAssert_ADDRESS_EQ(UT_PostedWorkFunc, CS_UTILS_TEST_WorkFunc);
+    UtAssert_UINT32_EQ(CS_AppData.RecomputeWorkers[1].SubRangeBusyMask, 3);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void CS_StartSubRangeTask_Test_PostWorkError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_QueuePut), 1, OS_QUEUE_FULL);
+
+    CS_AppData.RecomputeWorkers[0].SubRangeBusyMask   = 2;
+    CS_AppData.RecomputeWorkers[0].SubRangeQueueID[0] = OS_ObjectIdFromInteger(12);
+
+    UtAssert_INT32_EQ(CS_StartSubRangeTask(0, 0, CS_UTILS_TEST_WorkFunc), OS_QUEUE_FULL);
+
+    UtAssert_UINT32_EQ(CS_AppData.RecomputeWorkers[0].SubRangeBusyMask, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void CS_StartSubRangeTask_Test_NoTask(void)
+{
+    /* The sub-range task was not created at startup, so the worker does the sub-range */
+    UtAssert_INT32_EQ(CS_StartSubRangeTask(0, 0, CS_UTILS_TEST_WorkFunc), CS_ERROR);
+
+    UtAssert_UINT32_EQ(CS_AppData.RecomputeWorkers[0].SubRangeBusyMask, 0);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void CS_FindSubRangeTask_Test(void)
+{
+    CFE_ES_TaskId_t TaskID   = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(5));
+    uint16          WorkerID = 0;
+    uint16          SubRange = 0;
+    uint8           Entry;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskID, sizeof(TaskID), false);
+
+    CS_AppData.RecomputeWorkers[1].EntryPtr                              = &Entry;
+    CS_AppData.RecomputeWorkers[1].SubRangeTaskID[CS_NUM_SUB_RANGES - 1] = TaskID;
+
+    /* The task has no work until its sub-range is busy */
+    UtAssert_BOOL_FALSE(CS_FindSubRangeTask(&WorkerID, &SubRange));
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskID, sizeof(TaskID), false);
+    CS_AppData.RecomputeWorkers[1].SubRangeBusyMask = (uint32)1 << (CS_NUM_SUB_RANGES - 1);
+
+    UtAssert_BOOL_TRUE(CS_FindSubRangeTask(&WorkerID, &SubRange));
+    UtAssert_UINT16_EQ(WorkerID, 1);
+    UtAssert_UINT16_EQ(SubRange, CS_NUM_SUB_RANGES - 1);
+
+    /* A free worker is never matched */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskID, sizeof(TaskID), false);
+    CS_AppData.RecomputeWorkers[1].EntryPtr = NULL;
+
+    UtAssert_BOOL_FALSE(CS_FindSubRangeTask(&WorkerID, &SubRange));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void CS_FinishSubRange_Test(void)
+{
+    CS_Res_EepromMemory_Table_Entry_t ResultsEntry;
+
+    memset(&ResultsEntry, 0, sizeof(ResultsEntry));
+
+    ResultsEntry.SubRangeMask = 1;
+
+    CS_AppData.RecomputeWorkers[1].EntryPtr         = &ResultsEntry;
+    CS_AppData.RecomputeWorkers[1].SubRangeBusyMask = 1 | ((uint32)1 << (CS_NUM_SUB_RANGES - 1));
+
+    CS_FinishSubRange(1, CS_NUM_SUB_RANGES - 1, 7);
+
+    UtAssert_UINT32_EQ(ResultsEntry.SubRangeChecksum[CS_NUM_SUB_RANGES - 1], 7);
+    UtAssert_UINT32_EQ(ResultsEntry.SubRangeMask, 1 | ((uint32)1 << (CS_NUM_SUB_RANGES - 1)));
+    UtAssert_UINT32_EQ(CS_AppData.RecomputeWorkers[1].SubRangeBusyMask, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void CS_SubRangesRunning_Test(void)
+{
+    UtAssert_BOOL_FALSE(CS_SubRangesRunning(1));
+
+    CS_AppData.RecomputeWorkers[1].SubRangeBusyMask = (uint32)1 << (CS_NUM_SUB_RANGES - 1);
+
+    UtAssert_BOOL_TRUE(CS_SubRangesRunning(1));
+
+    /* Another worker's sub-ranges do not count */
+    UtAssert_BOOL_FALSE(CS_SubRangesRunning(0));
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void CS_RecomputingTable_Test(void)
+{
+    uint8 Entry;
+
+    CS_AppData.RecomputeWorkers[1].Table = CS_MEMORY_TABLE;
+
+    UtAssert_BOOL_FALSE(CS_RecomputingTable(CS_MEMORY_TABLE));
+
+    CS_AppData.RecomputeWorkers[1].EntryPtr = &Entry;
+
+    UtAssert_BOOL_TRUE(CS_RecomputingTable(CS_MEMORY_TABLE));
+    UtAssert_BOOL_FALSE(CS_RecomputingTable(CS_EEPROM_TABLE));
+}
+
+void CS_RecomputingEntry_Test(void)
+{
+    uint8 Entry;
+
+    CS_AppData.RecomputeWorkers[1].Table   = CS_APP_TABLE;
+    CS_AppData.RecomputeWorkers[1].EntryID = 4;
+
+    UtAssert_BOOL_FALSE(CS_RecomputingEntry(CS_APP_TABLE, 4));
+
+    CS_AppData.RecomputeWorkers[1].EntryPtr = &Entry;
+
+    UtAssert_BOOL_TRUE(CS_RecomputingEntry(CS_APP_TABLE, 4));
+    UtAssert_BOOL_FALSE(CS_RecomputingEntry(CS_APP_TABLE, 3));
+    UtAssert_BOOL_FALSE(CS_RecomputingEntry(CS_TABLES_TABLE, 4));
+
+    /* The Tables entries of the CS definition tables under recompute */
+    CS_AppData.AppResTablesTblPtr = &CS_AppData.ResTablesTblPtr[4];
+    CS_AppData.MemResTablesTblPtr = &CS_AppData.ResTablesTblPtr[5];
+    UtAssert_BOOL_TRUE(CS_RecomputingEntry(CS_TABLES_TABLE, 4));
+    UtAssert_BOOL_FALSE(CS_RecomputingEntry(CS_TABLES_TABLE, 5));
+    UtAssert_BOOL_FALSE(CS_RecomputingEntry(CS_TABLES_TABLE, CS_MAX_NUM_TABLES_TABLE_ENTRIES));
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(CS_ZeroEepromTempValues_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ZeroEepromTempValues_Test");
@@ -725,13 +2104,92 @@ void UtTest_Setup(void)
     UtTest_Add(CS_FindEnabledAppEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindEnabledAppEntry_Test");
     UtTest_Add(CS_VerifyCmdLength_Test, CS_Test_Setup, CS_Test_TearDown, "CS_VerifyCmdLength_Test");
     UtTest_Add(CS_BackgroundCfeCore_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundCfeCore_Test");
+    UtTest_Add(CS_BackgroundCfeCore_Test_Recomputing, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundCfeCore_Test_Recomputing");
     UtTest_Add(CS_BackgroundOS_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundOS_Test");
+    UtTest_Add(CS_BackgroundOS_Test_Recomputing, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundOS_Test_Recomputing");
     UtTest_Add(CS_BackgroundEeprom_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundEeprom_Test");
     UtTest_Add(CS_BackgroundMemory_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundMemory_Test");
     UtTest_Add(CS_BackgroundTables_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundTables_Test");
+    UtTest_Add(CS_BackgroundTables_Test_DefTableRecompute, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundTables_Test_DefTableRecompute");
     UtTest_Add(CS_BackgroundApp_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundApp_Test");
+    UtTest_Add(CS_BackgroundApp_Test_CarryBytes, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundApp_Test_CarryBytes");
+    UtTest_Add(CS_BackgroundApp_Test_TableBudget, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundApp_Test_TableBudget");
+    UtTest_Add(CS_BackgroundApp_Test_RecordVerification, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundApp_Test_RecordVerification");
     UtTest_Add(CS_ResetTablesTblResultEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ResetTablesTblResultEntry_Test");
     UtTest_Add(CS_HandleRoutineTableUpdates_Test, CS_Test_Setup, CS_Test_TearDown, "CS_HandleRoutineTableUpdates_Test");
+    UtTest_Add(CS_HandleRoutineTableUpdates_Test_BudgetError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_HandleRoutineTableUpdates_Test_BudgetError");
     UtTest_Add(CS_AttemptTableReshare_Test, CS_Test_Setup, CS_Test_TearDown, "CS_AttemptTableReshare_Test");
     UtTest_Add(CS_CheckRecomputeOneShot_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CheckRecomputeOneShot_Test");
+    UtTest_Add(CS_CalibrateDefaultCRC_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CalibrateDefaultCRC_Test");
+    UtTest_Add(CS_CalibrateDefaultCRC_Test_UnknownKernel, CS_Test_Setup, CS_Test_TearDown,
+               "CS_CalibrateDefaultCRC_Test_UnknownKernel");
+    UtTest_Add(CS_UpdateBytesPerCycle_Test_Undershoot, CS_Test_Setup, CS_Test_TearDown,
+               "CS_UpdateBytesPerCycle_Test_Undershoot");
+    UtTest_Add(CS_UpdateBytesPerCycle_Test_Overshoot, CS_Test_Setup, CS_Test_TearDown,
+               "CS_UpdateBytesPerCycle_Test_Overshoot");
+    UtTest_Add(CS_UpdateBytesPerCycle_Test_Limits, CS_Test_Setup, CS_Test_TearDown, "CS_UpdateBytesPerCycle_Test_Limits");
+    UtTest_Add(CS_GetBytesPerCycle_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetBytesPerCycle_Test");
+    UtTest_Add(CS_ResetCycleBytes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ResetCycleBytes_Test");
+    UtTest_Add(CS_ResetCycleBytes_Test_Shared, CS_Test_Setup, CS_Test_TearDown, "CS_ResetCycleBytes_Test_Shared");
+    UtTest_Add(CS_ShareCycleBytes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ShareCycleBytes_Test");
+    UtTest_Add(CS_UseCycleBytes_Test, CS_Test_Setup, CS_Test_TearDown, "CS_UseCycleBytes_Test");
+    UtTest_Add(CS_GetLateness_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetLateness_Test");
+    UtTest_Add(CS_RecordVerification_Test, CS_Test_Setup, CS_Test_TearDown, "CS_RecordVerification_Test");
+    UtTest_Add(CS_FindOverdueEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindOverdueEntry_Test");
+    UtTest_Add(CS_FindOverdueEntry_Test_Recomputing, CS_Test_Setup, CS_Test_TearDown,
+               "CS_FindOverdueEntry_Test_Recomputing");
+    UtTest_Add(CS_BackgroundEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundEntry_Test");
+    UtTest_Add(CS_GetWeightedQuantum_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetWeightedQuantum_Test");
+    UtTest_Add(CS_BackgroundWeighted_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundWeighted_Test");
+    UtTest_Add(CS_BackgroundWeighted_Test_PassDone, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundWeighted_Test_PassDone");
+    UtTest_Add(CS_BackgroundWeighted_Test_NothingEnabled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundWeighted_Test_NothingEnabled");
+    UtTest_Add(CS_BackgroundWeighted_Test_TableBudget, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundWeighted_Test_TableBudget");
+    UtTest_Add(CS_BackgroundChunk_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundChunk_Test");
+    UtTest_Add(CS_BackgroundInterleaved_Test, CS_Test_Setup, CS_Test_TearDown, "CS_BackgroundInterleaved_Test");
+    UtTest_Add(CS_CategoryPassDone_Test, CS_Test_Setup, CS_Test_TearDown, "CS_CategoryPassDone_Test");
+    UtTest_Add(CS_BackgroundInterleaved_Test_NothingEnabled, CS_Test_Setup, CS_Test_TearDown,
+               "CS_BackgroundInterleaved_Test_NothingEnabled");
+    UtTest_Add(CS_GetEnabledMap_Test, CS_Test_Setup, CS_Test_TearDown, "CS_GetEnabledMap_Test");
+    UtTest_Add(CS_SetEntryEnabled_Test, CS_Test_Setup, CS_Test_TearDown, "CS_SetEntryEnabled_Test");
+    UtTest_Add(CS_FirstSetBit_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FirstSetBit_Test");
+    UtTest_Add(CS_FindNextEnabledEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindNextEnabledEntry_Test");
+    UtTest_Add(CS_FindNextEnabledEntry_Test_Recomputing, CS_Test_Setup, CS_Test_TearDown,
+               "CS_FindNextEnabledEntry_Test_Recomputing");
+    UtTest_Add(CS_ChildTaskIsFree_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ChildTaskIsFree_Test");
+    UtTest_Add(CS_QueueChildTaskRequest_Test, CS_Test_Setup, CS_Test_TearDown, "CS_QueueChildTaskRequest_Test");
+    UtTest_Add(CS_StartQueuedRequests_Test, CS_Test_Setup, CS_Test_TearDown, "CS_StartQueuedRequests_Test");
+    UtTest_Add(CS_StartQueuedRequests_Test_PutBack, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartQueuedRequests_Test_PutBack");
+
+    UtTest_Add(CS_StartRecomputeWorker_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartRecomputeWorker_Test_Nominal");
+    UtTest_Add(CS_StartRecomputeWorker_Test_EntryLocked, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartRecomputeWorker_Test_EntryLocked");
+    UtTest_Add(CS_StartRecomputeWorker_Test_NoneFree, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartRecomputeWorker_Test_NoneFree");
+    UtTest_Add(CS_StartRecomputeWorker_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartRecomputeWorker_Test_PostWorkError");
+    UtTest_Add(CS_PostWork_Test, CS_Test_Setup, CS_Test_TearDown, "CS_PostWork_Test");
+    UtTest_Add(CS_FindWorkerQueue_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindWorkerQueue_Test");
+    UtTest_Add(CS_FindRecomputeWorker_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindRecomputeWorker_Test");
+    UtTest_Add(CS_ReleaseRecomputeWorker_Test, CS_Test_Setup, CS_Test_TearDown, "CS_ReleaseRecomputeWorker_Test");
+    UtTest_Add(CS_ResetRecomputeDefTableEntry_Test, CS_Test_Setup, CS_Test_TearDown,
+               "CS_ResetRecomputeDefTableEntry_Test");
+    UtTest_Add(CS_StartSubRangeTask_Test_Nominal, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartSubRangeTask_Test_Nominal");
+    UtTest_Add(CS_StartSubRangeTask_Test_PostWorkError, CS_Test_Setup, CS_Test_TearDown,
+               "CS_StartSubRangeTask_Test_PostWorkError");
+    UtTest_Add(CS_StartSubRangeTask_Test_NoTask, CS_Test_Setup, CS_Test_TearDown, "CS_StartSubRangeTask_Test_NoTask");
+    UtTest_Add(CS_FindSubRangeTask_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FindSubRangeTask_Test");
+    UtTest_Add(CS_FinishSubRange_Test, CS_Test_Setup, CS_Test_TearDown, "CS_FinishSubRange_Test");
+    UtTest_Add(CS_SubRangesRunning_Test, CS_Test_Setup, CS_Test_TearDown, "CS_SubRangesRunning_Test");
+    UtTest_Add(CS_RecomputingTable_Test, CS_Test_Setup, CS_Test_TearDown, "CS_RecomputingTable_Test");
+    UtTest_Add(CS_RecomputingEntry_Test, CS_Test_Setup, CS_Test_TearDown, "CS_RecomputingEntry_Test");
 }
@@ -30,6 +30,12 @@
 
 CS_AppData_t CS_AppData;
 
+void CS_ProcessCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ProcessCmd), BufPtr);
+    UT_DEFAULT_IMPL(CS_ProcessCmd);
+}
+
 #if (CS_PRESERVE_STATES_ON_PROCESSOR_RESET == true)
 void CS_UpdateCDS(void)
 {
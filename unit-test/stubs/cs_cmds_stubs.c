@@ -47,6 +47,31 @@ void CS_BackgroundCheckCycle(const CS_NoArgsCmd_t *CmdPtr)
     UT_DEFAULT_IMPL(CS_BackgroundCheckCycle);
 }
 
+void CS_RunBackgroundCycle(void)
+{
+    UT_DEFAULT_IMPL(CS_RunBackgroundCycle);
+}
+
+void CS_PaceBackgroundCycle(void)
+{
+    UT_DEFAULT_IMPL(CS_PaceBackgroundCycle);
+}
+
+bool CS_BackgroundCurrentTable(void)
+{
+    return UT_DEFAULT_IMPL(CS_BackgroundCurrentTable);
+}
+
+int32 CS_GetPipeTimeout(void)
+{
+    return UT_DEFAULT_IMPL(CS_GetPipeTimeout);
+}
+
+void CS_HarvestIdleTime(void)
+{
+    UT_DEFAULT_IMPL(CS_HarvestIdleTime);
+}
+
 void CS_DisableAllCSCmd(const CS_NoArgsCmd_t *CmdPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_DisableAllCSCmd), CmdPtr);
@@ -118,3 +143,45 @@ void CS_CancelOneShotCmd(const CS_NoArgsCmd_t *CmdPtr)
     UT_Stub_RegisterContext(UT_KEY(CS_CancelOneShotCmd), CmdPtr);
     UT_DEFAULT_IMPL(CS_CancelOneShotCmd);
 }
+
+void CS_CalibrateCRCCmd(const CS_NoArgsCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_CalibrateCRCCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_CalibrateCRCCmd);
+}
+
+void CS_SetCycleTimeBudgetCmd(const CS_SetCycleTimeBudgetCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetCycleTimeBudgetCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetCycleTimeBudgetCmd);
+}
+
+void CS_SetCycleTimeTargetCmd(const CS_SetCycleTimeTargetCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetCycleTimeTargetCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetCycleTimeTargetCmd);
+}
+
+void CS_SetBytesPerCycleCmd(const CS_SetBytesPerCycleCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetBytesPerCycleCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetBytesPerCycleCmd);
+}
+
+void CS_SetSchedulerModeCmd(const CS_SetSchedulerModeCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetSchedulerModeCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetSchedulerModeCmd);
+}
+
+void CS_SetPacingPeriodCmd(const CS_SetPacingPeriodCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetPacingPeriodCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetPacingPeriodCmd);
+}
+
+void CS_SetIdleBytesCmd(const CS_SetIdleBytesCmd_t *CmdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_SetIdleBytesCmd), CmdPtr);
+    UT_DEFAULT_IMPL(CS_SetIdleBytesCmd);
+}
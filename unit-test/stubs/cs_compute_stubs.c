@@ -28,28 +28,81 @@
 #include "utassert.h"
 #include "utstubs.h"
 
-CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
-                                    bool *DoneWithEntry)
+CFE_Status_t CS_ComputeEepromMemory(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                                    uint32 *ComputedCSValue, bool *DoneWithEntry)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), BytesRemaining);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemory), DoneWithEntry);
 
     return UT_DEFAULT_IMPL(CS_ComputeEepromMemory);
 }
 
-CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+void CS_GetEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange,
+                                uint32 *SubRangeOffset, uint32 *SubRangeBytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_GetEepromMemorySubRange), ResultsEntry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetEepromMemorySubRange), SubRange);
+    UT_Stub_RegisterContext(UT_KEY(CS_GetEepromMemorySubRange), SubRangeOffset);
+    UT_Stub_RegisterContext(UT_KEY(CS_GetEepromMemorySubRange), SubRangeBytes);
+
+    UT_DEFAULT_IMPL(CS_GetEepromMemorySubRange);
+}
+
+CFE_Status_t CS_MergeEepromMemorySubRanges(CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue,
+                                           bool *DoneWithEntry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_MergeEepromMemorySubRanges), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_MergeEepromMemorySubRanges), ComputedCSValue);
+    UT_Stub_RegisterContext(UT_KEY(CS_MergeEepromMemorySubRanges), DoneWithEntry);
+
+    return UT_DEFAULT_IMPL(CS_MergeEepromMemorySubRanges);
+}
+
+bool CS_SplitEepromMemory(uint16 Table, const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SplitEepromMemory), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_SplitEepromMemory), ResultsEntry);
+
+    return UT_DEFAULT_IMPL(CS_SplitEepromMemory);
+}
+
+uint32 CS_ChecksumEepromMemorySubRange(const CS_Res_EepromMemory_Table_Entry_t *ResultsEntry, uint16 SubRange)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ChecksumEepromMemorySubRange), ResultsEntry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ChecksumEepromMemorySubRange), SubRange);
+
+    return UT_DEFAULT_IMPL(CS_ChecksumEepromMemorySubRange);
+}
+
+CFE_Status_t CS_ComputeEepromMemorySplit(uint16 WorkerID, CS_Res_EepromMemory_Table_Entry_t *ResultsEntry,
+                                         uint32 *ComputedCSValue, bool *DoneWithEntry)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeEepromMemorySplit), WorkerID);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemorySplit), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemorySplit), ComputedCSValue);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeEepromMemorySplit), DoneWithEntry);
+
+    return UT_DEFAULT_IMPL(CS_ComputeEepromMemorySplit);
+}
+
+CFE_Status_t CS_ComputeTables(CS_Res_Tables_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining,
+                              uint32 *ComputedCSValue, bool *DoneWithEntry)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), BytesRemaining);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeTables), DoneWithEntry);
 
     return UT_DEFAULT_IMPL(CS_ComputeTables);
 }
 
-CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *ComputedCSValue, bool *DoneWithEntry)
+CFE_Status_t CS_ComputeApp(CS_Res_App_Table_Entry_t *ResultsEntry, uint32 *BytesRemaining, uint32 *ComputedCSValue,
+                           bool *DoneWithEntry)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), ResultsEntry);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), BytesRemaining);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), ComputedCSValue);
     UT_Stub_RegisterContext(UT_KEY(CS_ComputeApp), DoneWithEntry);
 
@@ -61,6 +114,11 @@ void CS_RecomputeEepromMemoryChildTask(void)
     UT_DEFAULT_IMPL(CS_RecomputeEepromMemoryChildTask);
 }
 
+void CS_SubRangeChildTask(void)
+{
+    UT_DEFAULT_IMPL(CS_SubRangeChildTask);
+}
+
 void CS_RecomputeTablesChildTask(void)
 {
     UT_DEFAULT_IMPL(CS_RecomputeTablesChildTask);
@@ -75,3 +133,8 @@ void CS_OneShotChildTask(void)
 {
     UT_DEFAULT_IMPL(CS_OneShotChildTask);
 }
+
+void CS_WorkerTask(void)
+{
+    UT_DEFAULT_IMPL(CS_WorkerTask);
+}
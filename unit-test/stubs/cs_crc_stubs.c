@@ -0,0 +1,82 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_crc.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_InitCRC(void)
+{
+    UT_DEFAULT_IMPL(CS_InitCRC);
+}
+
+bool CS_CRCHardwareSupported(void)
+{
+    return UT_DEFAULT_IMPL(CS_CRCHardwareSupported);
+}
+
+bool CS_SelectCRCHardware(bool UseHardware)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SelectCRCHardware), UseHardware);
+
+    return UT_DEFAULT_IMPL(CS_SelectCRCHardware);
+}
+
+uint8 CS_GetCRCKernel(uint32 TypeCRC)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetCRCKernel), TypeCRC);
+
+    return UT_DEFAULT_IMPL(CS_GetCRCKernel);
+}
+
+uint8 CS_CalibrateCRC(uint32 TypeCRC, uint32 *KBytesPerSec)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CalibrateCRC), TypeCRC);
+    UT_Stub_RegisterContext(UT_KEY(CS_CalibrateCRC), KBytesPerSec);
+
+    return UT_DEFAULT_IMPL(CS_CalibrateCRC);
+}
+
+uint32 CS_ComputeCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeCRC), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeCRC), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeCRC), InputCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeCRC), TypeCRC);
+
+    return UT_DEFAULT_IMPL(CS_ComputeCRC);
+}
+
+bool CS_CombineCRC(uint32 FirstCRC, uint32 SecondCRC, size_t SecondLength, uint32 TypeCRC, uint32 *CombinedCRC)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CombineCRC), FirstCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CombineCRC), SecondCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CombineCRC), SecondLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CombineCRC), TypeCRC);
+    UT_Stub_RegisterContext(UT_KEY(CS_CombineCRC), CombinedCRC);
+
+    return UT_DEFAULT_IMPL(CS_CombineCRC);
+}
@@ -0,0 +1,51 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,915-1, and identified as “cFS Checksum
+ * Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Includes
+ */
+
+#include "cs_hash.h"
+
+/* UT includes */
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void CS_ComputeHash(const void *DataPtr, size_t DataLength, size_t ByteOffset, CS_Hash_State_t *State,
+                    uint32 Algorithm)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeHash), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeHash), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeHash), ByteOffset);
+    UT_Stub_RegisterContext(UT_KEY(CS_ComputeHash), State);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ComputeHash), Algorithm);
+
+    UT_DEFAULT_IMPL(CS_ComputeHash);
+}
+
+void CS_FinishHash(const CS_Hash_State_t *State, size_t TotalLength, uint32 Algorithm, uint64 *HashValue)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_FinishHash), State);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FinishHash), TotalLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FinishHash), Algorithm);
+    UT_Stub_RegisterContext(UT_KEY(CS_FinishHash), HashValue);
+
+    UT_DEFAULT_IMPL(CS_FinishHash);
+}
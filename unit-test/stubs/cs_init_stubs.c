@@ -42,3 +42,13 @@ CFE_Status_t CS_InitSegments(void)
 {
     return UT_DEFAULT_IMPL(CS_InitAllTables);
 }
+
+CFE_Status_t CS_InitRecomputeWorkers(void)
+{
+    return UT_DEFAULT_IMPL(CS_InitRecomputeWorkers);
+}
+
+CFE_Status_t CS_InitWorkerTasks(void)
+{
+    return UT_DEFAULT_IMPL(CS_InitWorkerTasks);
+}
@@ -28,6 +28,20 @@
 #include "utassert.h"
 #include "utstubs.h"
 
+bool CS_ValidateAlgorithm(uint16 Algorithm)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ValidateAlgorithm), Algorithm);
+
+    return UT_DEFAULT_IMPL(CS_ValidateAlgorithm);
+}
+
+uint16 CS_GetEntryAlgorithm(uint16 Algorithm)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetEntryAlgorithm), Algorithm);
+
+    return UT_DEFAULT_IMPL(CS_GetEntryAlgorithm);
+}
+
 CFE_Status_t CS_ValidateEepromChecksumDefinitionTable(void *TblPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(CS_ValidateEepromChecksumDefinitionTable), TblPtr);
@@ -56,6 +70,13 @@ CFE_Status_t CS_ValidateAppChecksumDefinitionTable(void *TblPtr)
     return UT_DEFAULT_IMPL(CS_ValidateAppChecksumDefinitionTable);
 }
 
+CFE_Status_t CS_ValidateBudgetTable(void *TblPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ValidateBudgetTable), TblPtr);
+
+    return UT_DEFAULT_IMPL(CS_ValidateBudgetTable);
+}
+
 void CS_ProcessNewEepromMemoryDefinitionTable(const CS_Def_EepromMemory_Table_Entry_t *DefinitionTblPtr,
                                               const CS_Res_EepromMemory_Table_Entry_t *ResultsTblPtr,
                                               const uint16 NumEntries, const uint16 Table)
@@ -127,3 +148,18 @@ CFE_Status_t CS_HandleTableUpdate(void *DefinitionTblPtr, void *ResultsTblPtr,
 
     return UT_DEFAULT_IMPL(CS_HandleTableUpdate);
 }
+
+CFE_Status_t CS_BudgetTableInit(void)
+{
+    return UT_DEFAULT_IMPL(CS_BudgetTableInit);
+}
+
+CFE_Status_t CS_HandleBudgetTableUpdate(void)
+{
+    return UT_DEFAULT_IMPL(CS_HandleBudgetTableUpdate);
+}
+
+void CS_RefreshBudgets(void)
+{
+    UT_DEFAULT_IMPL(CS_RefreshBudgets);
+}
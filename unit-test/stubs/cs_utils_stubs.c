@@ -190,3 +190,275 @@ bool CS_CheckRecomputeOneshot(void)
 {
     return UT_DEFAULT_IMPL(CS_CheckRecomputeOneshot);
 }
+
+void CS_CalibrateDefaultCRC(void)
+{
+    UT_DEFAULT_IMPL(CS_CalibrateDefaultCRC);
+}
+
+void CS_UpdateBytesPerCycle(uint32 CycleTime, uint32 CycleBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_UpdateBytesPerCycle), CycleTime);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_UpdateBytesPerCycle), CycleBytes);
+
+    UT_DEFAULT_IMPL(CS_UpdateBytesPerCycle);
+}
+
+uint32 CS_GetBytesPerCycle(uint16 Budget)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetBytesPerCycle), Budget);
+
+    return UT_DEFAULT_IMPL(CS_GetBytesPerCycle);
+}
+
+void CS_ResetCycleBytes(void)
+{
+    UT_DEFAULT_IMPL(CS_ResetCycleBytes);
+}
+
+uint32 CS_GetCycleBytes(uint16 Table)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetCycleBytes), Table);
+
+    return UT_DEFAULT_IMPL(CS_GetCycleBytes);
+}
+
+bool CS_UseCycleBytes(uint16 Table, uint32 BytesLeft)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_UseCycleBytes), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_UseCycleBytes), BytesLeft);
+
+    return UT_DEFAULT_IMPL(CS_UseCycleBytes);
+}
+
+uint32 CS_GetCurrentSeconds(void)
+{
+    return UT_DEFAULT_IMPL(CS_GetCurrentSeconds);
+}
+
+void CS_RecordVerification(uint32 *VerifiedTime, uint32 MaxStaleness)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_RecordVerification), VerifiedTime);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_RecordVerification), MaxStaleness);
+
+    UT_DEFAULT_IMPL(CS_RecordVerification);
+}
+
+uint32 CS_GetLateness(uint16 State, uint32 MaxStaleness, uint32 VerifiedTime, uint32 Now)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetLateness), State);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetLateness), MaxStaleness);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetLateness), VerifiedTime);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetLateness), Now);
+
+    return UT_DEFAULT_IMPL(CS_GetLateness);
+}
+
+bool CS_FindOverdueEntry(uint16 *Table, uint16 *Entry)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_FindOverdueEntry), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindOverdueEntry), Entry);
+
+    return UT_DEFAULT_IMPL(CS_FindOverdueEntry);
+}
+
+bool CS_BackgroundEntry(uint16 Table, uint16 *Entry, bool *TableDone)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BackgroundEntry), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_BackgroundEntry), Entry);
+    UT_Stub_RegisterContext(UT_KEY(CS_BackgroundEntry), TableDone);
+
+    return UT_DEFAULT_IMPL(CS_BackgroundEntry);
+}
+
+uint32 CS_GetWeightedQuantum(uint16 Table)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetWeightedQuantum), Table);
+
+    return UT_DEFAULT_IMPL(CS_GetWeightedQuantum);
+}
+
+void CS_CategoryPassDone(uint16 Table)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_CategoryPassDone), Table);
+
+    UT_DEFAULT_IMPL(CS_CategoryPassDone);
+}
+
+bool CS_BackgroundWeighted(void)
+{
+    return UT_DEFAULT_IMPL(CS_BackgroundWeighted);
+}
+
+uint32 CS_BackgroundChunk(uint16 Table, uint32 ChunkBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BackgroundChunk), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_BackgroundChunk), ChunkBytes);
+
+    return UT_DEFAULT_IMPL(CS_BackgroundChunk);
+}
+
+bool CS_BackgroundInterleaved(void)
+{
+    return UT_DEFAULT_IMPL(CS_BackgroundInterleaved);
+}
+
+uint32 *CS_GetEnabledMap(uint16 Table, uint16 *NumEntries)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_GetEnabledMap), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_GetEnabledMap), NumEntries);
+
+    UT_DEFAULT_IMPL(CS_GetEnabledMap);
+
+    *NumEntries = 0;
+
+    return NULL;
+}
+
+void CS_SetEntryEnabled(uint16 Table, uint16 Entry, bool Enabled)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEntryEnabled), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEntryEnabled), Entry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SetEntryEnabled), Enabled);
+
+    UT_DEFAULT_IMPL(CS_SetEntryEnabled);
+}
+
+uint16 CS_FirstSetBit(uint32 Word)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FirstSetBit), Word);
+
+    return UT_DEFAULT_IMPL(CS_FirstSetBit);
+}
+
+bool CS_FindNextEnabledEntry(uint16 Table, uint16 *Entry)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FindNextEnabledEntry), Table);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindNextEnabledEntry), Entry);
+
+    return UT_DEFAULT_IMPL(CS_FindNextEnabledEntry);
+}
+
+bool CS_ChildTaskIsFree(void)
+{
+    return UT_DEFAULT_IMPL(CS_ChildTaskIsFree);
+}
+
+bool CS_QueueChildTaskRequest(const CFE_MSG_Message_t *MsgPtr, size_t MsgSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_QueueChildTaskRequest), MsgPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_QueueChildTaskRequest), MsgSize);
+
+    return UT_DEFAULT_IMPL(CS_QueueChildTaskRequest);
+}
+
+void CS_StartQueuedRequests(void)
+{
+    UT_DEFAULT_IMPL(CS_StartQueuedRequests);
+}
+
+
+CFE_Status_t CS_StartRecomputeWorker(uint16 Table, uint16 EntryID, void *EntryPtr,
+                                     CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartRecomputeWorker), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartRecomputeWorker), EntryID);
+    UT_Stub_RegisterContext(UT_KEY(CS_StartRecomputeWorker), EntryPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartRecomputeWorker), WorkFunc);
+
+    return UT_DEFAULT_IMPL(CS_StartRecomputeWorker);
+}
+
+CFE_Status_t CS_PostWork(osal_id_t QueueID, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_PostWork), QueueID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_PostWork), WorkFunc);
+
+    return UT_DEFAULT_IMPL(CS_PostWork);
+}
+
+osal_id_t CS_FindWorkerQueue(void)
+{
+    osal_id_t QueueID = OS_OBJECT_ID_UNDEFINED;
+
+    UT_DEFAULT_IMPL(CS_FindWorkerQueue);
+
+    UT_Stub_CopyToLocal(UT_KEY(CS_FindWorkerQueue), &QueueID, sizeof(QueueID));
+
+    return QueueID;
+}
+
+uint16 CS_FindRecomputeWorker(void)
+{
+    return UT_DEFAULT_IMPL(CS_FindRecomputeWorker);
+}
+
+void CS_ReleaseRecomputeWorker(uint16 WorkerID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ReleaseRecomputeWorker), WorkerID);
+
+    UT_DEFAULT_IMPL(CS_ReleaseRecomputeWorker);
+}
+
+void CS_ResetRecomputeDefTableEntry(CS_Res_Tables_Table_Entry_t *TablesTblResultEntry, CFE_TBL_Handle_t DefTblHandle)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_ResetRecomputeDefTableEntry), TablesTblResultEntry);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ResetRecomputeDefTableEntry), DefTblHandle);
+
+    UT_DEFAULT_IMPL(CS_ResetRecomputeDefTableEntry);
+}
+
+CFE_Status_t CS_StartSubRangeTask(uint16 WorkerID, uint16 SubRange, CFE_ES_ChildTaskMainFuncPtr_t WorkFunc)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartSubRangeTask), WorkerID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartSubRangeTask), SubRange);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_StartSubRangeTask), WorkFunc);
+
+    return UT_DEFAULT_IMPL(CS_StartSubRangeTask);
+}
+
+bool CS_FindSubRangeTask(uint16 *WorkerID, uint16 *SubRange)
+{
+    UT_Stub_RegisterContext(UT_KEY(CS_FindSubRangeTask), WorkerID);
+    UT_Stub_RegisterContext(UT_KEY(CS_FindSubRangeTask), SubRange);
+
+    return UT_DEFAULT_IMPL(CS_FindSubRangeTask);
+}
+
+void CS_FinishSubRange(uint16 WorkerID, uint16 SubRange, uint32 SubRangeChecksum)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FinishSubRange), WorkerID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FinishSubRange), SubRange);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_FinishSubRange), SubRangeChecksum);
+
+    UT_DEFAULT_IMPL(CS_FinishSubRange);
+}
+
+bool CS_SubRangesRunning(uint16 WorkerID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_SubRangesRunning), WorkerID);
+
+    return UT_DEFAULT_IMPL(CS_SubRangesRunning);
+}
+
+bool CS_RecomputingTable(uint16 Table)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_RecomputingTable), Table);
+
+    return UT_DEFAULT_IMPL(CS_RecomputingTable);
+}
+
+bool CS_RecomputingEntry(uint16 Table, uint16 EntryID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_RecomputingEntry), Table);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_RecomputingEntry), EntryID);
+
+    return UT_DEFAULT_IMPL(CS_RecomputingEntry);
+}
+
+uint32 CS_ShareCycleBytes(uint32 Bytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(CS_ShareCycleBytes), Bytes);
+
+    return UT_DEFAULT_IMPL(CS_ShareCycleBytes);
+}
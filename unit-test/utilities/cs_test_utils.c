@@ -23,6 +23,7 @@
 
 #include "cs_test_utils.h"
 #include "cs_tbldefs.h"
+#include "cs_utils.h"
 
 /* UT includes */
 #include "uttest.h"
@@ -39,8 +40,9 @@ CS_Res_Tables_Table_Entry_t       CS_DefaultTablesResTable[CS_MAX_NUM_TABLES_TAB
 CS_Res_App_Table_Entry_t          CS_DefaultAppResTable[CS_MAX_NUM_APP_TABLE_ENTRIES];
 
 #define UT_MAX_SENDEVENT_DEPTH 4
-CFE_EVS_SendEvent_context_t    context_CFE_EVS_SendEvent[UT_MAX_SENDEVENT_DEPTH];
-CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
+CFE_EVS_SendEvent_context_t       context_CFE_EVS_SendEvent[UT_MAX_SENDEVENT_DEPTH];
+CFE_ES_WriteToSysLog_context_t    context_CFE_ES_WriteToSysLog;
+CS_StartRecomputeWorker_context_t context_CS_StartRecomputeWorker;
 
 void UT_Handler_CFE_EVS_SendEvent(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context, va_list va)
 {
@@ -73,6 +75,13 @@ void UT_Handler_CFE_ES_WriteToSysLog(void *UserObj, UT_EntryKey_t FuncKey, const
     context_CFE_ES_WriteToSysLog.Spec[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH - 1] = '\0';
 }
 
+void UT_Handler_CS_StartRecomputeWorker(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    context_CS_StartRecomputeWorker.Table    = UT_Hook_GetArgValueByName(Context, "Table", uint16);
+    context_CS_StartRecomputeWorker.EntryID  = UT_Hook_GetArgValueByName(Context, "EntryID", uint16);
+    context_CS_StartRecomputeWorker.EntryPtr = UT_Hook_GetArgValueByName(Context, "EntryPtr", void *);
+}
+
 void CS_Test_Setup(void)
 {
     /* initialize test environment to default state for every test */
@@ -81,10 +90,12 @@ void CS_Test_Setup(void)
     memset(&CS_AppData, 0, sizeof(CS_AppData));
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
     memset(&context_CFE_ES_WriteToSysLog, 0, sizeof(context_CFE_ES_WriteToSysLog));
+    memset(&context_CS_StartRecomputeWorker, 0, sizeof(context_CS_StartRecomputeWorker));
 
     /* Register custom handlers */
     UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_Handler_CFE_EVS_SendEvent, NULL);
     UT_SetVaHandlerFunction(UT_KEY(CFE_ES_WriteToSysLog), UT_Handler_CFE_ES_WriteToSysLog, NULL);
+    UT_SetHandlerFunction(UT_KEY(CS_StartRecomputeWorker), UT_Handler_CS_StartRecomputeWorker, NULL);
 
     CS_AppData.DefEepromTblPtr = &CS_AppData.DefaultEepromDefTable[0];
     CS_AppData.ResEepromTblPtr = &CS_DefaultEepromResTable[0];
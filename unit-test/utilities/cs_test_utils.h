@@ -44,8 +44,16 @@ typedef struct
     char Spec[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 } CFE_ES_WriteToSysLog_context_t;
 
-extern CFE_EVS_SendEvent_context_t    context_CFE_EVS_SendEvent[];
-extern CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
+typedef struct
+{
+    uint16 Table;
+    uint16 EntryID;
+    void * EntryPtr;
+} CS_StartRecomputeWorker_context_t;
+
+extern CFE_EVS_SendEvent_context_t       context_CFE_EVS_SendEvent[];
+extern CFE_ES_WriteToSysLog_context_t    context_CFE_ES_WriteToSysLog;
+extern CS_StartRecomputeWorker_context_t context_CS_StartRecomputeWorker;
 
 /*
  * Function Definitions